@@ -1,24 +1,25 @@
+#include <algorithm>
 #include <array>
 #include <cstdint>
-#include <cstdio>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <optional>
-#include <regex>
+#include <span>
 #include <sstream>
 #include <string>
 #include <vector>
 
-namespace {
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/image_io.hpp"
+#include "manim_cpp/renderer/pixel_convert.hpp"
+#include "manim_cpp/renderer/qoi_encoder.hpp"
+#include "manim_cpp/renderer/thread_pool.hpp"
+#include "manim_cpp/testing/npy_header.hpp"
+#include "manim_cpp/testing/npz_archive.hpp"
 
-#ifdef _WIN32
-#define MANIM_CPP_POPEN _popen
-#define MANIM_CPP_PCLOSE _pclose
-#else
-#define MANIM_CPP_POPEN popen
-#define MANIM_CPP_PCLOSE pclose
-#endif
+namespace {
 
 struct NpyFrameBuffer {
   std::size_t frames = 0;
@@ -28,210 +29,294 @@ struct NpyFrameBuffer {
   std::size_t data_offset = 0;
 };
 
-std::string trim(const std::string& value) {
-  const auto first = value.find_first_not_of(" \t\r\n");
-  if (first == std::string::npos) {
-    return "";
+// Reads the magic, version, length and header dict of a streamed npy entry,
+// leaving `reader` at the first data byte.
+std::optional<std::vector<std::uint8_t>> read_npy_header(
+    manim_cpp::testing::NpzEntryReader* reader) {
+  std::vector<std::uint8_t> header(12);
+  if (reader->read(header) != header.size()) {
+    return std::nullopt;
   }
-  const auto last = value.find_last_not_of(" \t\r\n");
-  return value.substr(first, last - first + 1);
-}
-
-std::string shell_escape(const std::string& text) {
-  std::string escaped;
-  escaped.reserve(text.size() + 4);
-  for (const char c : text) {
-    if (c == '\\' || c == '"') {
-      escaped.push_back('\\');
-    }
-    escaped.push_back(c);
+  const auto header_size = manim_cpp::testing::npy_header_size(header);
+  if (!header_size.has_value() || header_size.value() < header.size() ||
+      header_size.value() - header.size() > reader->remaining()) {
+    return std::nullopt;
   }
-  return escaped;
+  header.resize(header_size.value());
+  const auto rest = std::span(header).subspan(12);
+  if (reader->read(rest) != rest.size()) {
+    return std::nullopt;
+  }
+  return header;
 }
 
-std::optional<std::vector<std::uint8_t>> unzip_entry(
-    const std::filesystem::path& npz_path, const std::string& entry_name) {
-  std::ostringstream command;
-  command << "unzip -p \"" << shell_escape(npz_path.string()) << "\" \""
-          << shell_escape(entry_name) << "\"";
-  FILE* pipe = MANIM_CPP_POPEN(command.str().c_str(), "r");
-  if (pipe == nullptr) {
+// Frames must be a C-order uint8 array of shape (N, H, W, 3|4) that fits in
+// an entry of `entry_size` bytes.
+std::optional<NpyFrameBuffer> frame_layout(const std::span<const std::uint8_t> npy_header,
+                                           const std::uint64_t entry_size) {
+  const auto header = manim_cpp::testing::parse_npy_header(npy_header);
+  if (!header.has_value() || header->dtype != manim_cpp::testing::NpyDtype::kUint8 ||
+      header->fortran_order || header->rank != 4) {
     return std::nullopt;
   }
-
-  std::vector<std::uint8_t> bytes;
-  std::array<char, 8192> buffer{};
-  while (true) {
-    const std::size_t read = std::fread(buffer.data(), 1, buffer.size(), pipe);
-    if (read == 0) {
-      break;
-    }
-    bytes.insert(bytes.end(), buffer.begin(), buffer.begin() + read);
+  const auto& shape = header->shape;
+  if ((shape[3] != 3 && shape[3] != 4) || shape[0] == 0 || shape[1] == 0 || shape[2] == 0) {
+    return std::nullopt;
   }
-
-  const int status = MANIM_CPP_PCLOSE(pipe);
-  if (status != 0 || bytes.empty()) {
+  if (header->data_offset > entry_size || header->data_size() > entry_size - header->data_offset) {
     return std::nullopt;
   }
-  return bytes;
+  return NpyFrameBuffer{
+      .frames = static_cast<std::size_t>(shape[0]),
+      .height = static_cast<std::size_t>(shape[1]),
+      .width = static_cast<std::size_t>(shape[2]),
+      .channels = static_cast<std::size_t>(shape[3]),
+      .data_offset = header->data_offset,
+  };
 }
 
-std::optional<NpyFrameBuffer> parse_npy_header(
-    const std::vector<std::uint8_t>& npy_bytes) {
-  if (npy_bytes.size() < 16) {
-    return std::nullopt;
-  }
+enum class OutputFormat {
+  kPpm,
+  kPng,
+  kQoi,
+};
 
-  const std::array<std::uint8_t, 6> kMagic = {0x93, 'N', 'U', 'M', 'P', 'Y'};
-  if (!std::equal(kMagic.begin(), kMagic.end(), npy_bytes.begin())) {
-    return std::nullopt;
+std::optional<OutputFormat> parse_output_format(const std::string& value) {
+  if (value == "ppm") {
+    return OutputFormat::kPpm;
+  }
+  if (value == "png") {
+    return OutputFormat::kPng;
   }
+  if (value == "qoi") {
+    return OutputFormat::kQoi;
+  }
+  return std::nullopt;
+}
 
-  const std::uint8_t major_version = npy_bytes[6];
-  std::size_t header_len = 0;
-  std::size_t header_start = 0;
-  if (major_version == 1) {
-    header_len =
-        static_cast<std::size_t>(npy_bytes[8]) |
-        (static_cast<std::size_t>(npy_bytes[9]) << static_cast<std::size_t>(8));
-    header_start = 10;
-  } else if (major_version == 2) {
-    header_len = static_cast<std::size_t>(npy_bytes[8]) |
-                 (static_cast<std::size_t>(npy_bytes[9]) << 8) |
-                 (static_cast<std::size_t>(npy_bytes[10]) << 16) |
-                 (static_cast<std::size_t>(npy_bytes[11]) << 24);
-    header_start = 12;
-  } else {
-    return std::nullopt;
+const char* extension(const OutputFormat format) {
+  switch (format) {
+    case OutputFormat::kPpm:
+      return ".ppm";
+    case OutputFormat::kPng:
+      return ".png";
+    case OutputFormat::kQoi:
+      return ".qoi";
   }
+  return ".ppm";
+}
 
-  if (header_start + header_len > npy_bytes.size()) {
-    return std::nullopt;
+const char* format_name(const OutputFormat format) {
+  switch (format) {
+    case OutputFormat::kPpm:
+      return "PPM";
+    case OutputFormat::kPng:
+      return "PNG";
+    case OutputFormat::kQoi:
+      return "QOI";
   }
-  const std::size_t data_offset = header_start + header_len;
-  const std::string header(
-      reinterpret_cast<const char*>(npy_bytes.data() + header_start), header_len);
+  return "PPM";
+}
 
-  std::smatch match;
-  if (!std::regex_search(header, match, std::regex("'descr'\\s*:\\s*'([^']+)'")) ||
-      match.size() < 2) {
-    return std::nullopt;
+bool parse_size(const std::string& value, std::size_t* output) {
+  if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos) {
+    return false;
   }
-  if (match[1].str() != "|u1") {
-    return std::nullopt;
+  try {
+    *output = static_cast<std::size_t>(std::stoull(value));
+  } catch (...) {
+    return false;
   }
+  return true;
+}
 
-  if (!std::regex_search(header,
-                         match,
-                         std::regex("'fortran_order'\\s*:\\s*(True|False)")) ||
-      match.size() < 2) {
-    return std::nullopt;
+// "a:b:step" with a inclusive, b exclusive and any part optional, as in a
+// Python slice; a bare "a" selects one frame.
+struct FrameSelection {
+  std::size_t first = 0;
+  std::optional<std::size_t> end;
+  std::size_t step = 1;
+};
+
+std::optional<FrameSelection> parse_frame_selection(const std::string& value) {
+  std::vector<std::string> parts;
+  std::size_t begin = 0;
+  while (true) {
+    const auto colon = value.find(':', begin);
+    parts.push_back(value.substr(begin, colon - begin));
+    if (colon == std::string::npos) {
+      break;
+    }
+    begin = colon + 1;
   }
-  if (match[1].str() != "False") {
+  if (parts.size() > 3) {
     return std::nullopt;
   }
 
-  if (!std::regex_search(header, match, std::regex("'shape'\\s*:\\s*\\(([^\\)]*)\\)")) ||
-      match.size() < 2) {
+  FrameSelection selection;
+  if (!parts[0].empty() && !parse_size(parts[0], &selection.first)) {
     return std::nullopt;
   }
-
-  std::vector<std::size_t> shape;
-  std::stringstream shape_stream(match[1].str());
-  std::string token;
-  while (std::getline(shape_stream, token, ',')) {
-    token = trim(token);
-    if (token.empty()) {
-      continue;
-    }
-    try {
-      shape.push_back(static_cast<std::size_t>(std::stoull(token)));
-    } catch (...) {
+  if (parts.size() == 1) {
+    if (parts[0].empty()) {
       return std::nullopt;
     }
+    selection.end = selection.first + 1;
+    return selection;
   }
-
-  if (shape.size() != 4) {
-    return std::nullopt;
-  }
-  if (shape[3] != 3 && shape[3] != 4) {
-    return std::nullopt;
+  if (!parts[1].empty()) {
+    std::size_t end = 0;
+    if (!parse_size(parts[1], &end)) {
+      return std::nullopt;
+    }
+    selection.end = end;
   }
-  if (shape[0] == 0 || shape[1] == 0 || shape[2] == 0) {
+  if (parts.size() == 3 && !parts[2].empty() &&
+      (!parse_size(parts[2], &selection.step) || selection.step == 0)) {
     return std::nullopt;
   }
+  return selection;
+}
 
-  const std::size_t expected_bytes =
-      shape[0] * shape[1] * shape[2] * shape[3];
-  if (data_offset + expected_bytes > npy_bytes.size()) {
-    return std::nullopt;
+std::vector<std::size_t> selected_frames(const FrameSelection& selection,
+                                         const std::size_t frame_count) {
+  const std::size_t end = std::min(selection.end.value_or(frame_count), frame_count);
+  std::vector<std::size_t> frames;
+  for (std::size_t frame = selection.first; frame < end; frame += selection.step) {
+    frames.push_back(frame);
   }
-
-  return NpyFrameBuffer{
-      .frames = shape[0],
-      .height = shape[1],
-      .width = shape[2],
-      .channels = shape[3],
-      .data_offset = data_offset,
-  };
+  return frames;
 }
 
-bool write_frame_ppm(const std::filesystem::path& output_path,
-                     const std::uint8_t* frame_data,
-                     const std::size_t height,
-                     const std::size_t width,
-                     const std::size_t channels) {
-  std::ofstream output(output_path, std::ios::binary);
+bool write_bytes(const std::filesystem::path& output_path,
+                 const std::string& header,
+                 const std::uint8_t* data,
+                 const std::size_t size) {
+  std::ofstream output(output_path, std::ios::binary | std::ios::trunc);
   if (!output.is_open()) {
     return false;
   }
-  output << "P6\n" << width << " " << height << "\n255\n";
-
-  const std::size_t pixel_count = height * width;
-  if (channels == 3) {
-    output.write(reinterpret_cast<const char*>(frame_data),
-                 static_cast<std::streamsize>(pixel_count * 3));
-    return output.good();
-  }
+  output.write(header.data(), static_cast<std::streamsize>(header.size()));
+  output.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+  return output.good();
+}
 
-  std::array<char, 3> rgb{};
-  for (std::size_t i = 0; i < pixel_count; ++i) {
-    rgb[0] = static_cast<char>(frame_data[i * channels + 0]);
-    rgb[1] = static_cast<char>(frame_data[i * channels + 1]);
-    rgb[2] = static_cast<char>(frame_data[i * channels + 2]);
-    output.write(rgb.data(), static_cast<std::streamsize>(rgb.size()));
-    if (!output.good()) {
-      return false;
+bool write_frame(const std::filesystem::path& output_path,
+                 const OutputFormat format,
+                 const std::uint8_t* frame_data,
+                 const NpyFrameBuffer& layout) {
+  const std::size_t pixel_count = layout.height * layout.width;
+  switch (format) {
+    case OutputFormat::kPpm: {
+      const std::string header =
+          "P6\n" + std::to_string(layout.width) + " " + std::to_string(layout.height) + "\n255\n";
+      if (layout.channels == 3) {
+        return write_bytes(output_path, header, frame_data, pixel_count * 3);
+      }
+      // One scratch frame per worker, reused across frames.
+      thread_local std::vector<std::uint8_t> rgb;
+      rgb.resize(pixel_count * 3);
+      manim_cpp::renderer::rgba_to_rgb(frame_data, pixel_count, rgb.data());
+      return write_bytes(output_path, header, rgb.data(), rgb.size());
+    }
+    case OutputFormat::kPng: {
+      manim_cpp::renderer::FrameBuffer frame(layout.width, layout.height);
+      if (layout.channels == 4) {
+        std::copy_n(frame_data, frame.byte_size(), frame.data());
+      } else {
+        manim_cpp::renderer::rgb_to_rgba(frame_data, pixel_count, frame.data());
+      }
+      const auto png = manim_cpp::renderer::encode_png(frame);
+      return !png.empty() && write_bytes(output_path, {}, png.data(), png.size());
+    }
+    case OutputFormat::kQoi: {
+      const auto qoi = manim_cpp::renderer::encode_qoi(frame_data, layout.width, layout.height,
+                                                       layout.channels);
+      return !qoi.empty() && write_bytes(output_path, {}, qoi.data(), qoi.size());
     }
   }
-  return true;
+  return false;
 }
 
 void print_usage() {
   std::cout << "Manim-Cpp Graphical Test Frame Extractor\n";
-  std::cout << "Usage: manim-cpp-extract-frames <input.npz> <output_directory>\n";
+  std::cout << "Usage: manim-cpp-extract-frames [--frames a:b:step] [--jobs N]\n"
+               "                                [--format ppm|png|qoi]\n"
+               "                                <input.npz> <output_directory>\n";
 }
 
 }  // namespace
 
 int main(int argc, char** argv) {
-  if (argc != 3) {
+  FrameSelection selection;
+  std::size_t jobs = 0;
+  OutputFormat format = OutputFormat::kPpm;
+  std::vector<std::string> positional;
+  for (int index = 1; index < argc; ++index) {
+    const std::string arg = argv[index];
+    const bool has_value = index + 1 < argc;
+    if (arg == "--frames" && has_value) {
+      const auto parsed = parse_frame_selection(argv[++index]);
+      if (!parsed.has_value()) {
+        std::cerr << "Invalid --frames: " << argv[index] << "\n";
+        return 2;
+      }
+      selection = parsed.value();
+    } else if (arg == "--jobs" && has_value) {
+      if (!parse_size(argv[++index], &jobs)) {
+        std::cerr << "Invalid --jobs: " << argv[index] << "\n";
+        return 2;
+      }
+    } else if (arg == "--format" && has_value) {
+      const auto parsed = parse_output_format(argv[++index]);
+      if (!parsed.has_value()) {
+        std::cerr << "Invalid --format: " << argv[index] << "\n";
+        return 2;
+      }
+      format = parsed.value();
+    } else if (arg.starts_with("--")) {
+      print_usage();
+      return 2;
+    } else {
+      positional.push_back(arg);
+    }
+  }
+  if (positional.size() != 2) {
     print_usage();
     return 2;
   }
 
-  const std::filesystem::path input_npz = argv[1];
-  const std::filesystem::path output_dir = argv[2];
+  const std::filesystem::path input_npz = positional[0];
+  const std::filesystem::path output_dir = positional[1];
   std::filesystem::create_directories(output_dir);
 
-  const auto npy_bytes = unzip_entry(input_npz, "frame_data.npy");
-  if (!npy_bytes.has_value()) {
-    std::cerr << "Unable to extract frame_data.npy from " << input_npz
-              << ". Ensure 'unzip' is available and the archive is valid.\n";
+  // Stored entries are read in place from the mapping; deflated ones are
+  // inflated front to back, a batch of frames at a time.
+  manim_cpp::testing::NpzArchive archive;
+  if (!archive.open(input_npz)) {
+    std::cerr << archive.error() << "\n";
     return 1;
   }
+  const auto* entry = archive.find_entry("frame_data.npy");
+  if (entry == nullptr) {
+    std::cerr << "No frame_data.npy entry in " << input_npz << ".\n";
+    return 1;
+  }
+  const auto stored = archive.stored_entry_bytes(*entry);
+  manim_cpp::testing::NpzEntryReader reader;
+  std::optional<std::vector<std::uint8_t>> streamed_header;
+  if (!stored.has_value()) {
+    if (!reader.open(archive, *entry) ||
+        !(streamed_header = read_npy_header(&reader)).has_value()) {
+      std::cerr << "Unable to read frame_data.npy from " << input_npz << ": "
+                << (reader.error().empty() ? "truncated npy header" : reader.error()) << "\n";
+      return 1;
+    }
+  }
 
-  const auto frame_buffer = parse_npy_header(npy_bytes.value());
+  const auto frame_buffer = stored.has_value()
+                                ? frame_layout(stored.value(), stored->size())
+                                : frame_layout(streamed_header.value(), entry->uncompressed_size);
   if (!frame_buffer.has_value()) {
     std::cerr << "Unsupported or invalid frame_data.npy format in " << input_npz
               << ". Expected C-order uint8 array with shape (N,H,W,3|4).\n";
@@ -240,22 +325,69 @@ int main(int argc, char** argv) {
 
   const std::size_t frame_size =
       frame_buffer->height * frame_buffer->width * frame_buffer->channels;
-  const std::uint8_t* data_start = npy_bytes->data() + frame_buffer->data_offset;
+  const auto frames = selected_frames(selection, frame_buffer->frames);
+  if (frames.empty()) {
+    std::cerr << "No frames selected; " << input_npz << " has " << frame_buffer->frames
+              << " frame(s).\n";
+    return 1;
+  }
 
-  for (std::size_t frame = 0; frame < frame_buffer->frames; ++frame) {
-    const auto output_path = output_dir / ("frame" + std::to_string(frame) + ".ppm");
-    const std::uint8_t* frame_ptr = data_start + frame * frame_size;
-    if (!write_frame_ppm(output_path,
-                         frame_ptr,
-                         frame_buffer->height,
-                         frame_buffer->width,
-                         frame_buffer->channels)) {
-      std::cerr << "Failed to write frame file: " << output_path << "\n";
-      return 1;
+  std::mutex error_mutex;
+  std::optional<std::filesystem::path> failed_path;
+  const auto write_selected = [&](const std::size_t frame,
+                                  const std::span<const std::uint8_t> frame_bytes) {
+    const auto output_path =
+        output_dir / ("frame" + std::to_string(frame) + extension(format));
+    if (!write_frame(output_path, format, frame_bytes.data(), frame_buffer.value())) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      if (!failed_path.has_value()) {
+        failed_path = output_path;
+      }
     }
+  };
+  manim_cpp::renderer::WorkStealingThreadPool pool(
+      std::min(jobs == 0 ? manim_cpp::renderer::default_worker_count() : jobs, frames.size()));
+
+  if (stored.has_value()) {
+    // Only the selected frames' pages of a mapped entry are ever touched.
+    const auto frame_data = stored->subspan(frame_buffer->data_offset);
+    pool.parallel_for(frames.size(), [&](const std::size_t task) {
+      const auto frame_bytes = frame_data.subspan(frames[task] * frame_size, frame_size);
+      write_selected(frames[task], frame_bytes);
+      // Keeps the resident set at about one frame per job however long the
+      // archive.
+      archive.file().release(frame_bytes);
+    });
+  } else {
+    // Inflation is sequential, so frames are read a batch at a time and the
+    // batch is encoded in parallel; unselected frames are skipped.
+    std::vector<std::vector<std::uint8_t>> batch(std::min(pool.worker_count() * 2, frames.size()),
+                                                 std::vector<std::uint8_t>(frame_size));
+    std::size_t next_frame = 0;
+    for (std::size_t first = 0; first < frames.size() && !failed_path.has_value();
+         first += batch.size()) {
+      const std::size_t count = std::min(batch.size(), frames.size() - first);
+      for (std::size_t index = 0; index < count; ++index) {
+        const std::size_t frame = frames[first + index];
+        if (!reader.skip(static_cast<std::uint64_t>(frame - next_frame) * frame_size) ||
+            reader.read(batch[index]) != frame_size) {
+          std::cerr << "Unable to read frame " << frame << " from " << input_npz << ": "
+                    << reader.error() << "\n";
+          return 1;
+        }
+        next_frame = frame + 1;
+      }
+      pool.parallel_for(count, [&](const std::size_t task) {
+        write_selected(frames[first + task], batch[task]);
+      });
+    }
+  }
+  if (failed_path.has_value()) {
+    std::cerr << "Failed to write frame file: " << failed_path.value() << "\n";
+    return 1;
   }
 
-  std::cout << "Saved " << frame_buffer->frames << " frame(s) to " << output_dir
-            << " (PPM format).\n";
+  std::cout << "Saved " << frames.size() << " frame(s) to " << output_dir << " ("
+            << format_name(format) << " format).\n";
   return 0;
 }
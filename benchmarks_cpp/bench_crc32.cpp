@@ -0,0 +1,41 @@
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "manim_cpp/testing/crc32.hpp"
+
+namespace {
+
+// Contents do not affect CRC speed; a cheap fill keeps setup fast.
+std::vector<std::uint8_t> filled_bytes(const std::size_t size) {
+  std::vector<std::uint8_t> bytes(size);
+  for (std::size_t index = 0; index < bytes.size(); ++index) {
+    bytes[index] = static_cast<std::uint8_t>(index * 2654435761U >> 13U);
+  }
+  return bytes;
+}
+
+// The dispatched path; the label names the instructions it picked.
+void BM_Crc32Update(benchmark::State& state) {
+  const auto bytes = filled_bytes(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::testing::crc32_update(0, bytes));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+  state.SetLabel(manim_cpp::testing::crc32_implementation_name());
+}
+BENCHMARK(BM_Crc32Update)->RangeMultiplier(16)->Range(1 << 10, 32 << 20);
+
+void BM_Crc32SlicingBy8(benchmark::State& state) {
+  const auto bytes = filled_bytes(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::testing::crc32_update_slicing_by_8(0, bytes));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Crc32SlicingBy8)->RangeMultiplier(16)->Range(1 << 10, 32 << 20);
+
+}  // namespace
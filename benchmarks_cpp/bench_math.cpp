@@ -0,0 +1,197 @@
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "manim_cpp/math/core.hpp"
+#include "manim_cpp/math/isocurve.hpp"
+#include "manim_cpp/math/path_ops.hpp"
+#include "manim_cpp/math/polygon_boolean.hpp"
+#include "manim_cpp/math/triangulation.hpp"
+
+namespace {
+
+using manim_cpp::math::Vec2;
+
+// A simple, non-convex star: vertices alternate between two radii, so every
+// other vertex is reflex and ear clipping has to search for ears.
+std::vector<Vec2> star_polygon(const std::size_t vertex_count) {
+  std::vector<Vec2> polygon;
+  polygon.reserve(vertex_count);
+  for (std::size_t i = 0; i < vertex_count; ++i) {
+    const double angle = 2.0 * std::numbers::pi * static_cast<double>(i) /
+                         static_cast<double>(vertex_count);
+    const double radius = i % 2 == 0 ? 1.0 : 0.6;
+    polygon.push_back({radius * std::cos(angle), radius * std::sin(angle)});
+  }
+  return polygon;
+}
+
+std::vector<Vec2> regular_polygon(const std::size_t vertex_count,
+                                  const double radius,
+                                  const Vec2 center) {
+  std::vector<Vec2> polygon;
+  polygon.reserve(vertex_count);
+  for (std::size_t i = 0; i < vertex_count; ++i) {
+    const double angle = 2.0 * std::numbers::pi * static_cast<double>(i) /
+                         static_cast<double>(vertex_count);
+    polygon.push_back({center[0] + radius * std::cos(angle), center[1] + radius * std::sin(angle)});
+  }
+  return polygon;
+}
+
+// A dense, smooth outline like a traced glyph or SVG path: a circle with a
+// small ripple, so edges are short and every ear test is local.
+std::vector<Vec2> rippled_outline(const std::size_t vertex_count) {
+  std::vector<Vec2> polygon;
+  polygon.reserve(vertex_count);
+  for (std::size_t i = 0; i < vertex_count; ++i) {
+    const double angle = 2.0 * std::numbers::pi * static_cast<double>(i) /
+                         static_cast<double>(vertex_count);
+    const double radius = 1.0 + 0.05 * std::sin(37.0 * angle);
+    polygon.push_back({radius * std::cos(angle), radius * std::sin(angle)});
+  }
+  return polygon;
+}
+
+// Signed distance to a ring of radius 0.35 on an n x n grid over the unit
+// square, so the 0 isocurve crosses about 2.2n cells.
+std::vector<std::vector<double>> ring_field(const std::size_t size) {
+  std::vector<std::vector<double>> field(size, std::vector<double>(size));
+  for (std::size_t y = 0; y < size; ++y) {
+    for (std::size_t x = 0; x < size; ++x) {
+      const double u = static_cast<double>(x) / static_cast<double>(size - 1) - 0.5;
+      const double v = static_cast<double>(y) / static_cast<double>(size - 1) - 0.5;
+      field[y][x] = std::hypot(u, v) - 0.35;
+    }
+  }
+  return field;
+}
+
+void BM_TriangulateEarClipping(benchmark::State& state) {
+  const auto polygon = star_polygon(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::math::triangulate_polygon_ear_clipping(polygon));
+  }
+  state.SetComplexityN(state.range(0));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TriangulateEarClipping)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+void BM_TriangulateTracedOutline(benchmark::State& state) {
+  const auto polygon = rippled_outline(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::math::triangulate_polygon_ear_clipping(polygon));
+  }
+  state.SetComplexityN(state.range(0));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TriangulateTracedOutline)
+    ->RangeMultiplier(4)
+    ->Range(256, 65536)
+    ->Complexity(benchmark::oNLogN);
+
+// A square perforated by an n x n grid of octagonal holes.
+std::vector<std::vector<Vec2>> octagon_grid(const std::size_t size) {
+  std::vector<std::vector<Vec2>> holes;
+  holes.reserve(size * size);
+  for (std::size_t row = 0; row < size; ++row) {
+    for (std::size_t column = 0; column < size; ++column) {
+      holes.push_back(regular_polygon(
+          8, 0.3, {static_cast<double>(column) + 0.5, static_cast<double>(row) + 0.5}));
+    }
+  }
+  return holes;
+}
+
+void BM_TriangulateWithHoles(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto extent = static_cast<double>(size);
+  const std::vector<Vec2> outer = {{0.0, 0.0}, {extent, 0.0}, {extent, extent}, {0.0, extent}};
+  const auto holes = octagon_grid(size);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::math::triangulate_polygon_with_holes(outer, holes));
+  }
+  state.SetComplexityN(state.range(0) * state.range(0));
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_TriangulateWithHoles)->RangeMultiplier(2)->Range(4, 64)->Complexity();
+
+void BM_ExtractIsocurveSegments(benchmark::State& state) {
+  const auto field = ring_field(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::math::extract_isocurve_segments(field, 0.0));
+  }
+  state.SetComplexityN(state.range(0) * state.range(0));
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(BM_ExtractIsocurveSegments)->RangeMultiplier(2)->Range(32, 1024)->Complexity();
+
+void BM_IntersectConvexPolygons(benchmark::State& state) {
+  const auto vertex_count = static_cast<std::size_t>(state.range(0));
+  const auto subject = regular_polygon(vertex_count, 1.0, {0.0, 0.0});
+  const auto clip = regular_polygon(vertex_count, 1.0, {0.5, 0.25});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::math::intersect_convex_polygons(subject, clip));
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_IntersectConvexPolygons)->RangeMultiplier(4)->Range(8, 2048)->Complexity();
+
+// A closed outline of n vertices with a ragged edge, like a region on a map.
+std::vector<Vec2> ragged_outline(const std::size_t vertex_count, const double center_x) {
+  std::vector<Vec2> outline;
+  outline.reserve(vertex_count);
+  for (std::size_t i = 0; i < vertex_count; ++i) {
+    const double angle = 2.0 * std::numbers::pi * static_cast<double>(i) /
+                         static_cast<double>(vertex_count);
+    const double jitter = std::fmod(static_cast<double>(i) * 0.618034, 1.0);
+    const double radius = 1.0 + 0.1 * std::sin(7.0 * angle) + 0.01 * jitter;
+    outline.push_back({center_x + radius * std::cos(angle), radius * std::sin(angle)});
+  }
+  return outline;
+}
+
+// Two overlapping regions of n vertices each.
+void BM_PolygonUnion(benchmark::State& state) {
+  const auto vertex_count = static_cast<std::size_t>(state.range(0));
+  const std::vector<std::vector<Vec2>> subject = {ragged_outline(vertex_count, 0.0)};
+  const std::vector<std::vector<Vec2>> clip = {ragged_outline(vertex_count, 1.0)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::math::polygon_boolean(
+        subject, clip, manim_cpp::math::BooleanOperation::kUnion));
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_PolygonUnion)->RangeMultiplier(4)->Range(64, 65536)->Complexity();
+
+// A simple polygon is the worst case: every pair of edges has to be ruled out.
+void BM_HasSelfIntersections(benchmark::State& state) {
+  const auto polygon = star_polygon(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::math::has_self_intersections(polygon));
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_HasSelfIntersections)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+// A regular polygon with an odd vertex count, traced visiting every second
+// vertex: each edge crosses the two edges next to its neighbours.
+void BM_FindSelfIntersections(benchmark::State& state) {
+  const std::size_t count = static_cast<std::size_t>(state.range(0)) + 1;
+  const auto vertices = regular_polygon(count, 1.0, Vec2{0.0, 0.0});
+  std::vector<Vec2> polygon;
+  polygon.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    polygon.push_back(vertices[(2 * i) % count]);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::math::find_self_intersections(polygon));
+  }
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_FindSelfIntersections)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+}  // namespace
@@ -0,0 +1,123 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "manim_cpp/testing/npz_archive.hpp"
+
+namespace {
+
+constexpr std::size_t kFrameWidth = 320;
+constexpr std::size_t kFrameHeight = 180;
+constexpr std::size_t kChannels = 4;
+constexpr std::size_t kFrameBytes = kFrameWidth * kFrameHeight * kChannels;
+
+// Flat bands with a moving edge, which compress roughly like rendered frames.
+std::vector<std::uint8_t> synthetic_frame(const std::size_t index) {
+  std::vector<std::uint8_t> frame(kFrameBytes);
+  for (std::size_t y = 0; y < kFrameHeight; ++y) {
+    for (std::size_t x = 0; x < kFrameWidth; ++x) {
+      auto* pixel = frame.data() + (y * kFrameWidth + x) * kChannels;
+      const bool inside = x < (index * 7) % kFrameWidth;
+      pixel[0] = static_cast<std::uint8_t>(inside ? 240 : 16);
+      pixel[1] = static_cast<std::uint8_t>(y / 12 * 16);
+      pixel[2] = static_cast<std::uint8_t>(inside ? 64 : 200);
+      pixel[3] = 255;
+    }
+  }
+  return frame;
+}
+
+std::filesystem::path bench_archive_path(const std::string& name) {
+  return std::filesystem::temp_directory_path() / ("manim_cpp_bench_" + name + ".npz");
+}
+
+bool write_frames(const std::filesystem::path& path,
+                  const std::size_t frame_count,
+                  const int compression_level,
+                  const std::vector<std::vector<std::uint8_t>>& frames) {
+  manim_cpp::testing::NpzWriter writer;
+  if (!writer.open(path, {.compression_level = compression_level}) ||
+      !writer.begin_frame_array("frames.npy", kFrameHeight, kFrameWidth, kChannels)) {
+    return false;
+  }
+  for (std::size_t i = 0; i < frame_count; ++i) {
+    if (!writer.append_frame(frames[i % frames.size()])) {
+      return false;
+    }
+  }
+  return writer.close();
+}
+
+std::vector<std::vector<std::uint8_t>> frame_set() {
+  std::vector<std::vector<std::uint8_t>> frames;
+  for (std::size_t i = 0; i < 16; ++i) {
+    frames.push_back(synthetic_frame(i));
+  }
+  return frames;
+}
+
+// range(0): frames; range(1): zlib level, 0 for stored entries.
+void BM_NpzWriteFrameArray(benchmark::State& state) {
+  const auto frames = frame_set();
+  const auto frame_count = static_cast<std::size_t>(state.range(0));
+  const auto path = bench_archive_path("write");
+  for (auto _ : state) {
+    if (!write_frames(path, frame_count, static_cast<int>(state.range(1)), frames)) {
+      state.SkipWithError("NpzWriter failed");
+      break;
+    }
+  }
+  std::error_code error;
+  std::filesystem::remove(path, error);
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<std::int64_t>(kFrameBytes));
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_NpzWriteFrameArray)
+    ->ArgsProduct({{4, 16, 64}, {0, 1}})
+    ->ArgNames({"frames", "level"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Opens the archive and streams the frame array back through NpzEntryReader.
+void BM_NpzReadFrameArray(benchmark::State& state) {
+  const auto frame_count = static_cast<std::size_t>(state.range(0));
+  const auto path = bench_archive_path("read");
+  if (!write_frames(path, frame_count, static_cast<int>(state.range(1)), frame_set())) {
+    state.SkipWithError("NpzWriter failed");
+    return;
+  }
+  std::vector<std::uint8_t> buffer(kFrameBytes);
+  for (auto _ : state) {
+    manim_cpp::testing::NpzArchive archive;
+    const manim_cpp::testing::NpzEntry* entry =
+        archive.open(path) ? archive.find_entry("frames.npy") : nullptr;
+    manim_cpp::testing::NpzEntryReader reader;
+    if (entry == nullptr || !reader.open(archive, *entry)) {
+      state.SkipWithError("NpzEntryReader failed");
+      break;
+    }
+    while (reader.remaining() > 0) {
+      if (reader.read(buffer) == 0) {
+        state.SkipWithError(reader.error().c_str());
+        break;
+      }
+    }
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  std::error_code error;
+  std::filesystem::remove(path, error);
+  state.SetBytesProcessed(state.iterations() * state.range(0) *
+                          static_cast<std::int64_t>(kFrameBytes));
+}
+BENCHMARK(BM_NpzReadFrameArray)
+    ->ArgsProduct({{4, 16, 64}, {0, 1}})
+    ->ArgNames({"frames", "level"})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,144 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "manim_cpp/animation/basic_animations.hpp"
+#include "manim_cpp/animation/composition.hpp"
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/renderer/draw_list.hpp"
+#include "manim_cpp/renderer/mesh_cache.hpp"
+#include "manim_cpp/scene/scene.hpp"
+#include "manim_cpp/scene/scene_file_writer.hpp"
+
+namespace {
+
+class BenchmarkScene : public manim_cpp::scene::Scene {
+ public:
+  void construct() override {}
+};
+
+// One play() of a lagged start over per-mobject successions of a shift and a
+// fade, in parallel with a move of every mobject.
+void BM_ScenePlayComposedAnimations(benchmark::State& state) {
+  using manim_cpp::animation::Animation;
+  const auto mobject_count = static_cast<std::size_t>(state.range(0));
+  constexpr std::size_t kSteps = 60;
+  for (auto _ : state) {
+    state.PauseTiming();
+    BenchmarkScene scene;
+    std::vector<std::unique_ptr<Animation>> parts;
+    const auto keep = [&parts](std::unique_ptr<Animation> animation) {
+      return parts.emplace_back(std::move(animation)).get();
+    };
+    std::vector<Animation*> successions;
+    std::vector<Animation*> moves;
+    for (std::size_t i = 0; i < mobject_count; ++i) {
+      auto circle = std::make_shared<manim_cpp::mobject::Circle>(0.5);
+      scene.add(circle);
+      Animation* shift = keep(std::make_unique<manim_cpp::animation::ShiftAnimation>(
+          circle, manim_cpp::math::Vec3{1.0, 0.5, 0.0}));
+      Animation* fade =
+          keep(std::make_unique<manim_cpp::animation::FadeToOpacityAnimation>(circle, 0.25));
+      successions.push_back(keep(std::make_unique<manim_cpp::animation::SuccessionAnimation>(
+          std::vector<Animation*>{shift, fade})));
+      moves.push_back(keep(std::make_unique<manim_cpp::animation::MoveToAnimation>(
+          circle, manim_cpp::math::Vec3{-1.0, 0.0, 0.0})));
+    }
+    manim_cpp::animation::LaggedStartAnimation lagged(successions, 0.1);
+    manim_cpp::animation::ParallelAnimation all_moves(moves);
+    manim_cpp::animation::ParallelAnimation all({&lagged, &all_moves});
+    state.ResumeTiming();
+
+    scene.play(all, kSteps);
+    benchmark::DoNotOptimize(scene.time_seconds());
+  }
+  state.SetComplexityN(state.range(0));
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(kSteps + 1));
+}
+BENCHMARK(BM_ScenePlayComposedAnimations)
+    ->RangeMultiplier(4)
+    ->Range(1, 256)
+    ->Unit(benchmark::kMicrosecond)
+    ->Complexity();
+
+// One frame's draw list for n circles, sectors and hexagons of a few sizes at
+// different positions, as a scene mid-animation would build it. With the mesh
+// cache disabled (second argument 0) every shape is tessellated again.
+void BM_BuildDrawList(benchmark::State& state) {
+  const auto mobject_count = static_cast<std::size_t>(state.range(0));
+  const bool cached = state.range(1) != 0;
+  std::vector<std::shared_ptr<manim_cpp::mobject::Mobject>> mobjects;
+  for (std::size_t i = 0; i < mobject_count; ++i) {
+    const double size = 0.25 * static_cast<double>(1 + i % 4);
+    std::shared_ptr<manim_cpp::mobject::Mobject> mobject;
+    switch (i % 3) {
+      case 0:
+        mobject = std::make_shared<manim_cpp::mobject::Circle>(size);
+        break;
+      case 1:
+        mobject = std::make_shared<manim_cpp::mobject::Sector>(0.5 * size, size);
+        break;
+      default:
+        mobject = std::make_shared<manim_cpp::mobject::RegularPolygon>(6, size);
+        break;
+    }
+    mobject->move_to({0.01 * static_cast<double>(i), -0.02 * static_cast<double>(i), 0.0});
+    mobjects.push_back(std::move(mobject));
+  }
+
+  auto& cache = manim_cpp::renderer::MeshCache::global();
+  const auto max_entries = cache.max_entries();
+  cache.clear();
+  cache.set_max_entries(cached ? max_entries : 0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(manim_cpp::renderer::build_draw_list(mobjects));
+  }
+  state.counters["mesh_cache_hit_rate"] = cache.stats().hit_rate();
+  cache.set_max_entries(max_entries);
+  state.SetComplexityN(state.range(0));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BuildDrawList)
+    ->ArgsProduct({benchmark::CreateRange(16, 1024, 8), {0, 1}})
+    ->Unit(benchmark::kMicrosecond);
+
+void BM_WriteMediaManifest(benchmark::State& state) {
+  const auto section_count = static_cast<std::size_t>(state.range(0));
+  manim_cpp::scene::SceneFileWriter writer("BenchmarkScene");
+  for (std::size_t section = 0; section < section_count; ++section) {
+    writer.begin_section("section_" + std::to_string(section), false);
+    writer.set_section_timeline(static_cast<double>(section), static_cast<double>(section) + 1.0);
+    for (std::size_t movie = 0; movie < 8; ++movie) {
+      writer.add_partial_movie_file("partial_movies/" + std::to_string(section) + "_" +
+                                    std::to_string(movie) + ".mp4");
+    }
+    writer.add_subcaption("caption " + std::to_string(section), static_cast<double>(section),
+                          static_cast<double>(section) + 0.5);
+  }
+  writer.set_render_summary(section_count * 60, 1920, 1080, 60.0, "mp4",
+                            std::filesystem::path("BenchmarkScene.mp4"));
+
+  const auto manifest_path =
+      std::filesystem::temp_directory_path() / "manim_cpp_bench_manifest.json";
+  for (auto _ : state) {
+    if (!writer.write_media_manifest(manifest_path)) {
+      state.SkipWithError("write_media_manifest failed");
+      break;
+    }
+  }
+  std::error_code error;
+  const auto manifest_size = std::filesystem::file_size(manifest_path, error);
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(error ? 0 : manifest_size));
+  std::filesystem::remove(manifest_path, error);
+  state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_WriteMediaManifest)->RangeMultiplier(8)->Range(1, 4096)->Complexity();
+
+}  // namespace
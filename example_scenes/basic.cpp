@@ -105,9 +105,11 @@ class UpdatersExample : public Scene {
     auto dot = std::make_shared<Dot>(0.08);
     add(dot);
 
-    add_updater([dot](const double delta_seconds) {
-      dot->shift(Vec3{delta_seconds, 0.5 * delta_seconds, 0.0});
-    });
+    add_updater(
+        [dot](const double delta_seconds) {
+          dot->shift(Vec3{delta_seconds, 0.5 * delta_seconds, 0.0});
+        },
+        "drift_up_right");
 
     FadeToOpacityAnimation hold(dot, dot->opacity());
     hold.set_run_time_seconds(1.0);
@@ -1,6 +1,11 @@
 #pragma once
 
 #include <functional>
+#include <string>
+
+namespace manim_cpp::renderer {
+class FrameHasher;
+}  // namespace manim_cpp::renderer
 
 namespace manim_cpp::animation {
 
@@ -9,6 +14,7 @@ using RateFunction = std::function<double(double)>;
 class Animation {
  public:
   virtual ~Animation() = default;
+  [[nodiscard]] virtual std::string debug_name() const { return "Animation"; }
   virtual void begin() {}
   virtual void interpolate(double /*alpha*/) {}
   virtual void finish() {}
@@ -16,13 +22,27 @@ class Animation {
   void set_run_time_seconds(double seconds);
   [[nodiscard]] double run_time_seconds() const;
 
-  void set_rate_function(RateFunction function);
+  // A named rate function is identified by its name in segment hashes, so two
+  // curves must never share a name. Unnamed ones are hashed from dense samples.
+  void set_rate_function(RateFunction function, std::string name = "");
+  [[nodiscard]] const std::string& rate_function_name() const;
   [[nodiscard]] double apply_rate_function(double alpha) const;
   void interpolate_with_rate(double alpha);
 
+  // Whether hash_parameters() covers everything this animation renders, so a
+  // cached segment may stand in for playing it. False unless a subclass that
+  // hashes all of its parameters opts in.
+  [[nodiscard]] virtual bool cacheable() const { return false; }
+  // Feeds everything that determines the rendered output of this animation
+  // (besides the scene's starting state) into the hasher. The base version
+  // covers debug_name(), run time and rate function; subclasses that return
+  // true from cacheable() extend it with their own parameters.
+  virtual void hash_parameters(renderer::FrameHasher* hasher) const;
+
  private:
   double run_time_seconds_ = 1.0;
   RateFunction rate_function_ = [](double alpha) { return alpha; };
+  std::string rate_function_name_ = "linear";
 };
 
 }  // namespace manim_cpp::animation
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "manim_cpp/animation/animation.hpp"
 #include "manim_cpp/math/core.hpp"
@@ -18,8 +19,11 @@ class MoveToAnimation : public Animation {
   [[nodiscard]] std::shared_ptr<mobject::Mobject> target() const;
   [[nodiscard]] const math::Vec3& destination() const;
 
+  [[nodiscard]] std::string debug_name() const override { return "MoveTo"; }
   void begin() override;
   void interpolate(double alpha) override;
+  [[nodiscard]] bool cacheable() const override { return true; }
+  void hash_parameters(renderer::FrameHasher* hasher) const override;
 
  private:
   std::shared_ptr<mobject::Mobject> target_;
@@ -34,8 +38,11 @@ class ShiftAnimation : public Animation {
   [[nodiscard]] std::shared_ptr<mobject::Mobject> target() const;
   [[nodiscard]] const math::Vec3& delta() const;
 
+  [[nodiscard]] std::string debug_name() const override { return "Shift"; }
   void begin() override;
   void interpolate(double alpha) override;
+  [[nodiscard]] bool cacheable() const override { return true; }
+  void hash_parameters(renderer::FrameHasher* hasher) const override;
 
  private:
   std::shared_ptr<mobject::Mobject> target_;
@@ -50,8 +57,11 @@ class FadeToOpacityAnimation : public Animation {
   [[nodiscard]] std::shared_ptr<mobject::Mobject> target() const;
   [[nodiscard]] double target_opacity() const;
 
+  [[nodiscard]] std::string debug_name() const override { return "FadeToOpacity"; }
   void begin() override;
   void interpolate(double alpha) override;
+  [[nodiscard]] bool cacheable() const override { return true; }
+  void hash_parameters(renderer::FrameHasher* hasher) const override;
 
  private:
   std::shared_ptr<mobject::Mobject> target_;
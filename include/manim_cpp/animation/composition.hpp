@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <string>
 #include <vector>
 
 #include "manim_cpp/animation/animation.hpp"
@@ -11,9 +12,12 @@ class ParallelAnimation : public Animation {
  public:
   explicit ParallelAnimation(std::vector<Animation*> animations);
 
+  [[nodiscard]] std::string debug_name() const override { return "Parallel"; }
   void begin() override;
   void interpolate(double alpha) override;
   void finish() override;
+  [[nodiscard]] bool cacheable() const override;
+  void hash_parameters(renderer::FrameHasher* hasher) const override;
 
  private:
   std::vector<Animation*> animations_;
@@ -23,9 +27,12 @@ class SuccessionAnimation : public Animation {
  public:
   explicit SuccessionAnimation(std::vector<Animation*> animations);
 
+  [[nodiscard]] std::string debug_name() const override { return "Succession"; }
   void begin() override;
   void interpolate(double alpha) override;
   void finish() override;
+  [[nodiscard]] bool cacheable() const override;
+  void hash_parameters(renderer::FrameHasher* hasher) const override;
 
  private:
   std::vector<Animation*> animations_;
@@ -38,9 +45,12 @@ class LaggedStartAnimation : public Animation {
  public:
   LaggedStartAnimation(std::vector<Animation*> animations, double lag_ratio = 0.0);
 
+  [[nodiscard]] std::string debug_name() const override { return "LaggedStart"; }
   void begin() override;
   void interpolate(double alpha) override;
   void finish() override;
+  [[nodiscard]] bool cacheable() const override;
+  void hash_parameters(renderer::FrameHasher* hasher) const override;
 
  private:
   std::vector<Animation*> animations_;
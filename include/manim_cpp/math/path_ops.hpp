@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
 #include "manim_cpp/math/core.hpp"
@@ -10,8 +11,26 @@ bool segments_intersect(const Vec2& a0, const Vec2& a1, const Vec2& b0, const Ve
 
 bool point_in_polygon(const std::vector<Vec2>& polygon, const Vec2& point);
 
+// Whether two non-adjacent edges of the closed polygon cross, touch or
+// overlap (as decided by segments_intersect()). Sweeps the edges in
+// O(n log n) and stops at the first intersection.
 bool has_self_intersections(const std::vector<Vec2>& polygon);
 
+struct PathIntersection {
+  // Edge i runs from polygon[i] to polygon[(i + 1) % polygon.size()].
+  size_t first_edge = 0;
+  size_t second_edge = 0;
+  // Where the edges cross; for edges that touch or overlap, a vertex of one
+  // lying on the other.
+  Vec2 point{};
+};
+
+// Every pair of non-adjacent edges that has_self_intersections() would count,
+// first_edge < second_edge, ordered by edge indices. O((n + k) log n) for k
+// pairs. Vertices that coincide only up to rounding can hide a pair that
+// touches there; has_self_intersections() still reports such polygons.
+std::vector<PathIntersection> find_self_intersections(const std::vector<Vec2>& polygon);
+
 double polygon_signed_area(const std::vector<Vec2>& polygon);
 double polygon_area(const std::vector<Vec2>& polygon);
 
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "manim_cpp/math/core.hpp"
+
+namespace manim_cpp::math {
+
+enum class BooleanOperation : uint8_t { kUnion, kIntersection, kDifference, kXor };
+
+// Combines two regions, each given as closed rings under the even-odd rule:
+// a ring inside another is a hole, and rings may use either winding, touch,
+// overlap or cross themselves. kDifference removes `clip` from `subject`.
+// Returns the rings bounding the result, outer boundaries counter-clockwise
+// and holes clockwise, so the result fills the same under the even-odd and
+// the nonzero rule. Output rings do not cross each other, but may touch at
+// vertices; they never hold collinear runs of vertices.
+//
+// Martinez-Rueda sweep: one pass over the edges of both regions splits them
+// where they meet and keeps the pieces on the result's boundary, in
+// O((n + k) log n) for n edges and k intersections.
+std::vector<std::vector<Vec2>> polygon_boolean(const std::vector<std::vector<Vec2>>& subject,
+                                               const std::vector<std::vector<Vec2>>& clip,
+                                               BooleanOperation operation);
+
+}  // namespace manim_cpp::math
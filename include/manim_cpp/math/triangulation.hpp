@@ -7,6 +7,22 @@
 
 namespace manim_cpp::math {
 
+// Triangulates a simple polygon given in either winding. Returns indices into
+// `polygon`, three per triangle, each triangle wound like the polygon; n - 2
+// triangles unless duplicate or collinear vertices were dropped. Runs in about
+// O(n log n) (linked vertex ring plus a z-order index for ear tests). Input
+// that is not simple, such as a self-intersecting outline, still gets a
+// triangulation covering it; only fewer than 3 points give an empty result.
 std::vector<uint32_t> triangulate_polygon_ear_clipping(const std::vector<Vec2>& polygon);
 
+// Triangulates the region inside `outer` and outside every ring of `holes`,
+// such as an annulus or a glyph with counters, into one index buffer. Rings
+// may use either winding; holes should lie inside `outer` and not overlap.
+// Indices refer to the rings concatenated in order, outer first, and each
+// triangle is wound like `outer`. Every hole is bridged into the outer ring
+// before ear clipping, so this has the cost of a single polygon with
+// 2 * holes.size() extra vertices.
+std::vector<uint32_t> triangulate_polygon_with_holes(const std::vector<Vec2>& outer,
+                                                     const std::vector<std::vector<Vec2>>& holes);
+
 }  // namespace manim_cpp::math
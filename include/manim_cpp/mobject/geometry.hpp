@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 #include "manim_cpp/math/core.hpp"
@@ -16,6 +17,11 @@ class Dot : public Mobject {
   [[nodiscard]] double radius() const;
   void set_radius(double radius);
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Dot>(*this);
+  }
+
  private:
   double radius_ = 0.08;
 };
@@ -29,6 +35,11 @@ class Circle : public Mobject {
   void set_radius(double radius);
   [[nodiscard]] math::Vec3 point_at_angle(double angle_radians) const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Circle>(*this);
+  }
+
  private:
   double radius_ = 1.0;
 };
@@ -44,6 +55,11 @@ class Ellipse : public Mobject {
   void set_height(double height);
   [[nodiscard]] math::Vec3 point_at_angle(double angle_radians) const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Ellipse>(*this);
+  }
+
  private:
   double width_ = 4.0;
   double height_ = 2.0;
@@ -63,6 +79,11 @@ class Arc : public Mobject {
   [[nodiscard]] math::Vec3 start_point() const;
   [[nodiscard]] math::Vec3 end_point() const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Arc>(*this);
+  }
+
  private:
   double radius_ = 1.0;
   double start_angle_ = 0.0;
@@ -80,6 +101,11 @@ class Annulus : public Mobject {
   [[nodiscard]] math::Vec3 inner_point_at_angle(double angle_radians) const;
   [[nodiscard]] math::Vec3 outer_point_at_angle(double angle_radians) const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Annulus>(*this);
+  }
+
  private:
   double inner_radius_ = 1.0;
   double outer_radius_ = 2.0;
@@ -104,6 +130,11 @@ class Sector : public Mobject {
   [[nodiscard]] math::Vec3 outer_start_point() const;
   [[nodiscard]] math::Vec3 outer_end_point() const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Sector>(*this);
+  }
+
  private:
   [[nodiscard]] math::Vec3 point_on_radius(double radius, double theta) const;
 
@@ -122,6 +153,11 @@ class Square : public Mobject {
   void set_side_length(double side_length);
   [[nodiscard]] std::vector<math::Vec3> vertices() const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Square>(*this);
+  }
+
  private:
   double side_length_ = 2.0;
 };
@@ -137,6 +173,11 @@ class Rectangle : public Mobject {
   void set_height(double height);
   [[nodiscard]] std::vector<math::Vec3> vertices() const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Rectangle>(*this);
+  }
+
  private:
   double width_ = 4.0;
   double height_ = 2.0;
@@ -151,6 +192,11 @@ class Triangle : public Mobject {
   void set_side_length(double side_length);
   [[nodiscard]] std::vector<math::Vec3> vertices() const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Triangle>(*this);
+  }
+
  private:
   double side_length_ = 2.0;
 };
@@ -166,6 +212,11 @@ class RegularPolygon : public Mobject {
   void set_radius(double radius);
   [[nodiscard]] std::vector<math::Vec3> vertices() const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<RegularPolygon>(*this);
+  }
+
  private:
   std::size_t n_sides_ = 6;
   double radius_ = 1.0;
@@ -183,6 +234,11 @@ class Line : public Mobject {
   [[nodiscard]] double length() const;
   void set_points(const math::Vec3& start, const math::Vec3& end);
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Line>(*this);
+  }
+
  private:
   math::Vec3 unit_vector_{1.0, 0.0, 0.0};
   double length_ = 1.0;
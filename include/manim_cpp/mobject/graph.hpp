@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -27,6 +28,11 @@ class Graph : public Mobject {
   [[nodiscard]] const std::unordered_map<std::string, math::Vec3>&
   vertex_positions() const;
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<Graph>(*this);
+  }
+
  private:
   std::vector<std::string> vertices_;
   std::vector<GraphEdge> edges_;
@@ -25,6 +25,14 @@ class Mobject {
   void set_opacity(double opacity);
   [[nodiscard]] double opacity() const;
 
+  // Deep copy: this mobject and, recursively, its submobjects.
+  [[nodiscard]] std::shared_ptr<Mobject> copy() const;
+
+ protected:
+  // This mobject alone, still sharing its submobjects. Subclasses with state
+  // of their own override it, or copy() slices them.
+  [[nodiscard]] virtual std::shared_ptr<Mobject> clone() const;
+
  private:
   std::vector<std::shared_ptr<Mobject>> submobjects_;
   math::Vec3 center_{0.0, 0.0, 0.0};
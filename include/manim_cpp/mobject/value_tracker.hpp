@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "manim_cpp/mobject/mobject.hpp"
@@ -15,6 +16,11 @@ class ValueTracker : public Mobject {
   void set_value(double value);
   void increment_value(double delta);
 
+ protected:
+  [[nodiscard]] std::shared_ptr<Mobject> clone() const override {
+    return std::make_shared<ValueTracker>(*this);
+  }
+
  private:
   double value_ = 0.0;
 };
@@ -1,25 +1,52 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 #include <string>
-#include <unordered_set>
+#include <vector>
 
+#include "manim_cpp/mobject/mobject.hpp"
+#include "manim_cpp/renderer/frame_cache.hpp"
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/rasterizer.hpp"
 #include "manim_cpp/renderer/renderer.hpp"
 
 namespace manim_cpp::renderer {
 
 class CairoRenderer final : public Renderer {
  public:
+  // `worker_count` rasterizer threads; 0 picks default_worker_count().
+  explicit CairoRenderer(std::size_t worker_count = 0) : rasterizer_(worker_count) {}
+
   RendererType type() const override { return RendererType::kCairo; }
   std::string name() const override { return "cairo"; }
 
   std::string frame_file_name(const std::string& scene_name,
                               std::size_t frame_index) const;
   bool should_render_for_signature(const std::string& frame_signature);
+  bool should_render_for_hash(const FrameHash& frame_hash);
   void reset_frame_cache();
+  void set_frame_cache_max_bytes(std::size_t max_bytes);
+  [[nodiscard]] const FrameCache& frame_cache() const { return frame_cache_; }
+
+  // Rasterizes the mobjects unless an identical draw state is cached, in which
+  // case the cached pixels are copied. Returns the draw-state hash.
+  FrameHash render_frame(const std::vector<std::shared_ptr<mobject::Mobject>>& mobjects,
+                         const RasterSettings& settings,
+                         FrameBuffer* output);
+  FrameHash render_frame(const DrawList& draw_list,
+                         const RasterSettings& settings,
+                         FrameBuffer* output);
+  // As above with the draw list's hash_draw_state() already known; the
+  // returned frame is shared with the cache rather than copied.
+  SharedFrame render_frame(const DrawList& draw_list,
+                           const RasterSettings& settings,
+                           const FrameHash& frame_hash);
+  [[nodiscard]] std::size_t worker_count() const { return rasterizer_.worker_count(); }
 
  private:
-  std::unordered_set<std::string> seen_frame_signatures_;
+  FrameCache frame_cache_;
+  TileRasterizer rasterizer_;
 };
 
 }  // namespace manim_cpp::renderer
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "manim_cpp/math/core.hpp"
+#include "manim_cpp/renderer/frame_buffer.hpp"
+
+namespace manim_cpp::mobject {
+class Mobject;
+}  // namespace manim_cpp::mobject
+
+namespace manim_cpp::renderer {
+
+enum class FillRule {
+  kNonZero,
+  kEvenOdd,
+};
+
+struct DrawCommand {
+  std::vector<std::vector<math::Vec2>> rings;
+  FillRule fill_rule = FillRule::kNonZero;
+  Rgba8 color{255, 255, 255, 255};
+  double opacity = 1.0;
+};
+
+using DrawList = std::vector<DrawCommand>;
+
+inline constexpr std::size_t kCurveSegments = 96;
+inline constexpr double kDefaultStrokeWidth = 0.04;
+
+// Flattens mobjects (and their submobjects, parents first) into filled rings
+// in scene units. Mobjects without drawable geometry contribute nothing.
+DrawList build_draw_list(const std::vector<std::shared_ptr<mobject::Mobject>>& mobjects);
+void append_draw_commands(const mobject::Mobject& mobject, DrawList* output);
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace manim_cpp::renderer {
+
+struct Rgba8 {
+  std::uint8_t r = 0;
+  std::uint8_t g = 0;
+  std::uint8_t b = 0;
+  std::uint8_t a = 255;
+
+  friend bool operator==(const Rgba8&, const Rgba8&) = default;
+};
+
+class FrameBuffer {
+ public:
+  static constexpr std::size_t kChannels = 4;
+
+  FrameBuffer() = default;
+  FrameBuffer(std::size_t width, std::size_t height);
+
+  void resize(std::size_t width, std::size_t height);
+  void clear(Rgba8 color);
+
+  [[nodiscard]] std::size_t width() const { return width_; }
+  [[nodiscard]] std::size_t height() const { return height_; }
+  [[nodiscard]] std::size_t stride_bytes() const { return width_ * kChannels; }
+  [[nodiscard]] std::size_t byte_size() const { return pixels_.size(); }
+  [[nodiscard]] bool empty() const { return pixels_.empty(); }
+
+  [[nodiscard]] std::uint8_t* data() { return pixels_.data(); }
+  [[nodiscard]] const std::uint8_t* data() const { return pixels_.data(); }
+  [[nodiscard]] std::uint8_t* row(std::size_t y) { return pixels_.data() + y * stride_bytes(); }
+  [[nodiscard]] const std::uint8_t* row(std::size_t y) const {
+    return pixels_.data() + y * stride_bytes();
+  }
+  [[nodiscard]] Rgba8 pixel(std::size_t x, std::size_t y) const;
+
+ private:
+  std::size_t width_ = 0;
+  std::size_t height_ = 0;
+  std::vector<std::uint8_t> pixels_;
+};
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "manim_cpp/renderer/draw_list.hpp"
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/hash.hpp"
+#include "manim_cpp/renderer/rasterizer.hpp"
+
+namespace manim_cpp::renderer {
+
+FrameHash hash_draw_state(const DrawList& draw_list, const RasterSettings& settings);
+FrameHash hash_frame_signature(std::string_view frame_signature);
+
+inline constexpr std::size_t kDefaultFrameCacheMaxBytes = 256ULL * 1024ULL * 1024ULL;
+
+// Rendered frames are immutable once cached, so hits share them instead of
+// copying pixels.
+using SharedFrame = std::shared_ptr<const FrameBuffer>;
+
+// Least-recently-used map from draw-state hash to rendered frame. Every entry
+// is charged kEntryOverheadBytes on top of its pixels, so signature-only
+// entries (null frames) are bounded too.
+class FrameCache {
+ public:
+  static constexpr std::size_t kEntryOverheadBytes = 64;
+
+  explicit FrameCache(std::size_t max_bytes = kDefaultFrameCacheMaxBytes);
+
+  [[nodiscard]] std::size_t max_bytes() const { return max_bytes_; }
+  void set_max_bytes(std::size_t max_bytes);
+  [[nodiscard]] std::size_t used_bytes() const { return used_bytes_; }
+  [[nodiscard]] std::size_t size() const { return entries_.size(); }
+
+  [[nodiscard]] bool contains(const FrameHash& hash) const;
+  // Returns the cached frame and marks it most recently used, or nullptr. A
+  // signature-only entry has no pixels and counts as a miss.
+  SharedFrame find(const FrameHash& hash);
+  // Returns true (a hit) when the hash is cached, with or without pixels;
+  // otherwise records it as a signature-only entry.
+  bool remember(const FrameHash& hash);
+  // Stores the frame unless it alone exceeds max_bytes(), in which case an
+  // older entry for the hash is dropped; evicts as needed.
+  bool insert(const FrameHash& hash, SharedFrame frame);
+  void clear();
+
+  [[nodiscard]] std::size_t hits() const { return hits_; }
+  [[nodiscard]] std::size_t misses() const { return misses_; }
+  [[nodiscard]] std::size_t evictions() const { return evictions_; }
+
+ private:
+  struct Entry {
+    FrameHash hash;
+    SharedFrame frame;
+  };
+
+  static std::size_t charge(const SharedFrame& frame);
+  void erase(const FrameHash& hash);
+  void evict_to(std::size_t max_bytes);
+
+  std::size_t max_bytes_ = kDefaultFrameCacheMaxBytes;
+  std::size_t used_bytes_ = 0;
+  std::list<Entry> entries_;
+  std::unordered_map<FrameHash, std::list<Entry>::iterator, FrameHashHasher> index_;
+  std::size_t hits_ = 0;
+  std::size_t misses_ = 0;
+  std::size_t evictions_ = 0;
+};
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+
+namespace manim_cpp::renderer {
+
+struct FrameHash {
+  std::uint64_t high = 0;
+  std::uint64_t low = 0;
+
+  [[nodiscard]] std::string to_hex() const;
+  friend bool operator==(const FrameHash&, const FrameHash&) = default;
+};
+
+struct FrameHashHasher {
+  std::size_t operator()(const FrameHash& hash) const {
+    return static_cast<std::size_t>(hash.low ^ (hash.high * 0x9E3779B97F4A7C15ULL));
+  }
+};
+
+// XXH3 from xxHash 0.8, bit-for-bit: hash64() is XXH3_64bits_withSeed and
+// hash128() is XXH3_128bits_withSeed, so values can be checked against
+// `xxhsum -H3`. Inputs over 240 bytes go through the stripe loop, which runs
+// on AVX2 when the CPU has it (runtime detection on x86-64).
+std::uint64_t hash64(std::span<const std::uint8_t> bytes, std::uint64_t seed = 0);
+FrameHash hash128(std::span<const std::uint8_t> bytes, std::uint64_t seed = 0);
+FrameHash hash128_scalar(std::span<const std::uint8_t> bytes, std::uint64_t seed = 0);
+
+// The frame's width and height followed by its pixels, so equal pixel data
+// in a different shape hashes differently.
+FrameHash hash_frame_buffer(const FrameBuffer& frame);
+
+// hash128() of a whole file, streamed through FrameHasher in fixed-size
+// chunks; nullopt if the file cannot be read.
+std::optional<FrameHash> hash_file(const std::filesystem::path& path);
+
+// "avx2" or "scalar": the stripe loop hash128() and FrameHasher use on this CPU.
+const char* hash_kernel_name();
+
+// Streaming hash128() with seed 0: finish() equals hash128() of every byte
+// passed to update() so far, however the input was split. Doubles are hashed
+// by bit pattern (with -0.0 folded into 0.0), so identical geometry always
+// maps to the same key.
+class FrameHasher {
+ public:
+  FrameHasher();
+
+  void update(const void* data, std::size_t size);
+  // Length-prefixed, so consecutive strings cannot run into each other.
+  void update(std::string_view text);
+  void update_u64(std::uint64_t value);
+  void update_double(double value);
+  [[nodiscard]] FrameHash finish() const;
+
+ private:
+  static constexpr std::size_t kBufferSize = 256;
+
+  std::array<std::uint64_t, 8> accumulators_{};
+  std::array<std::uint8_t, kBufferSize> buffer_{};
+  std::size_t buffered_size_ = 0;
+  // Stripes accumulated since the last scramble.
+  std::size_t block_stripes_ = 0;
+  std::uint64_t total_size_ = 0;
+};
+
+}  // namespace manim_cpp::renderer
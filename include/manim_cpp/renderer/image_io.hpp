@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+
+namespace manim_cpp::renderer {
+
+// Single-threaded PngEncoder with default settings; byte-identical to the
+// parallel encoder.
+std::vector<std::uint8_t> encode_png(const FrameBuffer& frame);
+bool write_png(const std::filesystem::path& output_path, const FrameBuffer& frame);
+
+}  // namespace manim_cpp::renderer
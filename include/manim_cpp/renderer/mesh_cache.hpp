@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "manim_cpp/math/core.hpp"
+
+namespace manim_cpp::renderer {
+
+enum class MeshShape : std::uint8_t {
+  // parameters: radius_x, radius_y.
+  kEllipse,
+  // parameters: inner_radius, outer_radius, start_angle, angle.
+  kAnnularSector,
+  // parameters: inner_radius, outer_radius.
+  kAnnulus,
+  // parameters: radius. segments is the number of sides.
+  kRegularPolygon,
+};
+
+// What a tessellation depends on: the shape's intrinsic parameters and its
+// level of detail. Position and opacity are applied per instance, so every
+// Circle of the same radius shares one mesh however it moves or fades.
+struct MeshKey {
+  MeshShape shape = MeshShape::kEllipse;
+  std::array<double, 4> parameters{};
+  std::size_t segments = 0;
+
+  friend bool operator==(const MeshKey&, const MeshKey&) = default;
+};
+
+struct MeshKeyHasher {
+  std::size_t operator()(const MeshKey& key) const;
+};
+
+// A tessellated shape centred on its own origin. The rings are what the
+// rasterizer fills; indices() triangulates them for consumers that need
+// triangles, once, on first use.
+class Mesh {
+ public:
+  explicit Mesh(std::vector<std::vector<math::Vec2>> rings);
+
+  [[nodiscard]] const std::vector<std::vector<math::Vec2>>& rings() const { return rings_; }
+  // Triangles over the rings concatenated in order, the first ring outer and
+  // the rest holes (triangulate_polygon_with_holes()). Thread-safe.
+  [[nodiscard]] const std::vector<uint32_t>& indices() const;
+
+ private:
+  std::vector<std::vector<math::Vec2>> rings_;
+  mutable std::once_flag indices_once_;
+  mutable std::vector<uint32_t> indices_;
+};
+
+struct MeshCacheStats {
+  std::size_t hits = 0;
+  std::size_t misses = 0;
+  std::size_t evictions = 0;
+  std::size_t entries = 0;
+
+  // hits / (hits + misses); 0 before the first lookup.
+  [[nodiscard]] double hit_rate() const;
+};
+
+inline constexpr std::size_t kDefaultMeshCacheMaxEntries = 4096;
+
+// Least-recently-used map from MeshKey to mesh, safe to share between
+// threads. Meshes are handed out as shared pointers, so an evicted mesh
+// stays valid for whoever still holds it.
+class MeshCache {
+ public:
+  explicit MeshCache(std::size_t max_entries = kDefaultMeshCacheMaxEntries);
+
+  // The process-wide cache build_draw_list() tessellates through.
+  static MeshCache& global();
+
+  // Returns the cached mesh for `key`, or stores and returns one made of the
+  // rings `tessellate` returns. The lock is not held while `tessellate` runs,
+  // so two threads missing on the same key may both tessellate it; the first
+  // mesh stored is kept.
+  std::shared_ptr<const Mesh> find_or_build(
+      const MeshKey& key, const std::function<std::vector<std::vector<math::Vec2>>()>& tessellate);
+
+  [[nodiscard]] std::size_t max_entries() const;
+  void set_max_entries(std::size_t max_entries);
+  [[nodiscard]] MeshCacheStats stats() const;
+  // Drops every mesh and zeroes the counters.
+  void clear();
+
+ private:
+  struct Entry {
+    MeshKey key;
+    std::shared_ptr<const Mesh> mesh;
+  };
+
+  void evict_to(std::size_t max_entries);
+
+  mutable std::mutex mutex_;
+  std::size_t max_entries_ = kDefaultMeshCacheMaxEntries;
+  std::list<Entry> entries_;
+  std::unordered_map<MeshKey, std::list<Entry>::iterator, MeshKeyHasher> index_;
+  std::size_t hits_ = 0;
+  std::size_t misses_ = 0;
+  std::size_t evictions_ = 0;
+};
+
+}  // namespace manim_cpp::renderer
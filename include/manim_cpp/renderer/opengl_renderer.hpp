@@ -3,8 +3,8 @@
 #include <cstddef>
 #include <filesystem>
 #include <string>
-#include <unordered_set>
 
+#include "manim_cpp/renderer/frame_cache.hpp"
 #include "manim_cpp/renderer/renderer.hpp"
 
 namespace manim_cpp::renderer {
@@ -23,11 +23,14 @@ class OpenGLRenderer final : public Renderer {
   std::string frame_file_name(const std::string& scene_name,
                               std::size_t frame_index) const;
   bool should_render_for_signature(const std::string& frame_signature);
+  bool should_render_for_hash(const FrameHash& frame_hash);
   void reset_frame_cache();
+  void set_frame_cache_max_bytes(std::size_t max_bytes);
+  [[nodiscard]] const FrameCache& frame_cache() const { return frame_cache_; }
 
  private:
   std::filesystem::path shader_root_;
-  std::unordered_set<std::string> seen_frame_signatures_;
+  FrameCache frame_cache_;
 };
 
 }  // namespace manim_cpp::renderer
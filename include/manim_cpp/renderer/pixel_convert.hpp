@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace manim_cpp::renderer {
+
+// Packs `pixel_count` RGBA8 pixels into RGB8 by dropping alpha. The SIMD
+// paths (SSSE3 byte shuffles on x86-64 with runtime detection, NEON
+// de-interleaving loads on AArch64) match the scalar reference exactly.
+void rgba_to_rgb(const std::uint8_t* rgba, std::size_t pixel_count, std::uint8_t* rgb);
+void rgba_to_rgb_scalar(const std::uint8_t* rgba, std::size_t pixel_count, std::uint8_t* rgb);
+
+// Expands RGB8 to RGBA8 with opaque alpha.
+void rgb_to_rgba(const std::uint8_t* rgb, std::size_t pixel_count, std::uint8_t* rgba);
+
+// "ssse3", "neon" or "scalar": the path rgba_to_rgb() takes on this CPU.
+const char* pixel_converter_name();
+
+}  // namespace manim_cpp::renderer
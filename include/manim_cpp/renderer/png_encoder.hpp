@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/thread_pool.hpp"
+
+namespace manim_cpp::renderer {
+
+struct PngEncodeSettings {
+  // zlib level, 0-9.
+  int compression_level = 6;
+  // Picks the PNG filter per row by minimum sum of absolute differences;
+  // false writes every row unfiltered.
+  bool adaptive_filters = true;
+  // Filtered image bytes per independently deflated block (pigz uses 128K).
+  // Output bytes depend on this, not on worker_count.
+  std::size_t chunk_bytes = 128 * 1024;
+  // Threads used for filtering and deflate; 0 picks default_worker_count().
+  std::size_t worker_count = 0;
+};
+
+// RGBA8 PNG encoder. Rows are filtered in parallel bands (SSE2 on x86-64),
+// then the filtered stream is cut into chunk_bytes blocks that are deflated
+// concurrently, pigz-style: each block is primed with the previous 32 KiB as
+// its dictionary and ends on a byte boundary with a sync flush, so the
+// blocks concatenate into one zlib stream whose Adler-32 is combined from
+// the per-block checksums.
+class PngEncoder {
+ public:
+  explicit PngEncoder(PngEncodeSettings settings = {});
+  ~PngEncoder();
+
+  PngEncoder(const PngEncoder&) = delete;
+  PngEncoder& operator=(const PngEncoder&) = delete;
+
+  // Returns an empty vector for an empty frame or a zlib failure.
+  std::vector<std::uint8_t> encode(const FrameBuffer& frame);
+
+  [[nodiscard]] const PngEncodeSettings& settings() const { return settings_; }
+  [[nodiscard]] std::size_t worker_count() const;
+
+ private:
+  struct DeflateBlock;
+
+  void for_each_task(std::size_t task_count, const ParallelTask& task);
+
+  PngEncodeSettings settings_;
+  std::unique_ptr<WorkStealingThreadPool> pool_;
+  std::vector<std::uint8_t> filtered_;
+  std::vector<DeflateBlock> blocks_;
+};
+
+// Filter type byte chosen for one row (0 none, 1 sub, 2 up, 3 average,
+// 4 paeth); `previous` is null for the first row. Writes stride + 1 bytes.
+std::uint8_t png_filter_row(const std::uint8_t* row,
+                            const std::uint8_t* previous,
+                            std::size_t stride,
+                            std::uint8_t* output);
+
+}  // namespace manim_cpp::renderer
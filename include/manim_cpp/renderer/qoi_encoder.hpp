@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace manim_cpp::renderer {
+
+// Encodes 8-bit RGB (channels = 3) or RGBA (channels = 4) pixels as a QOI
+// image (sRGB colourspace). QOI encodes in one linear pass with no entropy
+// coder, several times faster than PNG at a somewhat larger size. Returns an
+// empty vector for an empty image or an unsupported channel count.
+std::vector<std::uint8_t> encode_qoi(const std::uint8_t* pixels,
+                                     std::size_t width,
+                                     std::size_t height,
+                                     std::size_t channels);
+
+}  // namespace manim_cpp::renderer
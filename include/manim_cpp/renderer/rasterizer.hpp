@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "manim_cpp/renderer/draw_list.hpp"
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/thread_pool.hpp"
+
+namespace manim_cpp::renderer {
+
+struct RasterSettings {
+  std::size_t pixel_width = 1920;
+  std::size_t pixel_height = 1080;
+  double frame_height = 8.0;
+  Rgba8 background{0, 0, 0, 255};
+  std::size_t tile_size = 64;
+  std::size_t vertical_samples = 4;
+};
+
+// Scanline rasterizer that bins draw commands into square tiles and fills the
+// tiles in parallel. Coverage is exact horizontally and supersampled
+// vertically (`vertical_samples` sub-scanlines per pixel row).
+class TileRasterizer {
+ public:
+  explicit TileRasterizer(std::size_t worker_count = 0);
+
+  [[nodiscard]] std::size_t worker_count() const;
+  void render(const DrawList& draw_list,
+              const RasterSettings& settings,
+              FrameBuffer* output);
+
+ private:
+  WorkStealingThreadPool& pool();
+
+  std::size_t requested_worker_count_ = 0;
+  std::unique_ptr<WorkStealingThreadPool> pool_;
+};
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace manim_cpp::renderer {
+
+// Fixed-capacity ring buffer for exactly one producer thread and one consumer
+// thread. Neither side takes a lock: head_ is written only by the consumer,
+// tail_ only by the producer, and each publishes with release ordering so a
+// slot is fully written before the other side can observe it. Callers that
+// need to block (backpressure on a full queue, starvation on an empty one)
+// spin on try_push()/try_pop() with their own backoff.
+template <typename T>
+class BoundedSpscQueue {
+ public:
+  explicit BoundedSpscQueue(const std::size_t capacity)
+      : slots_(std::max<std::size_t>(capacity, 1)) {}
+
+  BoundedSpscQueue(const BoundedSpscQueue&) = delete;
+  BoundedSpscQueue& operator=(const BoundedSpscQueue&) = delete;
+
+  // Producer side. Leaves `value` untouched and returns false when full.
+  bool try_push(T& value) {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == slots_.size()) {
+      return false;
+    }
+    slots_[tail % slots_.size()] = std::move(value);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side. Returns false when empty.
+  bool try_pop(T* output) {
+    const auto head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    *output = std::move(slots_[head % slots_.size()]);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Snapshot of the number of queued items; exact only when called from the
+  // producer or consumer thread while the other side is idle.
+  [[nodiscard]] std::size_t size() const {
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+  }
+  [[nodiscard]] std::size_t capacity() const { return slots_.size(); }
+
+ private:
+  static constexpr std::size_t kCacheLineBytes = 64;
+
+  std::vector<T> slots_;
+  alignas(kCacheLineBytes) std::atomic<std::size_t> head_{0};
+  alignas(kCacheLineBytes) std::atomic<std::size_t> tail_{0};
+};
+
+}  // namespace manim_cpp::renderer
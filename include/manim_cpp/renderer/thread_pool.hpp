@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace manim_cpp::renderer {
+
+using ParallelTask = std::function<void(std::size_t)>;
+
+// Fixed-size pool with one task deque per participant. Each participant pops
+// from the front of its own deque and steals from the back of the others, so
+// uneven tiles (dense vs empty regions) even out without a shared queue.
+class WorkStealingThreadPool {
+ public:
+  explicit WorkStealingThreadPool(std::size_t worker_count = 0);
+  ~WorkStealingThreadPool();
+
+  WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+  WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+  // Total participants, including the thread that calls parallel_for().
+  [[nodiscard]] std::size_t worker_count() const { return queues_.size(); }
+
+  // Runs task(i) for every i in [0, task_count) and blocks until all are done.
+  // The first exception thrown by a task is rethrown here.
+  void parallel_for(std::size_t task_count, const ParallelTask& task);
+
+ private:
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<std::size_t> tasks;
+  };
+
+  void worker_loop(std::size_t queue_index);
+  void drain(std::size_t queue_index);
+  std::optional<std::size_t> pop_local(std::size_t queue_index);
+  std::optional<std::size_t> steal(std::size_t thief_index);
+
+  std::vector<std::unique_ptr<TaskQueue>> queues_;
+  std::vector<std::thread> threads_;
+
+  std::mutex dispatch_mutex_;
+  std::mutex batch_mutex_;
+  std::condition_variable batch_cv_;
+  std::condition_variable done_cv_;
+  const ParallelTask* batch_task_ = nullptr;
+  std::size_t batch_generation_ = 0;
+  std::atomic<std::size_t> remaining_{0};
+  std::exception_ptr first_error_;
+  bool stopping_ = false;
+};
+
+std::size_t default_worker_count();
+
+}  // namespace manim_cpp::renderer
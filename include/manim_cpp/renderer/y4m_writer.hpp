@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <ostream>
+#include <string>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/yuv_convert.hpp"
+
+namespace manim_cpp::renderer {
+
+// Streams frames as uncompressed YUV4MPEG2 (4:2:0, BT.601 limited range),
+// the format ffmpeg, x264 and most encoders read from a pipe. Frames are
+// converted and written one at a time, so memory stays at one frame.
+class Y4mWriter {
+ public:
+  Y4mWriter() = default;
+  ~Y4mWriter();
+  Y4mWriter(const Y4mWriter&) = delete;
+  Y4mWriter& operator=(const Y4mWriter&) = delete;
+
+  // Writes the stream header. A path of "-" streams to standard output.
+  bool open(const std::filesystem::path& path,
+            std::size_t width,
+            std::size_t height,
+            double frame_rate);
+  // Appends one frame; its size must match the one given to open().
+  bool write_frame(const FrameBuffer& frame);
+  // Appends the previously written frame again without reconverting it.
+  bool repeat_last_frame();
+  // Flushes and closes the stream. Returns false if any write failed.
+  bool close();
+
+  [[nodiscard]] bool is_open() const { return stream_ != nullptr; }
+  [[nodiscard]] std::size_t frames_written() const { return frames_written_; }
+  [[nodiscard]] const std::string& error() const { return error_; }
+
+  // "YUV4MPEG2 W<w> H<h> F<num>:<den> ..." including the trailing newline.
+  // NTSC-style rates such as 29.97 are written as 30000:1001.
+  [[nodiscard]] static std::string header(std::size_t width,
+                                          std::size_t height,
+                                          double frame_rate);
+  // Bytes per frame record, including the "FRAME\n" marker.
+  [[nodiscard]] static std::size_t frame_record_size(std::size_t width, std::size_t height);
+
+ private:
+  bool write_planes();
+
+  std::ofstream file_;
+  std::ostream* stream_ = nullptr;
+  std::size_t width_ = 0;
+  std::size_t height_ = 0;
+  std::size_t frames_written_ = 0;
+  Yuv420Frame frame_;
+  std::string error_;
+};
+
+}  // namespace manim_cpp::renderer
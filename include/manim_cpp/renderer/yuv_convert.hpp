@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+
+namespace manim_cpp::renderer {
+
+// Planar 8-bit YUV 4:2:0 (I420): a full-resolution luma plane followed by
+// two chroma planes subsampled by two in each direction (rounded up).
+struct Yuv420Frame {
+  std::size_t width = 0;
+  std::size_t height = 0;
+  std::vector<std::uint8_t> y;
+  std::vector<std::uint8_t> u;
+  std::vector<std::uint8_t> v;
+
+  [[nodiscard]] std::size_t chroma_width() const { return (width + 1) / 2; }
+  [[nodiscard]] std::size_t chroma_height() const { return (height + 1) / 2; }
+};
+
+// BT.601 limited-range conversion in 8.8 fixed point; alpha is ignored.
+// Chroma is taken from the rounded mean of each 2x2 block (centred siting),
+// with the last column/row repeated for odd sizes. The SIMD paths (AVX2 on
+// x86-64 with runtime detection, NEON on AArch64) are bit-identical to the
+// scalar reference.
+void rgba_to_yuv420(const FrameBuffer& frame, Yuv420Frame* output);
+void rgba_to_yuv420_scalar(const FrameBuffer& frame, Yuv420Frame* output);
+
+// "avx2", "neon" or "scalar": the path rgba_to_yuv420() takes on this CPU.
+const char* yuv420_converter_name();
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace manim_cpp::scene {
+
+enum class FsyncPolicy {
+  kNever,
+  // fdatasync()/_commit() each file before closing it.
+  kPerFile,
+  // Flush the filesystems written to once, in flush(): syncfs() on Linux,
+  // sync() elsewhere on POSIX. Windows falls back to per-file commits.
+  kOnFlush,
+};
+
+enum class AsyncIoBackend {
+  // io_uring where the kernel allows it, otherwise threads.
+  kAuto,
+  kIoUring,
+  kThreads,
+};
+
+std::string to_string(FsyncPolicy policy);
+std::optional<FsyncPolicy> parse_fsync_policy(const std::string& value);
+std::string to_string(AsyncIoBackend backend);
+std::optional<AsyncIoBackend> parse_async_io_backend(const std::string& value);
+
+struct AsyncFileWriterSettings {
+  // Files accepted but not yet closed; submit() blocks once this many are
+  // pending.
+  std::size_t queue_depth = 32;
+  FsyncPolicy fsync_policy = FsyncPolicy::kNever;
+  AsyncIoBackend backend = AsyncIoBackend::kAuto;
+  // Workers of the thread backend.
+  std::size_t thread_count = 2;
+  // Fault injection: the io_uring backend's Nth io_uring_enter (1-based)
+  // still submits but reports EIO. 0 disables it.
+  std::size_t fail_io_uring_enter_at = 0;
+};
+
+using SharedBytes = std::shared_ptr<const std::vector<std::uint8_t>>;
+
+// Writes whole files off the calling thread. On Linux one I/O thread drives
+// an io_uring instance (raw syscalls, no liburing) through open, write,
+// optional fsync and close for up to queue_depth files at once, capped at the
+// ring's submission queue size; elsewhere, or when io_uring is unavailable, a
+// small thread pool performs the same steps with blocking calls. If the ring
+// fails at runtime, the I/O thread tears it down once the kernel is done with
+// every entry and writes the remaining files itself with blocking calls.
+// Submissions are single-producer.
+class AsyncFileWriter {
+ public:
+  // Called on an I/O thread after each file is closed (or has failed).
+  using CompletionCallback = std::function<void(const std::filesystem::path&, bool)>;
+
+  explicit AsyncFileWriter(AsyncFileWriterSettings settings = {},
+                           CompletionCallback on_complete = nullptr);
+  // Flushes outstanding writes.
+  ~AsyncFileWriter();
+
+  AsyncFileWriter(const AsyncFileWriter&) = delete;
+  AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+  // Queues `bytes` to be written to `path`, replacing any existing file.
+  // Returns immediately unless queue_depth files are already pending.
+  void submit(std::filesystem::path path, SharedBytes bytes);
+  // Waits for every submitted file, then applies the on-flush fsync policy.
+  // Returns false with error() set if any write since construction failed.
+  bool flush();
+
+  [[nodiscard]] const char* backend_name() const;
+  // Why the thread backend runs although AsyncIoBackend::kIoUring was
+  // requested; empty otherwise.
+  [[nodiscard]] const std::string& backend_fallback_reason() const {
+    return backend_fallback_reason_;
+  }
+  [[nodiscard]] const AsyncFileWriterSettings& settings() const { return settings_; }
+  [[nodiscard]] std::size_t completed_count() const;
+  [[nodiscard]] std::string error() const;
+
+ private:
+  struct Request {
+    std::filesystem::path path;
+    SharedBytes bytes;
+  };
+  class IoUring;
+
+  void run_threads();
+  void run_io_uring();
+  bool write_blocking(const Request& request, std::string* error) const;
+  void complete(const Request& request, bool ok, const std::string& error);
+  // Moves up to `limit` queued requests out; blocks while none are queued
+  // and `wait` is set. Returns false once stopping with nothing queued.
+  bool take_requests(std::size_t limit, bool wait, std::vector<Request>* requests);
+  // Puts requests taken but not completed back at the head of the queue.
+  void requeue_requests(std::vector<Request> requests);
+
+  AsyncFileWriterSettings settings_;
+  CompletionCallback on_complete_;
+  std::unique_ptr<IoUring> ring_;
+  std::atomic<bool> ring_failed_{false};
+  std::string backend_fallback_reason_;
+  std::vector<std::thread> threads_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable space_cv_;
+  std::deque<Request> queue_;
+  // Queued plus in flight.
+  std::size_t pending_ = 0;
+  std::size_t completed_ = 0;
+  std::set<std::filesystem::path> written_directories_;
+  std::string error_;
+  bool stopping_ = false;
+};
+
+}  // namespace manim_cpp::scene
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string>
+
+#include "manim_cpp/renderer/frame_cache.hpp"
+#include "manim_cpp/renderer/png_encoder.hpp"
+#include "manim_cpp/renderer/rasterizer.hpp"
+#include "manim_cpp/renderer/y4m_writer.hpp"
+#include "manim_cpp/scene/scene.hpp"
+#include "manim_cpp/scene/scene_timeline.hpp"
+
+namespace manim_cpp::scene {
+
+class SceneFileWriter;
+
+struct FramePipelineSettings {
+  renderer::RasterSettings raster_settings;
+  // Capacity of each inter-stage queue; a full queue stalls the upstream stage.
+  std::size_t queue_capacity = 4;
+  // Budget for rasterized frames kept for reuse; the encode stage shares
+  // them with the cache instead of copying.
+  std::size_t frame_cache_max_bytes = renderer::kDefaultFrameCacheMaxBytes;
+  // Rasterizer threads; 0 picks default_worker_count().
+  std::size_t raster_worker_count = 0;
+  // Frames are written to images_dir / frame_file_name(index). With an empty
+  // images_dir and no video_sink the scene is evaluated but nothing is
+  // rasterized or written.
+  std::filesystem::path images_dir;
+  std::function<std::string(std::size_t)> frame_file_name;
+  // PNG encoding for images_dir; deflate runs on its own worker threads.
+  renderer::PngEncodeSettings png_settings{};
+  // When set, the encode stage also streams every frame, in order, into this
+  // already-open writer. Cached segments have no frames to stream, so run()
+  // fails if the writer has a partial movie dir or a cached frame arrives.
+  renderer::Y4mWriter* video_sink = nullptr;
+};
+
+struct FramePipelineStageStats {
+  const char* name = "";
+  std::size_t frames = 0;
+  double busy_seconds = 0.0;
+  // Time spent waiting for upstream work (starved).
+  double input_wait_seconds = 0.0;
+  // Time spent blocked on a full output queue.
+  double output_wait_seconds = 0.0;
+  // Output queue depth sampled after every push.
+  std::size_t max_queue_depth = 0;
+  double mean_queue_depth = 0.0;
+};
+
+struct FramePipelineStats {
+  static constexpr std::size_t kStageCount = 3;
+
+  double wall_seconds = 0.0;
+  std::array<FramePipelineStageStats, kStageCount> stages{};
+
+  // Fraction of the wall time a stage spent doing work.
+  [[nodiscard]] double occupancy(std::size_t stage) const;
+};
+
+// Render driver that overlaps scene evaluation, rasterization and encoding:
+//   evaluate  - runs the scene on its own thread and snapshots draw lists,
+//   rasterize - renders through the frame cache, skipping unchanged frames,
+//   encode    - PNG-encodes and writes through SceneFileWriter (queued when
+//               the writer has async frame writes enabled; run() flushes
+//               them before returning), and/or streams YUV frames into the
+//               video sink.
+// Stages are linked by lock-free single-producer/single-consumer queues, so a
+// slow stage backs up the ones feeding it instead of growing memory.
+class FramePipeline {
+ public:
+  explicit FramePipeline(FramePipelineSettings settings);
+
+  // Runs the scene to completion, with images_dir as its frame output so
+  // cached segments are still rendered. Returns false with error() set when a
+  // frame could not be encoded or written; exceptions thrown by the scene
+  // propagate once all stages have stopped.
+  bool run(Scene& scene, SceneFileWriter& writer);
+  // Renders frames [range.first_index, range.last_index] of a compiled
+  // timeline; the evaluate stage reads snapshots instead of running a scene.
+  // Compile it with the scene's frame output set: frames of a cached segment
+  // cannot be written and make the run fail.
+  bool run(const SceneTimeline& timeline,
+           const FrameRange& range,
+           const std::string& scene_name,
+           SceneFileWriter& writer);
+
+  [[nodiscard]] const FramePipelineStats& stats() const { return stats_; }
+  [[nodiscard]] const std::string& error() const { return error_; }
+
+ private:
+  bool run_stages(const std::function<void(const FrameSink&)>& evaluate,
+                  const std::string& scene_name,
+                  SceneFileWriter& writer);
+
+  FramePipelineSettings settings_;
+  FramePipelineStats stats_;
+  std::string error_;
+};
+
+}  // namespace manim_cpp::scene
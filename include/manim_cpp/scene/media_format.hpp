@@ -11,6 +11,8 @@ enum class MediaFormat {
   kMp4,
   kWebm,
   kMov,
+  // Uncompressed YUV4MPEG2 streamed frame by frame (see renderer::Y4mWriter).
+  kY4m,
 };
 
 std::string to_string(MediaFormat format);
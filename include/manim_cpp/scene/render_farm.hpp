@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "manim_cpp/scene/async_file_writer.hpp"
+#include "manim_cpp/scene/frame_pipeline.hpp"
+#include "manim_cpp/scene/scene_timeline.hpp"
+
+namespace manim_cpp::scene {
+
+class SceneFileWriter;
+
+struct RenderFarmSettings {
+  std::size_t worker_count = 1;
+  // Per-worker pipeline; every worker writes its frames into images_dir.
+  // Thread counts left at 0 are divided between the workers.
+  FramePipelineSettings pipeline;
+  // Receives one partial movie and one manifest per worker.
+  std::filesystem::path worker_dir;
+  // Frame image writes of each worker; unset writes synchronously.
+  std::optional<AsyncFileWriterSettings> async_frame_writes;
+};
+
+struct RenderFarmWorker {
+  FrameRange range;
+  std::filesystem::path partial_movie_file;
+  std::filesystem::path manifest_file;
+  // Frame count read back from the worker's manifest.
+  std::size_t frame_count = 0;
+};
+
+// Local render farm over a compiled timeline. The frames are split into one
+// contiguous range per worker; each worker is a forked process (a thread on
+// platforms without fork()) that renders its range through a FramePipeline
+// and leaves a partial movie plus a media manifest in worker_dir. The
+// coordinator then stitches the partial movies, in frame order, into the
+// writer's current section and merges the worker manifests.
+//
+// Workers split the cores between them. run() must not be called while
+// other threads of the process are running, since forked workers would
+// inherit the locks they hold; the writer's own async frame writes are
+// paused while the workers start.
+class RenderFarm {
+ public:
+  explicit RenderFarm(RenderFarmSettings settings);
+
+  // Returns false with error() set when a worker fails or the merged
+  // manifests do not account for every frame of the timeline.
+  bool run(const SceneTimeline& timeline,
+           const std::string& scene_name,
+           SceneFileWriter& writer);
+
+  [[nodiscard]] const std::vector<RenderFarmWorker>& workers() const { return workers_; }
+  [[nodiscard]] std::size_t frame_count() const { return frame_count_; }
+  [[nodiscard]] const std::string& error() const { return error_; }
+  [[nodiscard]] static bool uses_processes();
+
+ private:
+  RenderFarmSettings settings_;
+  std::vector<RenderFarmWorker> workers_;
+  std::size_t frame_count_ = 0;
+  std::string error_;
+};
+
+}  // namespace manim_cpp::scene
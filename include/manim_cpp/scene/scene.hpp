@@ -8,6 +8,9 @@
 #include <string>
 #include <vector>
 
+#include "manim_cpp/renderer/draw_list.hpp"
+#include "manim_cpp/renderer/rasterizer.hpp"
+
 namespace manim_cpp::animation {
 class Animation;
 }  // namespace manim_cpp::animation
@@ -16,10 +19,29 @@ namespace manim_cpp::mobject {
 class Mobject;
 }  // namespace manim_cpp::mobject
 
+namespace manim_cpp::renderer {
+class FrameHasher;
+}  // namespace manim_cpp::renderer
+
 namespace manim_cpp::scene {
 
+class SceneFileWriter;
+class SceneTimeline;
+
 using SceneUpdater = std::function<void(double)>;
 
+// One output frame, sampled at the frame's midpoint in scene time. The draw
+// list is a snapshot, so it stays valid while the scene keeps advancing.
+// Frames inside a cached partial-movie segment carry no draw list.
+struct SceneFrame {
+  std::size_t index = 0;
+  double time_seconds = 0.0;
+  renderer::DrawList draw_list;
+  bool from_cached_segment = false;
+};
+
+using FrameSink = std::function<void(SceneFrame)>;
+
 class Scene {
  public:
   virtual ~Scene() = default;
@@ -33,7 +55,10 @@ class Scene {
   void wait(double seconds = 1.0);
   void tick(double delta_seconds);
 
-  void add_updater(SceneUpdater updater);
+  // Updaters change what a segment renders, so they are part of its cache key
+  // through their cache_key. A segment played while an updater without a key
+  // is attached is neither cached nor fast-forwarded.
+  void add_updater(SceneUpdater updater, std::string cache_key = "");
   void clear_updaters();
 
   void add(const std::shared_ptr<mobject::Mobject>& mobject);
@@ -48,12 +73,62 @@ class Scene {
 
   virtual std::string scene_name() const { return "Scene"; }
 
+  // With a file writer attached, every play()/wait() segment is hashed from
+  // its parameters, the starting mobject state, the updaters, the render
+  // settings, its first frame index and the frame output; a segment whose
+  // partial movie already exists is fast-forwarded instead of replayed.
+  // Animations that do not opt in through cacheable() are always replayed.
+  void set_file_writer(SceneFileWriter* file_writer);
+  // Names where emitted frames are written (an images directory, say). While
+  // set, cached segments are still replayed so their frames can be rendered
+  // again; only the partial movie is reused.
+  void set_frame_output(std::string frame_output);
+  [[nodiscard]] const std::string& frame_output() const;
+  [[nodiscard]] SceneFileWriter* file_writer() const;
+  void set_render_settings(const renderer::RasterSettings& raster_settings,
+                           double frame_rate);
+  [[nodiscard]] const renderer::RasterSettings& raster_settings() const;
+  [[nodiscard]] double frame_rate() const;
+  [[nodiscard]] std::string hash_play(const animation::Animation& animation,
+                                      std::size_t steps) const;
+  [[nodiscard]] std::string hash_wait(double seconds) const;
+
+  // Frames are emitted from tick() at the configured frame rate as scene time
+  // passes, and once more at the end of run(), so a consumer can render frame
+  // N while the scene computes frame N+1.
+  void set_frame_sink(FrameSink frame_sink);
+  [[nodiscard]] std::size_t emitted_frame_count() const;
+
+  // With a timeline attached, every segment and the state at the start of
+  // every tick are recorded; see SceneTimeline::compile().
+  void set_timeline(SceneTimeline* timeline);
+  [[nodiscard]] SceneTimeline* timeline() const;
+
  private:
-  std::vector<SceneUpdater> updaters_;
+  struct KeyedUpdater {
+    SceneUpdater function;
+    std::string cache_key;
+  };
+
+  void hash_scene_state(renderer::FrameHasher* hasher) const;
+  [[nodiscard]] bool has_unkeyed_updaters() const;
+  // Index of the first frame due at or after the current scene time.
+  [[nodiscard]] std::uint64_t next_frame_index() const;
+  void emit_frames_until(double end_seconds, bool inclusive);
+
+  std::vector<KeyedUpdater> updaters_;
   std::vector<std::shared_ptr<mobject::Mobject>> mobjects_;
   double elapsed_seconds_ = 0.0;
   std::uint64_t random_seed_ = 0;
   std::mt19937_64 rng_{0};
+  SceneFileWriter* file_writer_ = nullptr;
+  std::string frame_output_;
+  renderer::RasterSettings raster_settings_;
+  double frame_rate_ = 60.0;
+  FrameSink frame_sink_;
+  std::size_t emitted_frame_count_ = 0;
+  bool in_cached_segment_ = false;
+  SceneTimeline* timeline_ = nullptr;
 };
 
 }  // namespace manim_cpp::scene
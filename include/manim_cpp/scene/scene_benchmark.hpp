@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "manim_cpp/renderer/rasterizer.hpp"
+#include "manim_cpp/scene/frame_pipeline.hpp"
+
+namespace manim_cpp::scene {
+
+struct SceneBenchmarkSettings {
+  std::size_t runs = 5;
+  renderer::RasterSettings raster_settings;
+  double frame_rate = 15.0;
+  std::size_t frame_cache_max_bytes = renderer::kDefaultFrameCacheMaxBytes;
+  // Frames are written as PNGs under work_dir / scene name, so encoding and
+  // disk writes are part of the measurement; the directory is removed once
+  // the scene is done. Empty picks a directory under the system temp path.
+  std::filesystem::path work_dir;
+};
+
+struct SceneBenchmarkStage {
+  std::string name;
+  // Means over the runs.
+  double busy_seconds = 0.0;
+  double input_wait_seconds = 0.0;
+  double output_wait_seconds = 0.0;
+};
+
+struct SceneBenchmarkResult {
+  std::string scene_name;
+  std::size_t runs = 0;
+  std::size_t frames = 0;
+  // Per-run wall time, scene construction included.
+  double median_wall_seconds = 0.0;
+  double min_wall_seconds = 0.0;
+  double max_wall_seconds = 0.0;
+  // frames / median_wall_seconds.
+  double frames_per_second = 0.0;
+  // High-water mark of the process' resident set over this scene's runs. It
+  // is reset before every scene on Linux; elsewhere it is the process peak so
+  // far, so a scene never reports less than the ones benchmarked before it.
+  std::uint64_t peak_rss_bytes = 0;
+  // Lookups in the process-wide mesh cache over all runs. The cache is cleared
+  // before each scene but outlives a run, so only the first run of a scene
+  // misses on its shapes.
+  std::size_t mesh_cache_hits = 0;
+  std::size_t mesh_cache_misses = 0;
+  std::array<SceneBenchmarkStage, FramePipelineStats::kStageCount> stages{};
+};
+
+// Renders registered scenes headlessly through a FramePipeline, settings.runs
+// times each, and keeps the timings of every scene. Each scene starts from an
+// empty mesh cache, so its numbers do not depend on the scenes before it.
+class SceneBenchmark {
+ public:
+  explicit SceneBenchmark(SceneBenchmarkSettings settings);
+
+  // Returns false with error() set when the scene is not registered or a run
+  // fails; results() then holds only the scenes benchmarked before it.
+  bool run(const std::string& scene_name);
+
+  [[nodiscard]] const std::vector<SceneBenchmarkResult>& results() const { return results_; }
+  [[nodiscard]] const SceneBenchmarkSettings& settings() const { return settings_; }
+  [[nodiscard]] const std::string& error() const { return error_; }
+
+ private:
+  SceneBenchmarkSettings settings_;
+  std::vector<SceneBenchmarkResult> results_;
+  std::string error_;
+};
+
+struct SceneBenchmarkReport {
+  std::size_t pixel_width = 0;
+  std::size_t pixel_height = 0;
+  double frame_rate = 0.0;
+  std::vector<SceneBenchmarkResult> scenes;
+};
+
+bool write_benchmark_report(const std::filesystem::path& path,
+                            const SceneBenchmarkReport& report);
+// Reads a report written by write_benchmark_report(); nullopt if the file is
+// missing or is not such a report.
+std::optional<SceneBenchmarkReport> read_benchmark_report(const std::filesystem::path& path);
+
+struct BenchmarkRegression {
+  std::string scene_name;
+  // "frames", "wall_seconds" (the median) or "peak_rss_bytes".
+  std::string metric;
+  double baseline = 0.0;
+  double current = 0.0;
+  // (current - baseline) / baseline.
+  double change = 0.0;
+};
+
+struct BenchmarkComparison {
+  std::vector<BenchmarkRegression> regressions;
+  // Benchmarked scenes the baseline has no entry for; they are not compared.
+  std::vector<std::string> unmatched_scenes;
+  // The reports were rendered at different resolutions or frame rates, so no
+  // scene was compared and the comparison fails.
+  bool render_settings_differ = false;
+
+  [[nodiscard]] bool passed() const { return !render_settings_differ && regressions.empty(); }
+};
+
+// A scene regresses when its median wall time or peak RSS grows by more than
+// `threshold` (0.1 = 10%) over the baseline, or when it renders a different
+// number of frames, which makes its timings incomparable. Reports rendered at
+// different resolutions or frame rates are not compared at all.
+BenchmarkComparison compare_benchmarks(const SceneBenchmarkReport& baseline,
+                                       const SceneBenchmarkReport& current,
+                                       double threshold);
+
+// Peak resident set size of this process in bytes; 0 when unavailable.
+std::uint64_t peak_rss_bytes();
+// Restarts the peak RSS measurement from the current resident set. Returns
+// false where that is not supported (everywhere but Linux).
+bool reset_peak_rss();
+
+}  // namespace manim_cpp::scene
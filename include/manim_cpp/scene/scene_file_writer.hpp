@@ -1,12 +1,17 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 #include "manim_cpp/config/config.hpp"
+#include "manim_cpp/scene/async_file_writer.hpp"
 #include "manim_cpp/scene/section.hpp"
 
 namespace manim_cpp::scene {
@@ -47,8 +52,37 @@ class SceneFileWriter {
   void begin_section(const std::string& name, bool skip_animations);
 
   void begin_animation(bool write_frames);
+  // Hashed animations name their partial movie `<animation_hash>.mp4`, so a
+  // matching file left in partial_movie_dir by an earlier render is reused.
+  void begin_animation(bool write_frames, std::string animation_hash);
   void end_animation(bool write_frames);
 
+  void set_partial_movie_dir(std::filesystem::path partial_movie_dir);
+  const std::filesystem::path& partial_movie_dir() const { return partial_movie_dir_; }
+  bool is_partial_movie_cached(const std::string& animation_hash) const;
+  std::size_t flush_partial_movie_cache() const;
+  std::size_t prune_partial_movie_cache(std::size_t max_files) const;
+
+  // Writes one encoded frame image. Safe to call from an encoder thread while
+  // the scene thread drives the animation bookkeeping above. With async frame
+  // writes enabled the image is only queued, and a false return reports an
+  // earlier queued write that failed.
+  bool write_frame_image(const std::filesystem::path& frame_path,
+                         std::span<const std::uint8_t> encoded_frame);
+  bool write_frame_image(const std::filesystem::path& frame_path, SharedBytes encoded_frame);
+  // Routes frame images through an AsyncFileWriter so the encoder only
+  // blocks when `settings.queue_depth` images are pending.
+  void enable_async_frame_writes(const AsyncFileWriterSettings& settings);
+  // Flushes queued frame images and joins the I/O threads, for example so
+  // the process can fork; later writes are synchronous. Returns false if a
+  // queued write failed.
+  bool disable_async_frame_writes();
+  // Waits for queued frame images; false with frame_write_error() set if any
+  // of them failed. A no-op for synchronous writes.
+  bool flush_frame_images();
+  std::string frame_write_error() const;
+  const AsyncFileWriter* async_frame_writer() const { return async_frame_writer_.get(); }
+
   void add_partial_movie_file(const std::string& path);
   void set_section_timeline(double start_seconds, double end_seconds);
   void add_subcaption(const std::string& content,
@@ -69,12 +103,23 @@ class SceneFileWriter {
       const std::string& quality) const;
   bool write_subcaptions_srt(const std::filesystem::path& output_path) const;
   bool write_media_manifest(const std::filesystem::path& output_path) const;
+  // Reads a manifest produced by write_media_manifest() (for example by a
+  // render worker), appends its partial movie files to the current section
+  // and returns its frame count. Returns nullopt for unreadable manifests.
+  std::optional<std::size_t> merge_media_manifest(const std::filesystem::path& manifest_path);
 
   const std::string& scene_name() const { return scene_name_; }
   const std::vector<Section>& sections() const { return sections_; }
   const std::vector<Subcaption>& subcaptions() const { return subcaptions_; }
   const std::vector<AudioSegment>& audio_segments() const { return audio_segments_; }
   const RenderSummary& render_summary() const { return render_summary_; }
+  std::size_t cached_animation_count() const { return cached_animation_count_; }
+  std::size_t written_frame_count() const {
+    return written_frame_count_.load(std::memory_order_relaxed);
+  }
+  const std::vector<std::string>& uncached_partial_movie_files() const {
+    return uncached_partial_movie_files_;
+  }
 
  private:
   std::string scene_name_;
@@ -85,6 +130,13 @@ class SceneFileWriter {
   bool animation_active_ = false;
   bool active_animation_writes_frames_ = false;
   std::size_t rendered_animation_count_ = 0;
+  std::string active_animation_hash_;
+  std::filesystem::path partial_movie_dir_;
+  std::size_t cached_animation_count_ = 0;
+  std::vector<std::string> uncached_partial_movie_files_;
+  std::atomic<std::size_t> written_frame_count_{0};
+  // Declared last: its I/O threads update written_frame_count_ until joined.
+  std::unique_ptr<AsyncFileWriter> async_frame_writer_;
 
   std::string make_partial_movie_file_name(std::size_t index) const;
 };
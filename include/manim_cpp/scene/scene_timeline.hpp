@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "manim_cpp/math/core.hpp"
+#include "manim_cpp/renderer/draw_list.hpp"
+#include "manim_cpp/renderer/frame_cache.hpp"
+#include "manim_cpp/scene/scene.hpp"
+
+namespace manim_cpp::scene {
+
+enum class TimelineSegmentKind {
+  kPlay,
+  kWait,
+};
+
+struct TimelineSegment {
+  TimelineSegmentKind kind = TimelineSegmentKind::kPlay;
+  double start_seconds = 0.0;
+  double duration_seconds = 0.0;
+  std::size_t steps = 0;
+  // Dynamic type of the played animation; empty for waits.
+  std::string animation;
+  bool cached = false;
+  // Index of the segment's first snapshot in SceneTimeline::snapshots().
+  std::size_t first_snapshot = 0;
+};
+
+// One tick, recorded at its start before scene time advances. Its state is
+// replayed from the keyframe at or before it.
+struct TimelineSnapshot {
+  double time_seconds = 0.0;
+  bool from_cached_segment = false;
+  // Index of that keyframe; meaningless in cached segments, which draw
+  // nothing.
+  std::size_t keyframe = 0;
+};
+
+// Inclusive range of 1-based frame indices.
+struct FrameRange {
+  std::size_t first_index = 1;
+  std::size_t last_index = 0;
+
+  [[nodiscard]] std::size_t size() const {
+    return last_index >= first_index ? last_index - first_index + 1 : 0;
+  }
+};
+
+// Compiled form of a scene: every play()/wait() segment plus the state at
+// each tick. Any frame can then be produced without re-running the scene, so
+// disjoint frame ranges can be rendered by independent workers. Frames built
+// from a timeline match the ones Scene::run() streams.
+//
+// State is kept sparse. A keyframe holds deep copies of the scene's mobjects
+// every `keyframe_interval` ticks, after cached segments, and wherever the
+// mobjects change in a way replay cannot reproduce (added or removed
+// mobjects, changed shapes). Other ticks only record the centers and
+// opacities that changed, which is all animations touch; a tick is rebuilt
+// by replaying those onto a copy of its keyframe. Memory then grows with the
+// animated state rather than with ticks times geometry.
+class SceneTimeline {
+ public:
+  static constexpr std::size_t kDefaultKeyframeInterval = 64;
+
+  explicit SceneTimeline(std::size_t keyframe_interval = kDefaultKeyframeInterval);
+
+  // Runs the scene once (without emitting frames) and records its timeline.
+  static SceneTimeline compile(Scene& scene,
+                               std::size_t keyframe_interval = kDefaultKeyframeInterval);
+
+  // Called by Scene while it runs with this timeline attached.
+  void begin_segment(TimelineSegmentKind kind,
+                     double start_seconds,
+                     double duration_seconds,
+                     std::size_t steps,
+                     std::string animation,
+                     bool cached);
+  void record_snapshot(double time_seconds,
+                       const std::vector<std::shared_ptr<mobject::Mobject>>& mobjects,
+                       bool from_cached_segment);
+  void finish(double duration_seconds, double frame_rate);
+
+  [[nodiscard]] double duration_seconds() const { return duration_seconds_; }
+  [[nodiscard]] double frame_rate() const { return frame_rate_; }
+  [[nodiscard]] std::size_t frame_count() const { return frame_count_; }
+  [[nodiscard]] const std::vector<TimelineSegment>& segments() const { return segments_; }
+  [[nodiscard]] const std::vector<TimelineSnapshot>& snapshots() const { return snapshots_; }
+  [[nodiscard]] std::size_t keyframe_count() const { return keyframes_.size(); }
+
+  // Latest snapshot taken at or before `time_seconds` (the first one for
+  // earlier times). Requires a finished timeline.
+  [[nodiscard]] const TimelineSnapshot& snapshot_at(double time_seconds) const;
+  // Renderable state of snapshot `index`, replayed from its keyframe.
+  [[nodiscard]] renderer::DrawList draw_list(std::size_t index) const;
+  // Segment covering `time_seconds`, or nullptr outside every segment.
+  [[nodiscard]] const TimelineSegment* segment_at(double time_seconds) const;
+  // Frame `index` (1-based), sampled at its midpoint like Scene::run(). Safe
+  // to call concurrently from several threads.
+  [[nodiscard]] SceneFrame frame(std::size_t index) const;
+  // Splits all frames into at most `range_count` contiguous, non-empty ranges
+  // of near-equal size.
+  [[nodiscard]] std::vector<FrameRange> partition_frames(std::size_t range_count) const;
+
+ private:
+  // What animations change on one mobject, in preorder over the scene.
+  struct MobjectState {
+    math::Vec3 center{};
+    double opacity = 1.0;
+
+    bool operator==(const MobjectState&) const = default;
+  };
+
+  struct StateChange {
+    std::size_t mobject = 0;
+    MobjectState state;
+  };
+
+  struct Keyframe {
+    std::size_t snapshot = 0;
+    std::vector<std::shared_ptr<mobject::Mobject>> mobjects;
+    // Only kept when the copies do not draw like the originals, e.g. for a
+    // Mobject subclass that does not override clone().
+    std::shared_ptr<const renderer::DrawList> draw_list;
+  };
+
+  std::size_t keyframe_interval_ = kDefaultKeyframeInterval;
+  std::vector<TimelineSegment> segments_;
+  std::vector<TimelineSnapshot> snapshots_;
+  // State changes since the previous snapshot, one entry per snapshot.
+  std::vector<std::vector<StateChange>> changes_;
+  std::vector<Keyframe> keyframes_;
+  double duration_seconds_ = 0.0;
+  double frame_rate_ = 60.0;
+  std::size_t frame_count_ = 0;
+  // While compiling: the latest keyframe with every change since replayed
+  // onto it, checked against the live scene each tick.
+  std::vector<std::shared_ptr<mobject::Mobject>> replay_;
+  std::vector<mobject::Mobject*> replay_nodes_;
+  std::vector<MobjectState> replay_states_;
+  renderer::FrameHash last_draw_hash_;
+  std::size_t ticks_since_keyframe_ = 0;
+};
+
+}  // namespace manim_cpp::scene
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace manim_cpp::testing {
+
+// CRC-32 as used by zip and PNG (reflected polynomial 0xEDB88320). `crc` is
+// a finished value, 0 before any data, so calls chain over streamed data the
+// way zlib's crc32() does. Dispatches at runtime to PCLMULQDQ folding on
+// x86-64, the CRC32 instructions on ARMv8, or slicing-by-8.
+std::uint32_t crc32_update(std::uint32_t crc, std::span<const std::uint8_t> bytes);
+// The portable table-driven path; every dispatched path matches it.
+std::uint32_t crc32_update_slicing_by_8(std::uint32_t crc, std::span<const std::uint8_t> bytes);
+
+// CRC of A followed by B, given crc(A), crc(B) and B's length.
+std::uint32_t crc32_combine(std::uint32_t crc_a, std::uint32_t crc_b, std::uint64_t length_b);
+
+// "pclmul", "armv8" or "slicing-by-8": the path crc32_update() takes.
+const char* crc32_implementation_name();
+
+}  // namespace manim_cpp::testing
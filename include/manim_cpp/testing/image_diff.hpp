@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+
+namespace manim_cpp::testing {
+
+// Interleaved 8-bit pixels with 3 (RGB) or 4 (RGBA) channels, rows packed.
+struct ImageView {
+  std::span<const std::uint8_t> pixels;
+  std::size_t width = 0;
+  std::size_t height = 0;
+  std::size_t channels = 4;
+
+  static ImageView of(const renderer::FrameBuffer& frame) {
+    return {.pixels = {frame.data(), frame.byte_size()},
+            .width = frame.width(),
+            .height = frame.height(),
+            .channels = renderer::FrameBuffer::kChannels};
+  }
+};
+
+struct ImageDiffSettings {
+  // Largest absolute difference per channel (R, G, B, A) still counted as a
+  // match; 3-channel images ignore the last entry.
+  std::array<std::uint8_t, 4> channel_tolerance{};
+  // SSIM costs about as much as the rest of the diff, so it can be skipped.
+  bool compute_ssim = true;
+  // Threads for diff_frame_sequences(); 0 picks default_worker_count().
+  std::size_t worker_count = 0;
+};
+
+struct ImageDiff {
+  // False when the images' shapes differ; every other field is then unset.
+  bool comparable = false;
+  std::array<std::uint8_t, 4> channel_max_error{};
+  std::uint8_t max_error = 0;
+  // Pixels with any channel beyond its tolerance.
+  std::uint64_t differing_pixels = 0;
+  double mean_squared_error = 0.0;
+  // Infinite for identical images.
+  double psnr = std::numeric_limits<double>::infinity();
+  // Mean SSIM of the luma over 8x8 blocks; 1 for identical images.
+  double ssim = 1.0;
+
+  [[nodiscard]] bool within_tolerance() const { return comparable && differing_pixels == 0; }
+};
+
+// Compares two images channel by channel. The error, tolerance and squared
+// error kernels run on AVX2 when the CPU has it (runtime detection on
+// x86-64) and give the same results as the scalar path.
+ImageDiff diff_images(const ImageView& expected,
+                      const ImageView& actual,
+                      const ImageDiffSettings& settings = {});
+ImageDiff diff_images_scalar(const ImageView& expected,
+                             const ImageView& actual,
+                             const ImageDiffSettings& settings = {});
+
+struct FrameSequenceDiff {
+  std::vector<ImageDiff> frames;
+  // The earliest frame outside tolerance, or past the shorter sequence.
+  std::optional<std::size_t> first_diverging_frame;
+  std::uint8_t max_error = 0;
+  double min_psnr = std::numeric_limits<double>::infinity();
+  double min_ssim = 1.0;
+};
+
+// Diffs frame i of `expected` against frame i of `actual`, frames spread
+// across a work-stealing pool.
+FrameSequenceDiff diff_frame_sequences(std::span<const ImageView> expected,
+                                       std::span<const ImageView> actual,
+                                       const ImageDiffSettings& settings = {});
+
+// A dimmed grayscale copy of `expected` with each pixel outside tolerance
+// painted from dark red (just past it) to yellow (maximum error). Empty when
+// the images are not comparable.
+renderer::FrameBuffer render_diff_heatmap(const ImageView& expected,
+                                          const ImageView& actual,
+                                          const ImageDiffSettings& settings = {});
+bool write_diff_heatmap(const std::filesystem::path& output_path,
+                        const ImageView& expected,
+                        const ImageView& actual,
+                        const ImageDiffSettings& settings = {});
+
+// "avx2" or "scalar": the path diff_images() takes on this CPU.
+const char* image_diff_kernel_name();
+
+}  // namespace manim_cpp::testing
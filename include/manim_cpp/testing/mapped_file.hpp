@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+
+namespace manim_cpp::testing {
+
+// Read-only memory mapping of a whole file. Pages are faulted in on access,
+// so reading a multi-GB archive front to back needs no heap buffer.
+class MappedFile {
+ public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  // Replaces any current mapping. An empty file maps to an empty span.
+  bool open(const std::filesystem::path& path);
+  void close();
+
+  [[nodiscard]] bool is_open() const { return open_; }
+  [[nodiscard]] std::span<const std::uint8_t> bytes() const { return {data_, size_}; }
+  [[nodiscard]] const std::string& error() const { return error_; }
+
+  // Hints that `range` (a subspan of bytes()) will not be read again so its
+  // pages can leave the working set. Contents stay readable.
+  void release(std::span<const std::uint8_t> range) const;
+
+ private:
+  const std::uint8_t* data_ = nullptr;
+  std::size_t size_ = 0;
+  bool open_ = false;
+#ifdef _WIN32
+  void* mapping_ = nullptr;
+#endif
+  std::string error_;
+};
+
+}  // namespace manim_cpp::testing
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace manim_cpp::testing {
+
+enum class NpyDtype {
+  kUint8,
+  kFloat32,
+  kFloat64,
+};
+
+std::size_t npy_dtype_size(NpyDtype dtype);
+// "u1", "f4" or "f8".
+const char* npy_dtype_name(NpyDtype dtype);
+
+template <typename T>
+constexpr NpyDtype npy_dtype_of() {
+  static_assert(std::is_same_v<T, std::uint8_t> || std::is_same_v<T, float> ||
+                    std::is_same_v<T, double>,
+                "npy arrays hold uint8_t, float or double");
+  if constexpr (std::is_same_v<T, std::uint8_t>) {
+    return NpyDtype::kUint8;
+  } else if constexpr (std::is_same_v<T, float>) {
+    return NpyDtype::kFloat32;
+  } else {
+    return NpyDtype::kFloat64;
+  }
+}
+
+// A parsed .npy header. The shape lives inline, so parsing allocates nothing.
+struct NpyHeader {
+  static constexpr std::size_t kMaxRank = 8;
+
+  NpyDtype dtype = NpyDtype::kUint8;
+  bool fortran_order = false;
+  std::array<std::uint64_t, kMaxRank> shape{};
+  std::size_t rank = 0;
+  // Bytes from the magic string to the first element.
+  std::size_t data_offset = 0;
+
+  [[nodiscard]] std::span<const std::uint64_t> dims() const {
+    return std::span(shape).first(rank);
+  }
+  [[nodiscard]] std::uint64_t element_count() const;
+  [[nodiscard]] std::uint64_t data_size() const { return element_count() * npy_dtype_size(dtype); }
+};
+
+// Bytes taken by the magic, version, length and dict, from the first 10
+// (version 1) or 12 (versions 2 and 3) bytes of an .npy; nullopt if those
+// are not an npy preamble or `prefix` is too short to tell.
+std::optional<std::size_t> npy_header_size(std::span<const std::uint8_t> prefix);
+
+// Parses the header of a little-endian u1, f4 or f8 array of rank up to
+// kMaxRank. `npy_bytes` needs to hold the header only, not the data.
+std::optional<NpyHeader> parse_npy_header(std::span<const std::uint8_t> npy_bytes);
+
+// Elements of an .npy array read in place, typically from a mapped npz
+// entry. Zip entries carry no alignment guarantee, so elements are loaded
+// with memcpy rather than through a T pointer.
+template <typename T>
+class NpyArrayView {
+ public:
+  // nullopt unless `npy_bytes` is a whole array of T.
+  static std::optional<NpyArrayView> create(const std::span<const std::uint8_t> npy_bytes) {
+    const auto header = parse_npy_header(npy_bytes);
+    if (!header.has_value() || header->dtype != npy_dtype_of<T>() ||
+        npy_bytes.size() - header->data_offset < header->data_size()) {
+      return std::nullopt;
+    }
+    return NpyArrayView(header.value(),
+                        npy_bytes.subspan(header->data_offset,
+                                          static_cast<std::size_t>(header->data_size())));
+  }
+
+  [[nodiscard]] const NpyHeader& header() const { return header_; }
+  [[nodiscard]] std::uint64_t size() const { return header_.element_count(); }
+  [[nodiscard]] std::span<const std::uint8_t> bytes() const { return data_; }
+
+  // The element at `index` in storage order.
+  [[nodiscard]] T operator[](const std::uint64_t index) const {
+    T value;
+    std::memcpy(&value, data_.data() + index * sizeof(T), sizeof(T));
+    return value;
+  }
+
+  // The element at a logical index of one coordinate per dimension,
+  // whichever order the array is stored in.
+  [[nodiscard]] T at(const std::span<const std::uint64_t> index) const {
+    std::uint64_t flat = 0;
+    if (header_.fortran_order) {
+      for (std::size_t axis = header_.rank; axis > 0; --axis) {
+        flat = flat * header_.shape[axis - 1] + index[axis - 1];
+      }
+    } else {
+      for (std::size_t axis = 0; axis < header_.rank; ++axis) {
+        flat = flat * header_.shape[axis] + index[axis];
+      }
+    }
+    return (*this)[flat];
+  }
+
+ private:
+  NpyArrayView(const NpyHeader& header, const std::span<const std::uint8_t> data)
+      : header_(header), data_(data) {}
+
+  NpyHeader header_;
+  std::span<const std::uint8_t> data_;
+};
+
+}  // namespace manim_cpp::testing
@@ -1,18 +1,30 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
+#include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 #include <vector>
 
+#include "manim_cpp/renderer/thread_pool.hpp"
+#include "manim_cpp/testing/mapped_file.hpp"
+
 namespace manim_cpp::testing {
 
 struct NpzEntry {
   std::string name;
   std::uint16_t compression_method = 0;
-  std::uint32_t compressed_size = 0;
-  std::uint32_t uncompressed_size = 0;
+  std::uint32_t crc32 = 0;
+  // Resolved from the Zip64 extra field when the classic fields saturate.
+  std::uint64_t compressed_size = 0;
+  std::uint64_t uncompressed_size = 0;
+  std::uint64_t local_header_offset = 0;
 };
 
 struct NpzWriteEntry {
@@ -22,8 +34,172 @@ struct NpzWriteEntry {
 
 std::optional<std::vector<NpzEntry>> read_npz_central_directory(
     const std::filesystem::path& npz_path);
+
+// An .npz opened through a read-only mapping. Stored entries are returned
+// as views into the mapping, so reading one costs no copy and no more memory
+// than the pages being touched.
+class NpzArchive {
+ public:
+  bool open(const std::filesystem::path& npz_path);
+
+  [[nodiscard]] const std::vector<NpzEntry>& entries() const { return entries_; }
+  [[nodiscard]] const NpzEntry* find_entry(std::string_view name) const;
+  // Raw (possibly compressed) data of an entry; nullopt if its local header
+  // does not match the central directory.
+  [[nodiscard]] std::optional<std::span<const std::uint8_t>> entry_data(
+      const NpzEntry& entry) const;
+  // Data of a stored (compression method 0) entry; nullopt for compressed
+  // entries or a bad local header.
+  [[nodiscard]] std::optional<std::span<const std::uint8_t>> stored_entry_bytes(
+      const NpzEntry& entry) const;
+  [[nodiscard]] const MappedFile& file() const { return file_; }
+  [[nodiscard]] const std::string& error() const { return error_; }
+
+ private:
+  MappedFile file_;
+  std::vector<NpzEntry> entries_;
+  std::string error_;
+};
+
+// Reads one entry's uncompressed bytes front to back. Stored entries are
+// copied out of the mapping and deflated ones are inflated incrementally, so
+// memory stays bounded whatever the entry size. The CRC is checked once the
+// last byte has been read or skipped.
+class NpzEntryReader {
+ public:
+  NpzEntryReader();
+  ~NpzEntryReader();
+
+  NpzEntryReader(const NpzEntryReader&) = delete;
+  NpzEntryReader& operator=(const NpzEntryReader&) = delete;
+
+  // `archive` must outlive the reader.
+  bool open(const NpzArchive& archive, const NpzEntry& entry);
+  // Fills `output` unless the entry ends first or a read fails; returns the
+  // number of bytes written.
+  std::size_t read(std::span<std::uint8_t> output);
+  bool skip(std::uint64_t size);
+
+  [[nodiscard]] std::uint64_t remaining() const { return size_ - position_; }
+  [[nodiscard]] const std::string& error() const { return error_; }
+
+ private:
+  struct Inflater;
+
+  bool finish_chunk(std::span<const std::uint8_t> bytes);
+
+  std::unique_ptr<Inflater> inflater_;
+  std::span<const std::uint8_t> data_;
+  std::size_t data_position_ = 0;
+  bool deflated_ = false;
+  std::uint64_t size_ = 0;
+  std::uint64_t position_ = 0;
+  std::uint32_t expected_crc32_ = 0;
+  std::uint32_t crc32_ = 0;
+  std::string error_;
+};
+
+struct NpzWriterSettings {
+  // 0 stores entries; 1-9 deflate them at that zlib level.
+  int compression_level = 0;
+  // Uncompressed bytes per independently deflated chunk. Each chunk is
+  // primed with the 32 KiB before it and ends in a sync flush, pigz-style,
+  // so chunks compress in parallel into one valid deflate stream.
+  std::size_t chunk_bytes = 1024 * 1024;
+  // Threads used for deflate; 0 picks default_worker_count().
+  std::size_t worker_count = 0;
+  // Writes Zip64 records even for small archives.
+  bool force_zip64 = false;
+};
+
+// Writes an .npz one entry at a time. A frame array entry is streamed:
+// frames are appended as they are produced and, on close, its npy shape
+// header, CRC and sizes are patched in place, so an archive of any length is
+// written with at most a chunk per worker in memory. With deflate, the npy
+// header goes in a stored block of its own so it can still be patched.
+// Zip64 records are emitted for entries, offsets or counts that outgrow the
+// classic 32/16-bit fields.
+class NpzWriter {
+ public:
+  NpzWriter() = default;
+  // Closes the archive if close() was not called.
+  ~NpzWriter();
+
+  NpzWriter(const NpzWriter&) = delete;
+  NpzWriter& operator=(const NpzWriter&) = delete;
+
+  bool open(const std::filesystem::path& npz_path, NpzWriterSettings settings = {});
+  bool add_entry(const std::string& name, std::span<const std::uint8_t> bytes);
+  // Starts a C-order uint8 npy entry of shape (N, height, width, channels)
+  // where N counts the frames appended before the next entry or close().
+  bool begin_frame_array(const std::string& name,
+                         std::size_t height,
+                         std::size_t width,
+                         std::size_t channels);
+  // `frame` must hold height * width * channels bytes.
+  bool append_frame(std::span<const std::uint8_t> frame);
+  bool close();
+
+  [[nodiscard]] bool is_open() const { return output_.is_open(); }
+  [[nodiscard]] std::uint64_t frame_count() const { return frame_count_; }
+  [[nodiscard]] const std::string& error() const { return error_; }
+
+ private:
+  struct WrittenEntry {
+    std::string name;
+    std::uint16_t compression_method = 0;
+    std::uint32_t crc32 = 0;
+    std::uint64_t compressed_size = 0;
+    std::uint64_t uncompressed_size = 0;
+    std::uint64_t local_header_offset = 0;
+  };
+  struct FrameArray {
+    std::size_t entry_index = 0;
+    // Where the npy header bytes start.
+    std::uint64_t header_offset = 0;
+    std::size_t height = 0;
+    std::size_t width = 0;
+    std::size_t channels = 0;
+    std::uint32_t data_crc32 = 0;
+    std::uint64_t data_size = 0;
+    std::uint64_t compressed_size = 0;
+  };
+  struct DeflateChunk {
+    std::vector<std::uint8_t> output;
+    std::uint32_t crc32 = 0;
+    bool ok = false;
+  };
+
+  bool start_entry(const WrittenEntry& entry, bool streamed);
+  // Deflates `input` as the continuation of the current entry's stream into
+  // chunks_; returns the CRC of `input` through `crc32`.
+  bool deflate_chunks(std::span<const std::uint8_t> input, std::uint32_t* crc32);
+  bool write_chunks(std::uint64_t* written);
+  bool flush_pending_frames();
+  bool finish_frame_array();
+  bool fail(std::string message);
+
+  std::ofstream output_;
+  std::filesystem::path path_;
+  NpzWriterSettings settings_;
+  std::unique_ptr<renderer::WorkStealingThreadPool> pool_;
+  std::vector<DeflateChunk> chunks_;
+  // Frames not yet deflated, and the last 32 KiB already deflated.
+  std::vector<std::uint8_t> pending_;
+  std::vector<std::uint8_t> window_;
+  std::vector<WrittenEntry> entries_;
+  std::unordered_set<std::string> names_;
+  std::optional<FrameArray> frame_array_;
+  std::uint64_t frame_count_ = 0;
+  std::string error_;
+};
+
 bool has_npy_entry(const std::vector<NpzEntry>& entries);
 bool write_npz_store_archive(const std::filesystem::path& npz_path,
                              const std::vector<NpzWriteEntry>& entries);
+// write_npz_store_archive() with deflate or other writer settings.
+bool write_npz_archive(const std::filesystem::path& npz_path,
+                       const std::vector<NpzWriteEntry>& entries,
+                       const NpzWriterSettings& settings);
 
 }  // namespace manim_cpp::testing
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+
+namespace manim_cpp::testing {
+
+// Decodes the PNGs the renderers write: 8-bit RGB or RGBA, not interlaced.
+// Chunk CRCs are checked; RGB is expanded to opaque RGBA.
+bool decode_png(std::span<const std::uint8_t> png, renderer::FrameBuffer* frame);
+bool read_png(const std::filesystem::path& path, renderer::FrameBuffer* frame);
+
+}  // namespace manim_cpp::testing
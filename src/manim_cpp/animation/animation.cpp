@@ -1,7 +1,10 @@
 #include "manim_cpp/animation/animation.hpp"
 
+#include <cstddef>
 #include <utility>
 
+#include "manim_cpp/renderer/hash.hpp"
+
 namespace manim_cpp::animation {
 
 void Animation::set_run_time_seconds(const double seconds) {
@@ -12,12 +15,18 @@ double Animation::run_time_seconds() const {
   return run_time_seconds_;
 }
 
-void Animation::set_rate_function(RateFunction function) {
+void Animation::set_rate_function(RateFunction function, std::string name) {
   if (!function) {
     rate_function_ = [](double alpha) { return alpha; };
+    rate_function_name_ = "linear";
     return;
   }
   rate_function_ = std::move(function);
+  rate_function_name_ = std::move(name);
+}
+
+const std::string& Animation::rate_function_name() const {
+  return rate_function_name_;
 }
 
 double Animation::apply_rate_function(const double alpha) const {
@@ -28,4 +37,24 @@ void Animation::interpolate_with_rate(const double alpha) {
   interpolate(apply_rate_function(alpha));
 }
 
+void Animation::hash_parameters(renderer::FrameHasher* hasher) const {
+  if (hasher == nullptr) {
+    return;
+  }
+  hasher->update(debug_name());
+  hasher->update_double(run_time_seconds_);
+  if (!rate_function_name_.empty()) {
+    hasher->update(std::string_view("rate:"));
+    hasher->update(rate_function_name_);
+    return;
+  }
+  // An anonymous curve is only known through its values, so sample it far
+  // more densely than a segment steps through it.
+  constexpr std::size_t kRateSamples = 1024;
+  for (std::size_t sample = 0; sample <= kRateSamples; ++sample) {
+    const double alpha = static_cast<double>(sample) / static_cast<double>(kRateSamples);
+    hasher->update_double(rate_function_(alpha));
+  }
+}
+
 }  // namespace manim_cpp::animation
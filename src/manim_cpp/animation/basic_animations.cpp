@@ -1,6 +1,7 @@
 #include "manim_cpp/animation/basic_animations.hpp"
 
 #include "manim_cpp/mobject/mobject.hpp"
+#include "manim_cpp/renderer/hash.hpp"
 
 namespace manim_cpp::animation {
 
@@ -18,6 +19,25 @@ double lerp_double(const double a, const double b, const double alpha) {
   return a + ((b - a) * alpha);
 }
 
+void hash_vec3(const math::Vec3& value, renderer::FrameHasher* hasher) {
+  hasher->update_double(value[0]);
+  hasher->update_double(value[1]);
+  hasher->update_double(value[2]);
+}
+
+// Targets are not necessarily part of the scene, so their starting state is
+// hashed alongside the animation parameters.
+void hash_target(const std::shared_ptr<mobject::Mobject>& target,
+                 renderer::FrameHasher* hasher) {
+  if (!target) {
+    hasher->update_u64(0);
+    return;
+  }
+  hasher->update_u64(1);
+  hash_vec3(target->center(), hasher);
+  hasher->update_double(target->opacity());
+}
+
 }  // namespace
 
 MoveToAnimation::MoveToAnimation(std::shared_ptr<mobject::Mobject> target,
@@ -46,6 +66,15 @@ void MoveToAnimation::interpolate(const double alpha) {
   target_->move_to(lerp_vec3(start_, destination_, alpha));
 }
 
+void MoveToAnimation::hash_parameters(renderer::FrameHasher* hasher) const {
+  if (hasher == nullptr) {
+    return;
+  }
+  Animation::hash_parameters(hasher);
+  hash_target(target_, hasher);
+  hash_vec3(destination_, hasher);
+}
+
 ShiftAnimation::ShiftAnimation(std::shared_ptr<mobject::Mobject> target, const math::Vec3 delta)
     : target_(std::move(target)), delta_(delta) {}
 
@@ -76,6 +105,15 @@ void ShiftAnimation::interpolate(const double alpha) {
   target_->move_to(lerp_vec3(start_, destination, alpha));
 }
 
+void ShiftAnimation::hash_parameters(renderer::FrameHasher* hasher) const {
+  if (hasher == nullptr) {
+    return;
+  }
+  Animation::hash_parameters(hasher);
+  hash_target(target_, hasher);
+  hash_vec3(delta_, hasher);
+}
+
 FadeToOpacityAnimation::FadeToOpacityAnimation(std::shared_ptr<mobject::Mobject> target,
                                                const double target_opacity)
     : target_(std::move(target)), target_opacity_(target_opacity) {}
@@ -102,4 +140,13 @@ void FadeToOpacityAnimation::interpolate(const double alpha) {
   target_->set_opacity(lerp_double(start_opacity_, target_opacity_, alpha));
 }
 
+void FadeToOpacityAnimation::hash_parameters(renderer::FrameHasher* hasher) const {
+  if (hasher == nullptr) {
+    return;
+  }
+  Animation::hash_parameters(hasher);
+  hash_target(target_, hasher);
+  hasher->update_double(target_opacity_);
+}
+
 }  // namespace manim_cpp::animation
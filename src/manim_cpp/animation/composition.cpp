@@ -4,7 +4,31 @@
 #include <stdexcept>
 #include <utility>
 
+#include "manim_cpp/renderer/hash.hpp"
+
 namespace manim_cpp::animation {
+namespace {
+
+void hash_children(const std::vector<Animation*>& animations,
+                   renderer::FrameHasher* hasher) {
+  hasher->update_u64(animations.size());
+  for (const Animation* animation : animations) {
+    if (animation == nullptr) {
+      hasher->update_u64(0);
+      continue;
+    }
+    hasher->update_u64(1);
+    animation->hash_parameters(hasher);
+  }
+}
+
+bool children_cacheable(const std::vector<Animation*>& animations) {
+  return std::all_of(animations.begin(), animations.end(), [](const Animation* animation) {
+    return animation == nullptr || animation->cacheable();
+  });
+}
+
+}  // namespace
 
 ParallelAnimation::ParallelAnimation(std::vector<Animation*> animations)
     : animations_(std::move(animations)) {
@@ -45,6 +69,18 @@ void ParallelAnimation::finish() {
   }
 }
 
+bool ParallelAnimation::cacheable() const {
+  return children_cacheable(animations_);
+}
+
+void ParallelAnimation::hash_parameters(renderer::FrameHasher* hasher) const {
+  if (hasher == nullptr) {
+    return;
+  }
+  Animation::hash_parameters(hasher);
+  hash_children(animations_, hasher);
+}
+
 SuccessionAnimation::SuccessionAnimation(std::vector<Animation*> animations)
     : animations_(std::move(animations)) {
   start_times_.reserve(animations_.size());
@@ -106,6 +142,18 @@ void SuccessionAnimation::finish() {
   }
 }
 
+bool SuccessionAnimation::cacheable() const {
+  return children_cacheable(animations_);
+}
+
+void SuccessionAnimation::hash_parameters(renderer::FrameHasher* hasher) const {
+  if (hasher == nullptr) {
+    return;
+  }
+  Animation::hash_parameters(hasher);
+  hash_children(animations_, hasher);
+}
+
 LaggedStartAnimation::LaggedStartAnimation(std::vector<Animation*> animations,
                                            const double lag_ratio)
     : animations_(std::move(animations)), lag_ratio_(lag_ratio) {
@@ -177,4 +225,17 @@ void LaggedStartAnimation::finish() {
   }
 }
 
+bool LaggedStartAnimation::cacheable() const {
+  return children_cacheable(animations_);
+}
+
+void LaggedStartAnimation::hash_parameters(renderer::FrameHasher* hasher) const {
+  if (hasher == nullptr) {
+    return;
+  }
+  Animation::hash_parameters(hasher);
+  hasher->update_double(lag_ratio_);
+  hash_children(animations_, hasher);
+}
+
 }  // namespace manim_cpp::animation
@@ -6,9 +6,13 @@
 #include <cstdlib>
 #include <cerrno>
 #include <cmath>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <limits>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -16,12 +20,19 @@
 #include "manim_cpp/config/config.hpp"
 #include "manim_cpp/plugin/loader.hpp"
 #include "manim_cpp/renderer/cairo_renderer.hpp"
+#include "manim_cpp/renderer/frame_cache.hpp"
 #include "manim_cpp/renderer/interaction.hpp"
+#include "manim_cpp/renderer/mesh_cache.hpp"
 #include "manim_cpp/renderer/opengl_renderer.hpp"
 #include "manim_cpp/renderer/renderer.hpp"
+#include "manim_cpp/renderer/y4m_writer.hpp"
+#include "manim_cpp/scene/frame_pipeline.hpp"
 #include "manim_cpp/scene/media_format.hpp"
 #include "manim_cpp/scene/scene_file_writer.hpp"
 #include "manim_cpp/scene/registry.hpp"
+#include "manim_cpp/scene/render_farm.hpp"
+#include "manim_cpp/scene/scene_benchmark.hpp"
+#include "manim_cpp/scene/scene_timeline.hpp"
 #include "manim_cpp/version.hpp"
 
 namespace manim_cpp::cli {
@@ -35,6 +46,7 @@ void print_root_help() {
   std::cout << "  --help       Show this message and exit.\n\n";
   std::cout << "Commands:\n";
   std::cout << "  render       Render SCENE(S) from the input FILE.\n";
+  std::cout << "  bench        Benchmark registered scenes against a baseline.\n";
   std::cout << "  cfg          Manage manim.cfg files.\n";
   std::cout << "  checkhealth  Check local runtime dependencies.\n";
   std::cout << "  init         Initialize project/scene templates.\n";
@@ -46,8 +58,11 @@ void print_subcommand_help(const std::string& command) {
     std::cout << "Usage: manim-cpp render <input.cpp> [OPTIONS]\n\n";
     std::cout << "Options:\n";
     std::cout << "  --renderer <cairo|opengl>       Select render backend.\n";
-    std::cout << "  --format <png|gif|mp4|webm|mov> Select output media format.\n";
+    std::cout << "  --format <png|gif|mp4|webm|mov|y4m>\n";
+    std::cout << "                                  Select output media format.\n";
+    std::cout << "  --output_file <path|->          Write the y4m stream here ('-' for stdout).\n";
     std::cout << "  --scene <SceneName>             Run a registered C++ scene.\n";
+    std::cout << "  --workers <N>                   Render frame ranges in N worker processes.\n";
     std::cout << "  --watch, -w                     Enable watch mode.\n";
     std::cout << "  --interactive, -i               Enable interactive controls.\n";
     std::cout << "  --interaction_script <path>     Replay interaction commands from file.\n";
@@ -59,6 +74,19 @@ void print_subcommand_help(const std::string& command) {
     std::cout << "  --window_monitor <int>          Select monitor index.\n";
     return;
   }
+  if (command == "bench") {
+    std::cout << "Usage: manim-cpp bench [SceneName...] [OPTIONS]\n\n";
+    std::cout << "Renders each scene (default: every registered scene) headlessly.\n\n";
+    std::cout << "Options:\n";
+    std::cout << "  --runs <N>                      Renders per scene (default 5).\n";
+    std::cout << "  --resolution <W,H>              Frame size (default 854,480).\n";
+    std::cout << "  --fps <rate>                    Frame rate (default 15).\n";
+    std::cout << "  --output <path>                 Write the results as JSON.\n";
+    std::cout << "  --baseline <path>               Compare against an earlier --output;\n";
+    std::cout << "                                  exits 1 on a regression.\n";
+    std::cout << "  --threshold <percent>           Allowed slowdown/RSS growth (default 10).\n";
+    return;
+  }
   if (command == "cfg") {
     std::cout << "Usage: manim-cpp cfg <show|write> [ARGS]\n";
     return;
@@ -214,6 +242,22 @@ bool parse_int_strict(const std::string& value, int* output) {
   return true;
 }
 
+bool parse_size_strict(const std::string& value, std::size_t* output) {
+  if (value.empty() || output == nullptr || value.front() == '-') {
+    return false;
+  }
+
+  char* end = nullptr;
+  errno = 0;
+  const unsigned long long parsed = std::strtoull(value.c_str(), &end, 10);
+  if (errno != 0 || end == value.c_str() || *end != '\0' ||
+      parsed > std::numeric_limits<std::size_t>::max()) {
+    return false;
+  }
+  *output = static_cast<std::size_t>(parsed);
+  return true;
+}
+
 bool parse_double_strict(const std::string& value, double* output) {
   if (value.empty() || output == nullptr) {
     return false;
@@ -229,6 +273,13 @@ bool parse_double_strict(const std::string& value, double* output) {
   return true;
 }
 
+bool parse_bool_setting(std::string value) {
+  std::transform(value.begin(), value.end(), value.begin(), [](const unsigned char ch) {
+    return static_cast<char>(std::tolower(ch));
+  });
+  return value == "true" || value == "1" || value == "yes" || value == "on";
+}
+
 std::string frame_file_name_for_renderer(const manim_cpp::renderer::RendererType type,
                                          const std::string& scene_name,
                                          const std::size_t frame_index) {
@@ -245,6 +296,26 @@ std::string frame_file_name_for_renderer(const manim_cpp::renderer::RendererType
   return scene_name + ".png";
 }
 
+void print_pipeline_stats(const manim_cpp::scene::FramePipelineStats& stats,
+                          std::ostream& output) {
+  const auto flags = output.flags();
+  const auto precision = output.precision();
+  output << std::fixed << std::setprecision(3);
+  for (std::size_t stage = 0; stage < stats.stages.size(); ++stage) {
+    const auto& stage_stats = stats.stages[stage];
+    output << "Pipeline stage=" << stage_stats.name
+              << " frames=" << stage_stats.frames
+              << " busy=" << stage_stats.busy_seconds << "s"
+              << " occupancy=" << stats.occupancy(stage)
+              << " input_wait=" << stage_stats.input_wait_seconds << "s"
+              << " output_wait=" << stage_stats.output_wait_seconds << "s"
+              << " queue_mean=" << stage_stats.mean_queue_depth
+              << " queue_max=" << stage_stats.max_queue_depth << "\n";
+  }
+  output.flags(flags);
+  output.precision(precision);
+}
+
 std::filesystem::path default_cfg_template_path() {
   auto probe = std::filesystem::current_path();
   for (int depth = 0; depth < 10; ++depth) {
@@ -504,6 +575,8 @@ int handle_render(const int argc, const char* const argv[]) {
   auto window_position = manim_cpp::renderer::WindowPosition{};
   auto window_size = manim_cpp::renderer::WindowSize{};
   int window_monitor = 0;
+  std::size_t worker_count = 1;
+  std::optional<std::filesystem::path> output_file_option;
   for (int i = 2; i < argc; ++i) {
     const std::string token = argv[i];
     if (is_help_flag(token)) {
@@ -612,6 +685,28 @@ int handle_render(const int argc, const char* const argv[]) {
       }
       continue;
     }
+    if (token == "--output_file") {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for --output_file.\n";
+        return 2;
+      }
+      output_file_option = std::filesystem::path(argv[++i]);
+      continue;
+    }
+    if (token == "--workers") {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for --workers.\n";
+        return 2;
+      }
+      const std::string raw_value = argv[++i];
+      int parsed_workers = 0;
+      if (!parse_int_strict(raw_value, &parsed_workers) || parsed_workers <= 0) {
+        std::cerr << "Invalid value for --workers: " << raw_value << "\n";
+        return 2;
+      }
+      worker_count = static_cast<std::size_t>(parsed_workers);
+      continue;
+    }
     if (token.rfind("-", 0) == 0) {
       std::cerr << "Unknown render option: " << token << "\n";
       return 2;
@@ -628,6 +723,19 @@ int handle_render(const int argc, const char* const argv[]) {
     std::cerr << "Usage: manim-cpp render <input.cpp> [--renderer <cairo|opengl>]\n";
     return 2;
   }
+  const bool stream_video = media_format == manim_cpp::scene::MediaFormat::kY4m;
+  if (output_file_option.has_value() && !stream_video) {
+    std::cerr << "--output_file requires --format y4m.\n";
+    return 2;
+  }
+  if (stream_video && worker_count > 1) {
+    std::cerr << "--workers is not supported with --format y4m.\n";
+    return 2;
+  }
+  // With the video on stdout, everything else the command prints goes to
+  // stderr so the stream can be piped straight into an encoder.
+  const bool video_to_stdout = output_file_option.has_value() && output_file_option.value() == "-";
+  std::ostream& log = video_to_stdout ? std::cerr : std::cout;
 
   manim_cpp::renderer::InteractionConfig interaction_config;
   interaction_config.watch = watch;
@@ -688,7 +796,6 @@ int handle_render(const int argc, const char* const argv[]) {
       std::cerr << "Unknown scene: " << scene_name << "\n";
       return 2;
     }
-    scene->run();
 
     manim_cpp::config::ManimConfig config;
     std::vector<std::filesystem::path> config_chain;
@@ -722,54 +829,180 @@ int handle_render(const int argc, const char* const argv[]) {
     if (frame_rate <= 0.0) {
       frame_rate = 60.0;
     }
+    std::size_t frame_cache_max_bytes = manim_cpp::renderer::kDefaultFrameCacheMaxBytes;
+    const auto cache_bytes_value = config.get("CLI", "frame_cache_max_bytes",
+                                              std::to_string(frame_cache_max_bytes));
+    if (!parse_size_strict(cache_bytes_value, &frame_cache_max_bytes)) {
+      std::cerr << "Invalid frame_cache_max_bytes: " << cache_bytes_value << "\n";
+      return 2;
+    }
+
+    // Frame images are queued on an async writer (io_uring on Linux) so the
+    // encoder only waits on disk once frame_write_queue_depth are pending.
+    manim_cpp::scene::AsyncFileWriterSettings frame_write_settings;
+    const auto queue_depth_value = config.get("CLI", "frame_write_queue_depth",
+                                              std::to_string(frame_write_settings.queue_depth));
+    if (!parse_size_strict(queue_depth_value, &frame_write_settings.queue_depth)) {
+      std::cerr << "Invalid frame_write_queue_depth: " << queue_depth_value << "\n";
+      return 2;
+    }
+    const auto fsync_value = config.get("CLI", "frame_write_fsync", "never");
+    const auto fsync_policy = manim_cpp::scene::parse_fsync_policy(fsync_value);
+    if (!fsync_policy.has_value()) {
+      std::cerr << "Invalid frame_write_fsync: " << fsync_value << "\n";
+      return 2;
+    }
+    frame_write_settings.fsync_policy = fsync_policy.value();
+    const auto backend_value = config.get("CLI", "frame_write_backend", "auto");
+    const auto io_backend = manim_cpp::scene::parse_async_io_backend(backend_value);
+    if (!io_backend.has_value()) {
+      std::cerr << "Invalid frame_write_backend: " << backend_value << "\n";
+      return 2;
+    }
+    frame_write_settings.backend = io_backend.value();
 
     const auto quality =
         std::to_string(pixel_height) + "p" + std::to_string(static_cast<int>(std::llround(frame_rate)));
     const auto module_name = input_file.stem().string();
     const auto scene_output_extension = "." + manim_cpp::scene::to_string(media_format);
 
+    const manim_cpp::renderer::RasterSettings raster_settings{
+        .pixel_width = static_cast<std::size_t>(pixel_width),
+        .pixel_height = static_cast<std::size_t>(pixel_height),
+    };
     manim_cpp::scene::SceneFileWriter writer(scene->scene_name());
+    const auto output_paths = writer.resolve_output_paths(config, module_name, quality);
+    if (worker_count > 1 && !output_paths.has_value()) {
+      std::cerr << "--workers needs images_dir, video_dir and partial_movie_dir to be "
+                   "configured.\n";
+      return 2;
+    }
+    if (output_paths.has_value()) {
+      std::filesystem::create_directories(output_paths->images_dir);
+      std::filesystem::create_directories(output_paths->video_dir);
+      std::filesystem::create_directories(output_paths->partial_movie_dir);
+      // A y4m stream carries every frame, so there are no partial movies to
+      // reuse.
+      if (!stream_video &&
+          !parse_bool_setting(config.get("CLI", "disable_caching", "False"))) {
+        writer.set_partial_movie_dir(output_paths->partial_movie_dir);
+      }
+      if (parse_bool_setting(config.get("CLI", "flush_cache", "False"))) {
+        writer.flush_partial_movie_cache();
+      }
+    }
+
+    scene->set_render_settings(raster_settings, frame_rate);
+    scene->set_file_writer(&writer);
+    if (!stream_video) {
+      writer.enable_async_frame_writes(frame_write_settings);
+      const auto& fallback_reason = writer.async_frame_writer()->backend_fallback_reason();
+      if (!fallback_reason.empty()) {
+        std::cerr << "Warning: frame_write_backend is io_uring, but " << fallback_reason
+                  << "; writing frames on threads instead.\n";
+      }
+    }
+
+    std::optional<std::filesystem::path> output_file = std::nullopt;
+    manim_cpp::renderer::Y4mWriter video_writer;
+    if (stream_video) {
+      if (output_file_option.has_value()) {
+        output_file = output_file_option;
+      } else if (output_paths.has_value()) {
+        output_file = output_paths->video_dir / (scene->scene_name() + scene_output_extension);
+      }
+      if (!output_file.has_value()) {
+        std::cerr << "No output path for the y4m stream; pass --output_file.\n";
+        return 2;
+      }
+      if (!video_writer.open(output_file.value(), raster_settings.pixel_width,
+                             raster_settings.pixel_height, frame_rate)) {
+        std::cerr << video_writer.error() << "\n";
+        return 2;
+      }
+      if (video_to_stdout) {
+        output_file = std::nullopt;
+      }
+    }
+
+    // Evaluation, rasterization and encoding run as overlapping pipeline
+    // stages. Both renderer types use the CPU tile rasterizer; the OpenGL path
+    // has no headless context to draw into.
+    const manim_cpp::scene::FramePipelineSettings pipeline_settings{
+        .raster_settings = raster_settings,
+        .frame_cache_max_bytes = frame_cache_max_bytes,
+        .images_dir = output_paths.has_value() && !stream_video ? output_paths->images_dir
+                                                                : std::filesystem::path{},
+        .frame_file_name =
+            [&](const std::size_t frame_index) {
+              return frame_file_name_for_renderer(renderer_type, scene->scene_name(),
+                                                  frame_index);
+            },
+        .video_sink = stream_video ? &video_writer : nullptr,
+    };
+    std::optional<manim_cpp::scene::FramePipeline> pipeline;
+    std::optional<manim_cpp::scene::RenderFarm> render_farm;
+    std::size_t frame_count = 0;
+    if (worker_count > 1) {
+      // The scene is evaluated once into a timeline, then each worker process
+      // renders a contiguous frame range from it.
+      scene->set_frame_output(pipeline_settings.images_dir.generic_string());
+      const auto timeline = manim_cpp::scene::SceneTimeline::compile(*scene);
+      render_farm.emplace(manim_cpp::scene::RenderFarmSettings{
+          .worker_count = worker_count,
+          .pipeline = pipeline_settings,
+          .worker_dir = output_paths->partial_movie_dir / "workers",
+          .async_frame_writes = frame_write_settings,
+      });
+      if (!render_farm->run(timeline, scene->scene_name(), writer)) {
+        std::cerr << render_farm->error() << "\n";
+        return 2;
+      }
+      frame_count = render_farm->frame_count();
+    } else {
+      pipeline.emplace(pipeline_settings);
+      if (!pipeline->run(*scene, writer)) {
+        std::cerr << pipeline->error() << "\n";
+        return 2;
+      }
+      frame_count = scene->emitted_frame_count();
+    }
+    scene->set_file_writer(nullptr);
+    if (stream_video && !video_writer.close()) {
+      std::cerr << video_writer.error() << "\n";
+      return 2;
+    }
+
     const double elapsed_seconds = scene->time_seconds();
-    const std::size_t frame_count =
-        elapsed_seconds > 0.0
-            ? static_cast<std::size_t>(std::llround(elapsed_seconds * frame_rate))
-            : static_cast<std::size_t>(1);
     if (elapsed_seconds > 0.0) {
       writer.set_section_timeline(0.0, elapsed_seconds);
     }
-    std::optional<std::filesystem::path> output_file = std::nullopt;
     std::optional<std::filesystem::path> manifest_path = std::nullopt;
     std::optional<std::filesystem::path> subcaption_path = std::nullopt;
 
-    const auto output_paths = writer.resolve_output_paths(config, module_name, quality);
     if (output_paths.has_value()) {
-      std::filesystem::create_directories(output_paths->images_dir);
-      std::filesystem::create_directories(output_paths->video_dir);
-      std::filesystem::create_directories(output_paths->partial_movie_dir);
-
-      for (std::size_t frame_index = 1; frame_index <= frame_count; ++frame_index) {
-        const auto frame_path = output_paths->images_dir /
-                                frame_file_name_for_renderer(renderer_type,
-                                                             scene->scene_name(),
-                                                             frame_index);
-        std::ofstream frame_file(frame_path, std::ios::binary);
-        if (!frame_file.is_open()) {
-          std::cerr << "Failed to create frame image file: " << frame_path << "\n";
-          return 2;
+      if (!writer.partial_movie_dir().empty()) {
+        for (const auto& partial_name : writer.uncached_partial_movie_files()) {
+          const auto partial_path = writer.partial_movie_dir() / partial_name;
+          std::ofstream partial_file(partial_path, std::ios::binary);
+          partial_file << "manim-cpp-partial-movie\n";
+          partial_file << "scene=" << scene->scene_name() << "\n";
+          partial_file << "hash=" << partial_path.stem().string() << "\n";
+          if (!partial_file.good()) {
+            std::cerr << "Failed to write partial movie file: " << partial_path << "\n";
+            return 2;
+          }
         }
-        frame_file << "manim-cpp-frame\n";
-        frame_file << "scene=" << scene->scene_name() << "\n";
-        frame_file << "renderer=" << manim_cpp::renderer::to_string(renderer_type)
-                   << "\n";
-        frame_file << "frame_index=" << frame_index << "\n";
-        frame_file << "frame_count=" << frame_count << "\n";
-        if (!frame_file.good()) {
-          std::cerr << "Failed to write frame image file: " << frame_path << "\n";
-          return 2;
+        int max_files_cached = 100;
+        parse_int_strict(config.get("CLI", "max_files_cached", "100"), &max_files_cached);
+        if (max_files_cached >= 0) {
+          writer.prune_partial_movie_cache(static_cast<std::size_t>(max_files_cached));
         }
       }
 
-      output_file = output_paths->video_dir / (scene->scene_name() + scene_output_extension);
+      if (!stream_video) {
+        output_file = output_paths->video_dir / (scene->scene_name() + scene_output_extension);
+      }
       manifest_path = output_paths->video_dir / (scene->scene_name() + ".json");
       subcaption_path = output_paths->video_dir / (scene->scene_name() + ".srt");
     }
@@ -781,7 +1014,7 @@ int handle_render(const int argc, const char* const argv[]) {
                               manim_cpp::scene::to_string(media_format),
                               output_file);
 
-    if (output_file.has_value()) {
+    if (output_file.has_value() && !stream_video) {
       std::ofstream output_media(output_file.value(), std::ios::binary);
       if (!output_media.is_open()) {
         std::cerr << "Failed to create render output file: " << output_file.value() << "\n";
@@ -813,34 +1046,44 @@ int handle_render(const int argc, const char* const argv[]) {
       }
     }
 
-    std::cout << "Rendered registered scene: " << scene->scene_name()
-              << " elapsed=" << scene->time_seconds() << "s"
-              << " frames=" << frame_count
-              << " size=" << pixel_width << "x" << pixel_height
-              << " fps=" << frame_rate
-              << " renderer=" << manim_cpp::renderer::to_string(renderer_type)
-              << " format=" << manim_cpp::scene::to_string(media_format)
-              << " codec_hint=" << writer.render_summary().codec_hint
-              << " watch=" << (watch ? "true" : "false")
-              << " interactive=" << (interactive ? "true" : "false")
-              << " gui=" << (enable_gui ? "true" : "false")
-              << " fullscreen=" << (fullscreen ? "true" : "false")
-              << " force_window=" << (force_window ? "true" : "false")
-              << " window_open=" << (window_open ? "true" : "false")
-              << " window_position="
-              << manim_cpp::renderer::to_string(window_position)
-              << " window_size=" << manim_cpp::renderer::to_string(window_size)
-              << " window_monitor=" << window_monitor
-              << " camera_state=" << camera_state.pan_x << ","
-              << camera_state.pan_y << "," << camera_state.yaw << ","
-              << camera_state.pitch << "," << camera_state.zoom;
+    log << "Rendered registered scene: " << scene->scene_name()
+        << " elapsed=" << scene->time_seconds() << "s"
+        << " frames=" << frame_count
+        << " size=" << pixel_width << "x" << pixel_height
+        << " fps=" << frame_rate
+        << " renderer=" << manim_cpp::renderer::to_string(renderer_type)
+        << " format=" << manim_cpp::scene::to_string(media_format)
+        << " codec_hint=" << writer.render_summary().codec_hint
+        << " cached_animations=" << writer.cached_animation_count()
+        << " watch=" << (watch ? "true" : "false")
+        << " interactive=" << (interactive ? "true" : "false")
+        << " gui=" << (enable_gui ? "true" : "false")
+        << " fullscreen=" << (fullscreen ? "true" : "false")
+        << " force_window=" << (force_window ? "true" : "false")
+        << " window_open=" << (window_open ? "true" : "false")
+        << " window_position="
+        << manim_cpp::renderer::to_string(window_position)
+        << " window_size=" << manim_cpp::renderer::to_string(window_size)
+        << " window_monitor=" << window_monitor
+        << " camera_state=" << camera_state.pan_x << ","
+        << camera_state.pan_y << "," << camera_state.yaw << ","
+        << camera_state.pitch << "," << camera_state.zoom;
     if (output_file.has_value()) {
-      std::cout << " output=" << output_file->generic_string();
+      log << " output=" << output_file->generic_string();
     }
     if (manifest_path.has_value()) {
-      std::cout << " manifest=" << manifest_path->generic_string();
+      log << " manifest=" << manifest_path->generic_string();
+    }
+    log << "\n";
+    if (render_farm.has_value()) {
+      for (const auto& worker : render_farm->workers()) {
+        log << "Render worker frames=" << worker.range.first_index << "-"
+            << worker.range.last_index << " frame_count=" << worker.frame_count
+            << " partial=" << worker.partial_movie_file.generic_string() << "\n";
+      }
+    } else if (pipeline.has_value()) {
+      print_pipeline_stats(pipeline->stats(), log);
     }
-    std::cout << "\n";
     return 0;
   }
 
@@ -865,6 +1108,179 @@ int handle_render(const int argc, const char* const argv[]) {
   return 0;
 }
 
+int handle_bench(const int argc, const char* const argv[]) {
+  std::vector<std::string> scene_names;
+  manim_cpp::scene::SceneBenchmarkSettings settings;
+  settings.raster_settings = {.pixel_width = 854, .pixel_height = 480};
+  std::optional<std::filesystem::path> output_path;
+  std::optional<std::filesystem::path> baseline_path;
+  double threshold_percent = 10.0;
+  for (int i = 2; i < argc; ++i) {
+    const std::string token = argv[i];
+    if (is_help_flag(token)) {
+      print_subcommand_help("bench");
+      return 0;
+    }
+    if (token == "--runs") {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for --runs.\n";
+        return 2;
+      }
+      const std::string raw_value = argv[++i];
+      if (!parse_size_strict(raw_value, &settings.runs) || settings.runs == 0) {
+        std::cerr << "Invalid value for --runs: " << raw_value << "\n";
+        return 2;
+      }
+      continue;
+    }
+    if (token == "--resolution") {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for --resolution.\n";
+        return 2;
+      }
+      const auto parsed = manim_cpp::renderer::parse_window_size(argv[++i]);
+      if (!parsed.has_value() || parsed->use_default || parsed->width <= 0 ||
+          parsed->height <= 0) {
+        std::cerr << "Invalid value for --resolution: " << argv[i] << "\n";
+        return 2;
+      }
+      settings.raster_settings.pixel_width = static_cast<std::size_t>(parsed->width);
+      settings.raster_settings.pixel_height = static_cast<std::size_t>(parsed->height);
+      continue;
+    }
+    if (token == "--fps") {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for --fps.\n";
+        return 2;
+      }
+      const std::string raw_value = argv[++i];
+      if (!parse_double_strict(raw_value, &settings.frame_rate) || settings.frame_rate <= 0.0) {
+        std::cerr << "Invalid value for --fps: " << raw_value << "\n";
+        return 2;
+      }
+      continue;
+    }
+    if (token == "--output") {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for --output.\n";
+        return 2;
+      }
+      output_path = std::filesystem::path(argv[++i]);
+      continue;
+    }
+    if (token == "--baseline") {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for --baseline.\n";
+        return 2;
+      }
+      baseline_path = std::filesystem::path(argv[++i]);
+      continue;
+    }
+    if (token == "--threshold") {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for --threshold.\n";
+        return 2;
+      }
+      const std::string raw_value = argv[++i];
+      if (!parse_double_strict(raw_value, &threshold_percent) || threshold_percent < 0.0) {
+        std::cerr << "Invalid value for --threshold: " << raw_value << "\n";
+        return 2;
+      }
+      continue;
+    }
+    if (token.rfind("-", 0) == 0) {
+      std::cerr << "Unknown bench option: " << token << "\n";
+      return 2;
+    }
+    scene_names.push_back(token);
+  }
+
+  // The baseline is read up front so a bad path fails before any rendering.
+  std::optional<manim_cpp::scene::SceneBenchmarkReport> baseline;
+  if (baseline_path.has_value()) {
+    baseline = manim_cpp::scene::read_benchmark_report(baseline_path.value());
+    if (!baseline.has_value()) {
+      std::cerr << "Failed to read benchmark baseline: " << baseline_path.value() << "\n";
+      return 2;
+    }
+  }
+  if (scene_names.empty()) {
+    scene_names = manim_cpp::scene::SceneRegistry::instance().list_scene_names();
+    std::sort(scene_names.begin(), scene_names.end());
+    if (scene_names.empty()) {
+      std::cerr << "No registered scenes to benchmark.\n";
+      return 2;
+    }
+  }
+
+  manim_cpp::scene::SceneBenchmark benchmark(settings);
+  std::cout << std::fixed << std::setprecision(3);
+  for (const auto& scene_name : scene_names) {
+    if (!benchmark.run(scene_name)) {
+      std::cerr << benchmark.error() << "\n";
+      return 2;
+    }
+    const auto& result = benchmark.results().back();
+    std::cout << "Benchmarked " << result.scene_name << ": runs=" << result.runs
+              << " frames=" << result.frames << " median=" << result.median_wall_seconds
+              << "s min=" << result.min_wall_seconds << "s max=" << result.max_wall_seconds
+              << "s fps=" << result.frames_per_second
+              << " peak_rss_mib=" << static_cast<double>(result.peak_rss_bytes) / (1024.0 * 1024.0)
+              << " mesh_cache_hit_rate="
+              << manim_cpp::renderer::MeshCacheStats{.hits = result.mesh_cache_hits,
+                                                     .misses = result.mesh_cache_misses}
+                     .hit_rate()
+              << "\n";
+    for (const auto& stage : result.stages) {
+      std::cout << "  stage " << stage.name << " busy=" << stage.busy_seconds
+                << "s input_wait=" << stage.input_wait_seconds
+                << "s output_wait=" << stage.output_wait_seconds << "s\n";
+    }
+  }
+
+  const manim_cpp::scene::SceneBenchmarkReport report{
+      .pixel_width = settings.raster_settings.pixel_width,
+      .pixel_height = settings.raster_settings.pixel_height,
+      .frame_rate = settings.frame_rate,
+      .scenes = benchmark.results(),
+  };
+  if (output_path.has_value()) {
+    if (!manim_cpp::scene::write_benchmark_report(output_path.value(), report)) {
+      std::cerr << "Failed to write benchmark report: " << output_path.value() << "\n";
+      return 2;
+    }
+    std::cout << "Wrote benchmark report: " << output_path->generic_string() << "\n";
+  }
+  if (!baseline.has_value()) {
+    return 0;
+  }
+
+  const auto comparison =
+      manim_cpp::scene::compare_benchmarks(baseline.value(), report, threshold_percent / 100.0);
+  if (comparison.render_settings_differ) {
+    std::cerr << "Baseline was recorded at " << baseline->pixel_width << "x"
+              << baseline->pixel_height << " " << baseline->frame_rate << "fps, not "
+              << report.pixel_width << "x" << report.pixel_height << " " << report.frame_rate
+              << "fps; its timings are not comparable.\n";
+    return 1;
+  }
+  for (const auto& scene_name : comparison.unmatched_scenes) {
+    std::cout << "Not in baseline: " << scene_name << "\n";
+  }
+  for (const auto& regression : comparison.regressions) {
+    std::cout << "Regression " << regression.scene_name << " " << regression.metric << ": "
+              << regression.baseline << " -> " << regression.current << " ("
+              << std::showpos << regression.change * 100.0 << std::noshowpos << "%)\n";
+  }
+  if (!comparison.passed()) {
+    std::cout << comparison.regressions.size() << " regression(s) over the "
+              << threshold_percent << "% threshold.\n";
+    return 1;
+  }
+  std::cout << "No regressions over the " << threshold_percent << "% threshold.\n";
+  return 0;
+}
+
 int handle_cfg(const int argc, const char* const argv[]) {
   if (argc <= 2 || is_help_flag(argv[2])) {
     print_subcommand_help("cfg");
@@ -912,7 +1328,7 @@ int handle_checkhealth(const int argc, const char* const argv[]) {
               << "\"compiler\":\"" << compiler << "\","
               << "\"npz_writer\":" << (npz_writer ? "true" : "false") << ","
               << "\"renderers\":[\"cairo\",\"opengl\"],"
-              << "\"formats\":[\"png\",\"gif\",\"mp4\",\"webm\",\"mov\"]"
+              << "\"formats\":[\"png\",\"gif\",\"mp4\",\"webm\",\"mov\",\"y4m\"]"
               << "}\n";
     return 0;
   }
@@ -923,7 +1339,7 @@ int handle_checkhealth(const int argc, const char* const argv[]) {
   std::cout << "  compiler: " << compiler << "\n";
   std::cout << "  npz_writer: " << (npz_writer ? "available" : "missing") << "\n";
   std::cout << "  renderers: cairo, opengl\n";
-  std::cout << "  formats: png, gif, mp4, webm, mov\n";
+  std::cout << "  formats: png, gif, mp4, webm, mov, y4m\n";
   return 0;
 }
 
@@ -1051,6 +1467,9 @@ int run_cli(int argc, const char* const argv[]) {
   if (first == "render") {
     return handle_render(argc, argv);
   }
+  if (first == "bench") {
+    return handle_bench(argc, argv);
+  }
   if (first == "cfg") {
     return handle_cfg(argc, argv);
   }
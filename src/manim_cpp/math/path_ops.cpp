@@ -2,6 +2,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <queue>
+#include <set>
+#include <utility>
 
 namespace manim_cpp::math {
 namespace {
@@ -50,6 +55,327 @@ Vec2 intersect_lines(const Vec2& p1, const Vec2& p2, const Vec2& q1, const Vec2&
   };
 }
 
+bool lexicographically_less(const Vec2& a, const Vec2& b) {
+  return a[0] < b[0] || (a[0] == b[0] && a[1] < b[1]);
+}
+
+bool crosses_properly(const Vec2& a0, const Vec2& a1, const Vec2& b0, const Vec2& b1) {
+  const double o1 = orientation(a0, a1, b0);
+  const double o2 = orientation(a0, a1, b1);
+  const double o3 = orientation(b0, b1, a0);
+  const double o4 = orientation(b0, b1, a1);
+  return ((o1 > kEpsilon && o2 < -kEpsilon) || (o1 < -kEpsilon && o2 > kEpsilon)) &&
+         ((o3 > kEpsilon && o4 < -kEpsilon) || (o3 < -kEpsilon && o4 > kEpsilon));
+}
+
+// Sweeps a vertical line left to right over the edges of a closed polygon,
+// keeping the edges it currently cuts ordered bottom to top. Only edges that
+// are neighbours in that order are tested against each other: two edges
+// that meet must be neighbours just before their leftmost common point
+// (Shamos-Hoey). When every intersection is wanted, crossing edges swap
+// places at their crossing point (Bentley-Ottmann). Pairs are tested with
+// segments_intersect(), so touching and overlapping edges count the same way
+// as in the pairwise check; edges sharing a polygon vertex never count.
+class EdgeSweep {
+ public:
+  EdgeSweep(const std::vector<Vec2>& polygon, const bool find_all)
+      : find_all_(find_all), slots_(polygon.size()), positions_(polygon.size()),
+        active_(polygon.size(), false) {
+    edges_.reserve(polygon.size());
+    for (size_t i = 0; i < polygon.size(); ++i) {
+      const Vec2& start = polygon[i];
+      const Vec2& end = polygon[(i + 1) % polygon.size()];
+      const bool reversed = lexicographically_less(end, start);
+      edges_.push_back(Edge{.left = reversed ? end : start, .right = reversed ? start : end});
+      events_.push(Event{.point = edges_[i].left, .kind = EventKind::kInsert, .lower = i});
+      const EventKind removal =
+          edges_[i].left == edges_[i].right ? EventKind::kRemovePoint : EventKind::kRemove;
+      events_.push(Event{.point = edges_[i].right, .kind = removal, .lower = i});
+    }
+  }
+
+  // Returns true once an intersection is found; with find_all, only after
+  // every one has been found.
+  bool run() {
+    while (!events_.empty() && (find_all_ || found_.empty())) {
+      const Event event = events_.top();
+      events_.pop();
+      if (event.point != sweep_point_) {
+        ended_.clear();
+      }
+      sweep_point_ = event.point;
+      switch (event.kind) {
+        case EventKind::kCross:
+          swap(event.lower, event.upper);
+          break;
+        case EventKind::kInsert:
+          insert(event.lower);
+          break;
+        case EventKind::kRemove:
+        case EventKind::kRemovePoint:
+          remove(event.lower);
+          break;
+      }
+    }
+    return !found_.empty();
+  }
+
+  // The intersecting edge pairs, ordered by edge indices.
+  std::vector<PathIntersection> intersections() {
+    std::sort(found_.begin(), found_.end(), [](const auto& a, const auto& b) {
+      return a.first_edge != b.first_edge ? a.first_edge < b.first_edge
+                                          : a.second_edge < b.second_edge;
+    });
+    return std::move(found_);
+  }
+
+ private:
+  // Oriented left to right, so the sweep reaches `left` first.
+  struct Edge {
+    Vec2 left;
+    Vec2 right;
+  };
+
+  // At one point, crossings are resolved first and edges ending there leave
+  // before edges starting there are placed: an ending edge has no position
+  // right of the point to place them against. Zero-length edges start and end
+  // at the same point, so they leave after the inserts.
+  enum class EventKind : uint8_t { kCross, kRemove, kInsert, kRemovePoint };
+
+  struct Event {
+    Vec2 point{};
+    EventKind kind = EventKind::kInsert;
+    // The edge, or for a crossing the edge below the other one.
+    size_t lower = 0;
+    size_t upper = 0;
+  };
+
+  struct EventAfter {
+    bool operator()(const Event& a, const Event& b) const {
+      if (a.point != b.point) {
+        return lexicographically_less(b.point, a.point);
+      }
+      if (a.kind != b.kind) {
+        return a.kind > b.kind;
+      }
+      return a.lower != b.lower ? a.lower > b.lower : a.upper > b.upper;
+    }
+  };
+
+  // A place in the sweep order. Crossing edges trade slots, so the order is
+  // updated without comparing edges whose order is just changing.
+  struct Slot {
+    size_t edge = 0;
+  };
+
+  // Only ever asked to place the slot being inserted against one already in
+  // the order.
+  struct SlotBelow {
+    const EdgeSweep* sweep = nullptr;
+    bool operator()(const Slot* a, const Slot* b) const {
+      if (a == sweep->inserting_) {
+        return sweep->starts_below(a->edge, b->edge);
+      }
+      return !sweep->starts_below(b->edge, a->edge);
+    }
+  };
+
+  using Order = std::multiset<Slot*, SlotBelow>;
+
+  // Whether `edge`, starting at the sweep point, runs below `other`: by the
+  // side of `other` the start lies on, or if it lies on `other` (within
+  // kEpsilon), by direction.
+  [[nodiscard]] bool starts_below(const size_t edge, const size_t other) const {
+    const Edge& e = edges_[edge];
+    const Edge& o = edges_[other];
+    const double side = orientation(o.left, o.right, e.left);
+    if (std::abs(side) > kEpsilon) {
+      return side < 0.0;
+    }
+    const double turn = turn_from(other, edge);
+    if (turn != 0.0) {
+      return turn < 0.0;
+    }
+    return edge < other;
+  }
+
+  // Positive when `edge` points above `other`, i.e. runs above it to the
+  // right of a point they share.
+  [[nodiscard]] double turn_from(const size_t other, const size_t edge) const {
+    const Vec2 e = direction(edge);
+    const Vec2 o = direction(other);
+    return (o[0] * e[1]) - (o[1] * e[0]);
+  }
+
+  // Zero-length edges point straight up like vertical ones, so they sort
+  // consistently among the edges through their point.
+  [[nodiscard]] Vec2 direction(const size_t edge) const {
+    const Edge& e = edges_[edge];
+    if (e.left == e.right) {
+      return Vec2{0.0, 1.0};
+    }
+    return Vec2{e.right[0] - e.left[0], e.right[1] - e.left[1]};
+  }
+
+  [[nodiscard]] bool adjacent(const size_t a, const size_t b) const {
+    const size_t count = edges_.size();
+    return a == b || (a + 1) % count == b || (b + 1) % count == a;
+  }
+
+  [[nodiscard]] bool touch(const size_t a, const size_t b) const {
+    return segments_intersect(edges_[a].left, edges_[a].right, edges_[b].left, edges_[b].right);
+  }
+
+  // Tests two edges that are (nearly) neighbours in the order, `lower` below
+  // `upper`. Returns whether the edges beyond them must be tested too: past
+  // an edge sharing a vertex, or past one meeting the other edge, since
+  // further edges may meet it at the same point.
+  bool test(const size_t lower, const size_t upper) {
+    if (adjacent(lower, upper)) {
+      return true;
+    }
+    if (!touch(lower, upper)) {
+      return false;
+    }
+    const Edge& a = edges_[lower];
+    const Edge& b = edges_[upper];
+    const bool crossing = crosses_properly(a.left, a.right, b.left, b.right);
+    Vec2 point = crossing ? intersect_lines(a.left, a.right, b.left, b.right) : a.left;
+    if (!crossing) {
+      for (const Vec2* candidate : {&a.left, &a.right}) {
+        if (on_segment(b.left, b.right, *candidate)) {
+          point = *candidate;
+        }
+      }
+      for (const Vec2* candidate : {&b.left, &b.right}) {
+        if (on_segment(a.left, a.right, *candidate)) {
+          point = *candidate;
+        }
+      }
+    }
+    record(lower, upper, point);
+    // Edges that crossed already run apart; rounding may put the crossing
+    // behind the sweep, in which case it is handled right away.
+    if (find_all_ && crossing && turn_from(upper, lower) > 0.0) {
+      const Vec2 at = lexicographically_less(point, sweep_point_) ? sweep_point_ : point;
+      events_.push(Event{.point = at, .kind = EventKind::kCross, .lower = lower, .upper = upper});
+    }
+    return true;
+  }
+
+  void record(const size_t a, const size_t b, const Vec2& point) {
+    const auto key = std::minmax(a, b);
+    if (reported_.insert(key).second) {
+      found_.push_back(PathIntersection{.first_edge = key.first, .second_edge = key.second,
+                                        .point = point});
+    }
+  }
+
+  // Tests `edge` against the edges above it (or below it), moving on while
+  // test() asks to.
+  void test_upwards(const size_t edge, Order::iterator above) {
+    for (; above != order_.end() && test(edge, (*above)->edge); ++above) {
+      if (!find_all_ && !found_.empty()) {
+        return;
+      }
+    }
+  }
+
+  void test_downwards(const size_t edge, Order::iterator at) {
+    while (at != order_.begin()) {
+      --at;
+      if (!test((*at)->edge, edge) || (!find_all_ && !found_.empty())) {
+        return;
+      }
+    }
+  }
+
+  void insert(const size_t edge) {
+    Slot* slot = &slots_[edge];
+    slot->edge = edge;
+    inserting_ = slot;
+    const auto at = order_.insert(slot);
+    inserting_ = nullptr;
+    positions_[edge] = at;
+    active_[edge] = true;
+    test_upwards(edge, std::next(at));
+    test_downwards(edge, at);
+    // Edges that ended at this point are out of the order already.
+    for (const size_t ended : ended_) {
+      if (!find_all_ && !found_.empty()) {
+        return;
+      }
+      test(ended, edge);
+    }
+  }
+
+  void remove(const size_t edge) {
+    const auto at = positions_[edge];
+    // Edges meeting this one where it ends.
+    test_upwards(edge, std::next(at));
+    test_downwards(edge, at);
+    if (!find_all_ && !found_.empty()) {
+      return;
+    }
+    const auto below = at == order_.begin() ? order_.end() : std::prev(at);
+    const auto above = std::next(at);
+    order_.erase(at);
+    active_[edge] = false;
+    ended_.push_back(edge);
+    if (below == order_.end() || above == order_.end()) {
+      return;
+    }
+    // Edges sharing a vertex with the new neighbours may sit between the
+    // ones that actually meet, so a few steps each way are tested.
+    constexpr int kReach = 3;
+    auto lower = below;
+    for (int i = 0; i < kReach; ++i) {
+      auto upper = above;
+      for (int j = 0; j < kReach && upper != order_.end(); ++j, ++upper) {
+        test((*lower)->edge, (*upper)->edge);
+        if (!find_all_ && !found_.empty()) {
+          return;
+        }
+      }
+      if (lower == order_.begin()) {
+        break;
+      }
+      --lower;
+    }
+  }
+
+  void swap(const size_t lower, const size_t upper) {
+    if (!active_[lower] || !active_[upper]) {
+      return;
+    }
+    const auto lower_at = positions_[lower];
+    const auto upper_at = positions_[upper];
+    if (std::next(lower_at) != upper_at) {
+      // Already swapped, or no longer neighbours.
+      return;
+    }
+    std::swap((*lower_at)->edge, (*upper_at)->edge);
+    std::swap(positions_[lower], positions_[upper]);
+    test_downwards(upper, positions_[upper]);
+    test_upwards(lower, std::next(positions_[lower]));
+  }
+
+  const bool find_all_;
+  std::vector<Edge> edges_;
+  std::priority_queue<Event, std::vector<Event>, EventAfter> events_;
+  std::vector<Slot> slots_;
+  Order order_{SlotBelow{this}};
+  std::vector<Order::iterator> positions_;
+  // Whether the edge is in the order, i.e. positions_ is valid.
+  std::vector<bool> active_;
+  const Slot* inserting_ = nullptr;
+  Vec2 sweep_point_{};
+  // Edges that ended at sweep_point_.
+  std::vector<size_t> ended_;
+  std::set<std::pair<size_t, size_t>> reported_;
+  std::vector<PathIntersection> found_;
+};
+
 }  // namespace
 
 bool segments_intersect(const Vec2& a0, const Vec2& a1, const Vec2& b0, const Vec2& b1) {
@@ -106,26 +432,16 @@ bool has_self_intersections(const std::vector<Vec2>& polygon) {
   if (polygon.size() < 4) {
     return false;
   }
+  return EdgeSweep(polygon, false).run();
+}
 
-  const size_t edge_count = polygon.size();
-  for (size_t i = 0; i < edge_count; ++i) {
-    const auto& a0 = polygon[i];
-    const auto& a1 = polygon[(i + 1) % edge_count];
-
-    for (size_t j = i + 1; j < edge_count; ++j) {
-      if (i == j || (i + 1) % edge_count == j || i == (j + 1) % edge_count) {
-        continue;
-      }
-
-      const auto& b0 = polygon[j];
-      const auto& b1 = polygon[(j + 1) % edge_count];
-      if (segments_intersect(a0, a1, b0, b1)) {
-        return true;
-      }
-    }
+std::vector<PathIntersection> find_self_intersections(const std::vector<Vec2>& polygon) {
+  if (polygon.size() < 4) {
+    return {};
   }
-
-  return false;
+  EdgeSweep sweep(polygon, true);
+  sweep.run();
+  return sweep.intersections();
 }
 
 double polygon_signed_area(const std::vector<Vec2>& polygon) {
@@ -0,0 +1,709 @@
+#include "manim_cpp/math/polygon_boolean.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <numbers>
+#include <queue>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace manim_cpp::math {
+namespace {
+
+// Twice the signed area of a, b, c; positive when c lies left of a -> b. The
+// sweep only ever looks at exact signs, so its decisions agree with each
+// other even where rounding makes them slightly wrong.
+double orientation(const Vec2& a, const Vec2& b, const Vec2& c) {
+  return (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+}
+
+bool lexicographically_less(const Vec2& a, const Vec2& b) {
+  return a[0] < b[0] || (a[0] == b[0] && a[1] < b[1]);
+}
+
+// How far, relative to the largest input coordinate, a vertex may lie off an
+// edge and still split it: several rounding errors, far below anything drawn.
+constexpr double kSnapDistance = 1e-12;
+
+enum class EdgeType : uint8_t {
+  kNormal,
+  // Edges of both regions that overlap are kept once: the lower one does not
+  // contribute, and the upper one records whether the regions lie on the same
+  // side of it.
+  kNonContributing,
+  kSameTransition,
+  kDifferentTransition,
+};
+
+struct SweepEvent;
+
+// Whether `a` runs below `b` where the sweep line meets them. Only asked to
+// place an edge being inserted, or an edge against its neighbours.
+struct SegmentBelow {
+  using is_transparent = void;
+
+  bool operator()(const SweepEvent* a, const SweepEvent* b) const;
+  // Against a point on the sweep line, for lower_bound().
+  bool operator()(const SweepEvent* a, const Vec2& point) const;
+};
+
+using Status = std::set<SweepEvent*, SegmentBelow>;
+
+// One endpoint of an edge; the edge is found through either endpoint, and
+// its flags are kept on the left one.
+struct SweepEvent {
+  Vec2 point{};
+  bool left = false;
+  SweepEvent* other = nullptr;
+  bool subject = false;
+  // Creation order, to break ties between otherwise equal events.
+  std::size_t id = 0;
+  EdgeType type = EdgeType::kNormal;
+  // Whether crossing the edge upwards leaves its own region.
+  bool in_out = false;
+  // Whether the region just above the edge lies outside the other region.
+  bool other_in_out = false;
+  bool in_result = false;
+  // The input edge this one was split from, left end first. Edges are
+  // compared through it, so all pieces of an edge lie on one exact line.
+  Vec2 line_start{};
+  Vec2 line_end{};
+  // +1 when the result lies above the edge, -1 when it lies below. Vertical
+  // edges count their left side as above.
+  int result_transition = 0;
+  Status::iterator position;
+};
+
+// Whether the edge of `event` runs below `point`.
+bool below(const SweepEvent* event, const Vec2& point) {
+  return orientation(event->line_start, event->line_end, point) > 0.0;
+}
+
+bool vertical(const SweepEvent* event) {
+  return event->line_start[0] == event->line_end[0];
+}
+
+bool collinear(const SweepEvent* a, const SweepEvent* b) {
+  return orientation(a->line_start, a->line_end, b->line_start) == 0.0 &&
+         orientation(a->line_start, a->line_end, b->line_end) == 0.0;
+}
+
+// Sweep order: left to right, bottom to top; at one point edges end before
+// others start there, and lower edges go first.
+bool processed_after(const SweepEvent* a, const SweepEvent* b) {
+  if (a->point[0] != b->point[0]) {
+    return a->point[0] > b->point[0];
+  }
+  if (a->point[1] != b->point[1]) {
+    return a->point[1] > b->point[1];
+  }
+  if (a->left != b->left) {
+    return a->left;
+  }
+  // The same order as in the status, so edges are inserted bottom to top.
+  if (!collinear(a, b) && (below(a, b->other->point) || below(b, a->other->point))) {
+    return !below(a, b->other->point);
+  }
+  if (a->subject != b->subject) {
+    return !a->subject;
+  }
+  return a->id > b->id;
+}
+
+struct EventAfter {
+  bool operator()(const SweepEvent* a, const SweepEvent* b) const { return processed_after(a, b); }
+};
+
+bool SegmentBelow::operator()(const SweepEvent* a, const SweepEvent* b) const {
+  if (a == b) {
+    return false;
+  }
+  if (!collinear(a, b)) {
+    if (a->point == b->point) {
+      // Slivers between crossings rounded apart can end together too.
+      if (below(a, b->other->point) || below(b, a->other->point)) {
+        return below(a, b->other->point);
+      }
+      return a->subject != b->subject ? a->subject : a->id < b->id;
+    }
+    if (a->point[0] == b->point[0]) {
+      return a->point[1] < b->point[1];
+    }
+    // Compare at the left end of whichever edge starts later.
+    if (processed_after(a, b)) {
+      return !below(b, a->point);
+    }
+    return below(a, b->point);
+  }
+  // Collinear edges: the subject's below the clip's, otherwise in sweep
+  // order.
+  if (a->subject != b->subject) {
+    return a->subject;
+  }
+  if (a->point == b->point) {
+    return a->id < b->id;
+  }
+  return processed_after(a, b);
+}
+
+bool SegmentBelow::operator()(const SweepEvent* a, const Vec2& point) const {
+  return below(a, point);
+}
+
+// Where segments a0-a1 and b0-b1, on lines that are not the same, meet. Ends
+// are returned exactly, so the edges can tell they meet there; a crossing
+// elsewhere is only approximate.
+bool segments_meet(const Vec2& a0, const Vec2& a1, const Vec2& b0, const Vec2& b1, Vec2& point) {
+  const Vec2 va = {a1[0] - a0[0], a1[1] - a0[1]};
+  const Vec2 vb = {b1[0] - b0[0], b1[1] - b0[1]};
+  const Vec2 e = {b0[0] - a0[0], b0[1] - a0[1]};
+  const double cross = va[0] * vb[1] - va[1] * vb[0];
+  // Parallel pieces of different lines are slivers left by rounding.
+  if (cross == 0.0) {
+    return false;
+  }
+  const double s = (e[0] * vb[1] - e[1] * vb[0]) / cross;
+  const double t = (e[0] * va[1] - e[1] * va[0]) / cross;
+  if (s < 0.0 || s > 1.0 || t < 0.0 || t > 1.0) {
+    return false;
+  }
+  if (s == 0.0 || s == 1.0) {
+    point = s == 0.0 ? a0 : a1;
+  } else if (t == 0.0 || t == 1.0) {
+    point = t == 0.0 ? b0 : b1;
+  } else {
+    point = Vec2{a0[0] + s * va[0], a0[1] + s * va[1]};
+  }
+  return true;
+}
+
+// Martinez-Rueda-Feito: sweeps both regions' edges left to right, splitting
+// them where they meet, and decides for each piece, from the edge below it,
+// whether it bounds the result.
+class PolygonClipper {
+ public:
+  PolygonClipper(const std::vector<std::vector<Vec2>>& subject,
+                 const std::vector<std::vector<Vec2>>& clip,
+                 const BooleanOperation operation)
+      : operation_(operation) {
+    for (const auto& ring : subject) {
+      add_ring(ring, true, subject_bounds_);
+    }
+    for (const auto& ring : clip) {
+      add_ring(ring, false, clip_bounds_);
+    }
+    double extent = 0.0;
+    for (const Bounds& bounds : {subject_bounds_, clip_bounds_}) {
+      if (bounds.min_x <= bounds.max_x) {
+        extent = std::max({extent, std::abs(bounds.min_x), std::abs(bounds.max_x),
+                           std::abs(bounds.min_y), std::abs(bounds.max_y)});
+      }
+    }
+    snap_distance_ = kSnapDistance * extent;
+  }
+
+  std::vector<std::vector<Vec2>> run() {
+    const bool has_subject = subject_bounds_.min_x <= subject_bounds_.max_x;
+    const bool has_clip = clip_bounds_.min_x <= clip_bounds_.max_x;
+    if (!has_subject && operation_ != BooleanOperation::kUnion &&
+        operation_ != BooleanOperation::kXor) {
+      return {};
+    }
+    if (operation_ == BooleanOperation::kIntersection &&
+        (!has_clip || !subject_bounds_.overlaps(clip_bounds_))) {
+      return {};
+    }
+
+    // Past this, no edge can bound the result.
+    double stop_x = std::numeric_limits<double>::infinity();
+    if (operation_ == BooleanOperation::kIntersection) {
+      stop_x = std::min(subject_bounds_.max_x, clip_bounds_.max_x);
+    } else if (operation_ == BooleanOperation::kDifference) {
+      stop_x = subject_bounds_.max_x;
+    }
+
+    bool started = false;
+    Vec2 sweep_point{};
+    while (!queue_.empty() && queue_.top()->point[0] <= stop_x) {
+      SweepEvent* event = queue_.top();
+      if (!started || event->point != sweep_point) {
+        // The split edges end at this point, so their events may come first.
+        started = true;
+        sweep_point = event->point;
+        split_edges_through(sweep_point);
+        continue;
+      }
+      queue_.pop();
+      if (event->left) {
+        insert(event);
+      } else {
+        remove(event->other);
+      }
+    }
+    return connect();
+  }
+
+ private:
+  struct PointLess {
+    bool operator()(const Vec2& a, const Vec2& b) const { return lexicographically_less(a, b); }
+  };
+
+  struct DirectedEdge {
+    Vec2 from;
+    Vec2 to;
+  };
+
+  struct Bounds {
+    double min_x = std::numeric_limits<double>::infinity();
+    double min_y = std::numeric_limits<double>::infinity();
+    double max_x = -std::numeric_limits<double>::infinity();
+    double max_y = -std::numeric_limits<double>::infinity();
+
+    [[nodiscard]] bool overlaps(const Bounds& other) const {
+      return min_x <= other.max_x && other.min_x <= max_x && min_y <= other.max_y &&
+             other.min_y <= max_y;
+    }
+  };
+
+  void add_ring(const std::vector<Vec2>& ring, const bool subject, Bounds& bounds) {
+    if (ring.size() < 3) {
+      return;
+    }
+    for (std::size_t i = 0; i < ring.size(); ++i) {
+      const Vec2& start = ring[i];
+      const Vec2& end = ring[(i + 1) % ring.size()];
+      if (start == end) {
+        continue;
+      }
+      const bool forward = lexicographically_less(start, end);
+      const Vec2& line_start = forward ? start : end;
+      const Vec2& line_end = forward ? end : start;
+      SweepEvent* first = make_event(start, forward, nullptr, subject, line_start, line_end);
+      SweepEvent* second = make_event(end, !forward, first, subject, line_start, line_end);
+      first->other = second;
+      queue_.push(first);
+      queue_.push(second);
+      vertices_.insert(start);
+      bounds.min_x = std::min({bounds.min_x, start[0], end[0]});
+      bounds.min_y = std::min({bounds.min_y, start[1], end[1]});
+      bounds.max_x = std::max({bounds.max_x, start[0], end[0]});
+      bounds.max_y = std::max({bounds.max_y, start[1], end[1]});
+    }
+  }
+
+  SweepEvent* make_event(const Vec2& point, const bool left, SweepEvent* other,
+                         const bool subject, const Vec2& line_start, const Vec2& line_end) {
+    SweepEvent& event = events_.emplace_back();
+    event.point = point;
+    event.left = left;
+    event.other = other;
+    event.subject = subject;
+    event.id = events_.size();
+    event.line_start = line_start;
+    event.line_end = line_end;
+    return &event;
+  }
+
+  void insert(SweepEvent* event) {
+    const auto at = status_.insert(event).first;
+    event->position = at;
+    const auto prev = at == status_.begin() ? status_.end() : std::prev(at);
+    const auto next = std::next(at);
+    compute_fields(event, prev);
+    // Overlapping edges change their types, so their fields are redone.
+    if (next != status_.end() && possible_intersection(event, *next) == 2) {
+      compute_fields(event, prev);
+      compute_fields(*next, at);
+    }
+    if (prev != status_.end() && possible_intersection(*prev, event) == 2) {
+      const auto prev_prev = prev == status_.begin() ? status_.end() : std::prev(prev);
+      compute_fields(*prev, prev_prev);
+      compute_fields(event, prev);
+    }
+  }
+
+  void remove(SweepEvent* left) {
+    const auto at = left->position;
+    const auto prev = at == status_.begin() ? status_.end() : std::prev(at);
+    const auto next = std::next(at);
+    status_.erase(at);
+    if (prev != status_.end() && next != status_.end()) {
+      possible_intersection(*prev, *next);
+    }
+  }
+
+  // Splits the edges passing through `point`, a vertex the sweep is about to
+  // reach. An edge found to pass through it only once the edges there are
+  // being inserted would be split too late: the edges above it would already
+  // have taken their flags from its unsplit left piece. Edges missing the
+  // point by rounding (kSnapDistance relative to the input's extent) are
+  // split there as well, so a crossing computed twice meets at one point.
+  void split_edges_through(const Vec2& point) {
+    const auto passes = [&](const SweepEvent* left) {
+      const Vec2 d = {left->line_end[0] - left->line_start[0],
+                      left->line_end[1] - left->line_start[1]};
+      return std::abs(orientation(left->line_start, left->line_end, point)) <=
+             snap_distance_ * std::hypot(d[0], d[1]);
+    };
+    auto first = status_.lower_bound(point);
+    while (first != status_.begin() && passes(*std::prev(first))) {
+      --first;
+    }
+    std::vector<SweepEvent*> through;
+    for (auto it = first; it != status_.end() && passes(*it); ++it) {
+      through.push_back(*it);
+    }
+    for (SweepEvent* left : through) {
+      divide(left, point);
+    }
+  }
+
+  // Derives the edge's flags from the edge just below it, `prev`.
+  void compute_fields(SweepEvent* event, const Status::iterator prev) {
+    if (prev == status_.end()) {
+      event->in_out = false;
+      event->other_in_out = true;
+    } else {
+      // Past a vertical edge the region below is on its right, while its
+      // flags describe its left, so it is not crossed; an overlapping
+      // vertical edge shares its left.
+      const bool crossed = !vertical(*prev) || vertical(event);
+      if ((*prev)->subject == event->subject) {
+        event->in_out = crossed != (*prev)->in_out;
+        event->other_in_out = (*prev)->other_in_out;
+      } else {
+        event->in_out = !(*prev)->other_in_out;
+        event->other_in_out = crossed == (*prev)->in_out;
+      }
+    }
+    event->in_result = in_result(event);
+    event->result_transition = event->in_result ? result_transition(event) : 0;
+  }
+
+  [[nodiscard]] bool in_result(const SweepEvent* event) const {
+    switch (event->type) {
+      case EdgeType::kNormal:
+        switch (operation_) {
+          case BooleanOperation::kIntersection:
+            return !event->other_in_out;
+          case BooleanOperation::kUnion:
+            return event->other_in_out;
+          case BooleanOperation::kDifference:
+            return event->subject == event->other_in_out;
+          case BooleanOperation::kXor:
+            return true;
+        }
+        return false;
+      case EdgeType::kSameTransition:
+        return operation_ == BooleanOperation::kIntersection ||
+               operation_ == BooleanOperation::kUnion;
+      case EdgeType::kDifferentTransition:
+        return operation_ == BooleanOperation::kDifference;
+      case EdgeType::kNonContributing:
+        return false;
+    }
+    return false;
+  }
+
+  [[nodiscard]] int result_transition(const SweepEvent* event) const {
+    const bool this_in = !event->in_out;
+    const bool that_in = !event->other_in_out;
+    bool inside = false;
+    switch (operation_) {
+      case BooleanOperation::kIntersection:
+        inside = this_in && that_in;
+        break;
+      case BooleanOperation::kUnion:
+        inside = this_in || that_in;
+        break;
+      case BooleanOperation::kDifference:
+        inside = event->subject ? this_in && !that_in : that_in && !this_in;
+        break;
+      case BooleanOperation::kXor:
+        inside = this_in != that_in;
+        break;
+    }
+    return inside ? 1 : -1;
+  }
+
+  // Splits the edges of `lower` and `upper` (neighbours in the status) where
+  // they meet. Returns 2 when they overlap from a shared left end, and so
+  // have just been given their overlap types.
+  int possible_intersection(SweepEvent* lower, SweepEvent* upper) {
+    const bool same_region = lower->subject == upper->subject;
+    if (!collinear(lower, upper)) {
+      Vec2 point{};
+      if (!segments_meet(lower->point, lower->other->point, upper->point, upper->other->point,
+                         point)) {
+        return 0;
+      }
+      const std::array ends = {&lower->point, &lower->other->point, &upper->point,
+                               &upper->other->point};
+      if (std::none_of(ends.begin(), ends.end(),
+                       [&](const Vec2* end) { return *end == point; })) {
+        point = snap(line_crossing(lower, upper));
+      }
+      // Splitting only one of them would leave the other crossing its
+      // pieces; a crossing rounded off an edge is left alone.
+      if (!contains(lower, point) || !contains(upper, point)) {
+        return 0;
+      }
+      // Meeting at an end of both edges needs no split.
+      if (lower->point == upper->point || lower->other->point == upper->other->point) {
+        return 0;
+      }
+      if (lower->point != point && lower->other->point != point) {
+        divide(lower, point);
+      }
+      if (upper->point != point && upper->other->point != point) {
+        divide(upper, point);
+      }
+      return 1;
+    }
+    // Pieces of one line overlap unless one ends before the other starts.
+    if (!lexicographically_less(lower->point, upper->other->point) ||
+        !lexicographically_less(upper->point, lower->other->point)) {
+      return 0;
+    }
+
+    const bool left_shared = lower->point == upper->point;
+    const bool right_shared = lower->other->point == upper->other->point;
+    // The overlap's endpoints in sweep order, shared ends left out.
+    std::vector<SweepEvent*> ends;
+    if (!left_shared) {
+      ends.push_back(processed_after(lower, upper) ? upper : lower);
+      ends.push_back(ends.back() == upper ? lower : upper);
+    }
+    if (!right_shared) {
+      const bool swapped = processed_after(lower->other, upper->other);
+      ends.push_back(swapped ? upper->other : lower->other);
+      ends.push_back(swapped ? lower->other : upper->other);
+    }
+
+    if (left_shared) {
+      if (same_region) {
+        // Overlapping edges of one region cancel out under the even-odd
+        // rule; they are only split like the others.
+        if (!right_shared) {
+          divide(ends[1]->other, ends[0]->point);
+        }
+        return 0;
+      }
+      lower->type = EdgeType::kNonContributing;
+      upper->type = lower->in_out == upper->in_out ? EdgeType::kSameTransition
+                                                   : EdgeType::kDifferentTransition;
+      if (!right_shared) {
+        // Cut the longer edge where the shorter one ends.
+        divide(ends[1]->other, ends[0]->point);
+      }
+      return 2;
+    }
+    if (right_shared) {
+      divide(ends[0], ends[1]->point);
+      return 3;
+    }
+    if (ends[0] != ends[3]->other) {
+      // Neither edge contains the other.
+      divide(ends[0], ends[1]->point);
+      divide(ends[1], ends[2]->point);
+      return 3;
+    }
+    // One edge contains the other.
+    divide(ends[0], ends[1]->point);
+    divide(ends[3]->other, ends[2]->point);
+    return 3;
+  }
+
+  // Where the input edges of `a` and `b` cross, computed the same way
+  // whichever of them is split, so pieces of both meet at one point.
+  static Vec2 line_crossing(const SweepEvent* a, const SweepEvent* b) {
+    if (lexicographically_less(b->line_start, a->line_start) ||
+        (a->line_start == b->line_start && lexicographically_less(b->line_end, a->line_end))) {
+      std::swap(a, b);
+    }
+    const Vec2 va = {a->line_end[0] - a->line_start[0], a->line_end[1] - a->line_start[1]};
+    const Vec2 vb = {b->line_end[0] - b->line_start[0], b->line_end[1] - b->line_start[1]};
+    const Vec2 e = {b->line_start[0] - a->line_start[0], b->line_start[1] - a->line_start[1]};
+    const double s = (e[0] * vb[1] - e[1] * vb[0]) / (va[0] * vb[1] - va[1] * vb[0]);
+    // Kept within both edges' bounds, so a crossing on a vertical or
+    // horizontal edge lies exactly on it rather than behind the sweep.
+    const auto clamp = [&](const double value, const int axis) {
+      const double low = std::max(std::min(a->line_start[axis], a->line_end[axis]),
+                                  std::min(b->line_start[axis], b->line_end[axis]));
+      const double high = std::min(std::max(a->line_start[axis], a->line_end[axis]),
+                                   std::max(b->line_start[axis], b->line_end[axis]));
+      return std::min(std::max(value, low), high);
+    };
+    return Vec2{clamp(a->line_start[0] + s * va[0], 0), clamp(a->line_start[1] + s * va[1], 1)};
+  }
+
+  // Whether `point` lies between the ends of the edge of `left`, in sweep
+  // order.
+  static bool contains(const SweepEvent* left, const Vec2& point) {
+    return !lexicographically_less(point, left->point) &&
+           !lexicographically_less(left->other->point, point);
+  }
+
+  // A vertex already swept or queued within snap_distance_ of `point`, else
+  // `point`, now a vertex too. Where three edges cross at one point, the
+  // crossings of each pair then agree instead of leaving slivers between.
+  Vec2 snap(const Vec2& point) {
+    const Vec2 from = {point[0] - snap_distance_, -std::numeric_limits<double>::infinity()};
+    for (auto it = vertices_.lower_bound(from);
+         it != vertices_.end() && (*it)[0] <= point[0] + snap_distance_; ++it) {
+      if (std::hypot((*it)[0] - point[0], (*it)[1] - point[1]) <= snap_distance_) {
+        return *it;
+      }
+    }
+    vertices_.insert(point);
+    return point;
+  }
+
+  // Splits the edge of `left` at `point`; the left piece keeps `left` and its
+  // place in the status, the right piece is swept when the sweep reaches it.
+  void divide(SweepEvent* left, const Vec2& point) {
+    // A crossing rounded onto or past an end would turn a piece around.
+    if (!lexicographically_less(left->point, point) ||
+        !lexicographically_less(point, left->other->point)) {
+      return;
+    }
+    SweepEvent* right_end =
+        make_event(point, false, left, left->subject, left->line_start, left->line_end);
+    SweepEvent* right_start =
+        make_event(point, true, left->other, left->subject, left->line_start, left->line_end);
+    left->other->other = right_start;
+    left->other = right_end;
+    queue_.push(right_start);
+    queue_.push(right_end);
+  }
+
+  // Chains the result edges into rings. Each edge is directed with the result
+  // on its left, so rings come out counter-clockwise around filled areas and
+  // clockwise around holes.
+  [[nodiscard]] std::vector<std::vector<Vec2>> connect() const {
+    std::vector<DirectedEdge> edges;
+    for (const SweepEvent& event : events_) {
+      if (!event.left || !event.in_result) {
+        continue;
+      }
+      if (event.result_transition > 0) {
+        edges.push_back(DirectedEdge{.from = event.point, .to = event.other->point});
+      } else {
+        edges.push_back(DirectedEdge{.from = event.other->point, .to = event.point});
+      }
+    }
+    std::sort(edges.begin(), edges.end(), [](const DirectedEdge& a, const DirectedEdge& b) {
+      return lexicographically_less(a.from, b.from);
+    });
+
+    std::vector<std::vector<Vec2>> rings;
+    std::vector<bool> used(edges.size(), false);
+    for (std::size_t start = 0; start < edges.size(); ++start) {
+      if (used[start]) {
+        continue;
+      }
+      std::vector<Vec2> ring;
+      std::size_t current = start;
+      while (true) {
+        used[current] = true;
+        ring.push_back(edges[current].from);
+        const Vec2& at = edges[current].to;
+        if (at == edges[start].from) {
+          break;
+        }
+        current = next_edge(edges, used, current);
+        if (current == edges.size()) {
+          break;
+        }
+      }
+      remove_collinear(ring);
+      if (ring.size() >= 3) {
+        rings.push_back(std::move(ring));
+      }
+    }
+    return rings;
+  }
+
+  // Of the unused edges leaving where `edge` ends, the one turning most
+  // sharply to the right: where result areas touch at a vertex, each ring
+  // then stays around its own area. edges.size() if there is none.
+  static std::size_t next_edge(const std::vector<DirectedEdge>& edges,
+                               const std::vector<bool>& used, const std::size_t edge) {
+    const Vec2& at = edges[edge].to;
+    const auto first = std::lower_bound(
+        edges.begin(), edges.end(), at,
+        [](const DirectedEdge& a, const Vec2& point) { return lexicographically_less(a.from, point); });
+    const Vec2 back = {edges[edge].from[0] - at[0], edges[edge].from[1] - at[1]};
+    std::size_t best = edges.size();
+    double best_turn = 0.0;
+    for (auto it = first; it != edges.end() && it->from == at; ++it) {
+      const auto index = static_cast<std::size_t>(std::distance(edges.begin(), it));
+      if (used[index]) {
+        continue;
+      }
+      const Vec2 out = {it->to[0] - at[0], it->to[1] - at[1]};
+      // Clockwise angle from `back` to `out`, in (0, 2 pi].
+      double turn = std::atan2(out[0] * back[1] - out[1] * back[0],
+                               out[0] * back[0] + out[1] * back[1]);
+      if (turn <= 0.0) {
+        turn += 2.0 * std::numbers::pi;
+      }
+      if (best == edges.size() || turn < best_turn) {
+        best = index;
+        best_turn = turn;
+      }
+    }
+    return best;
+  }
+
+  // Drops vertices in the middle of straight runs, which edges split at
+  // crossings elsewhere leave behind.
+  static void remove_collinear(std::vector<Vec2>& ring) {
+    std::vector<Vec2> kept;
+    kept.reserve(ring.size());
+    for (const Vec2& point : ring) {
+      while (kept.size() >= 2 &&
+             orientation(kept[kept.size() - 2], kept.back(), point) == 0.0) {
+        kept.pop_back();
+      }
+      kept.push_back(point);
+    }
+    std::size_t front = 0;
+    while (kept.size() - front >= 3) {
+      if (orientation(kept[kept.size() - 2], kept.back(), kept[front]) == 0.0) {
+        kept.pop_back();
+      } else if (orientation(kept.back(), kept[front], kept[front + 1]) == 0.0) {
+        ++front;
+      } else {
+        break;
+      }
+    }
+    ring.assign(kept.begin() + static_cast<std::ptrdiff_t>(front), kept.end());
+  }
+
+  const BooleanOperation operation_;
+  // A deque, so events stay put while more are added.
+  std::deque<SweepEvent> events_;
+  std::priority_queue<SweepEvent*, std::vector<SweepEvent*>, EventAfter> queue_;
+  Status status_;
+  std::set<Vec2, PointLess> vertices_;
+  Bounds subject_bounds_;
+  Bounds clip_bounds_;
+  double snap_distance_ = 0.0;
+};
+
+}  // namespace
+
+std::vector<std::vector<Vec2>> polygon_boolean(const std::vector<std::vector<Vec2>>& subject,
+                                               const std::vector<std::vector<Vec2>>& clip,
+                                               const BooleanOperation operation) {
+  return PolygonClipper(subject, clip, operation).run();
+}
+
+}  // namespace manim_cpp::math
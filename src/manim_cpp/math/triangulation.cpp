@@ -1,16 +1,136 @@
 #include "manim_cpp/math/triangulation.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <deque>
+#include <limits>
 #include <vector>
 
 namespace manim_cpp::math {
 namespace {
 
-constexpr double kEpsilon = 1e-12;
+// Polygons with more vertices than this look for ear blockers through the
+// z-order index instead of walking the whole ring.
+constexpr std::size_t kZOrderHashThreshold = 80;
 
-double cross(const Vec2& a, const Vec2& b, const Vec2& c) {
-  return (b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]);
+// A polygon vertex in a circular doubly linked ring. Clipping an ear unlinks
+// one node in O(1); nodes are never freed until the triangulation is done.
+struct Node {
+  uint32_t index = 0;
+  double x = 0.0;
+  double y = 0.0;
+  Node* prev = nullptr;
+  Node* next = nullptr;
+  // Position on the z-order curve and the neighbours in that order, so the
+  // vertices near an ear can be found without scanning the ring.
+  int32_t z = 0;
+  Node* prev_z = nullptr;
+  Node* next_z = nullptr;
+  // Set on a single-vertex hole so filter_points() keeps it; the copies made
+  // by split_polygon() always clear it.
+  bool steiner = false;
+  bool removed = false;
+  // The ear-clipping sweep that will next test this vertex.
+  uint64_t queued_sweep = 0;
+};
+
+// Twice the signed area of p, q, r; negative for a convex (left) turn on the
+// counter-clockwise rings built here.
+double area(const Node* p, const Node* q, const Node* r) {
+  return (q->y - p->y) * (r->x - q->x) - (q->x - p->x) * (r->y - q->y);
+}
+
+bool equals(const Node* a, const Node* b) {
+  return a->x == b->x && a->y == b->y;
+}
+
+int sign(const double value) {
+  return (value > 0.0) - (value < 0.0);
+}
+
+bool point_in_triangle(const double ax, const double ay, const double bx, const double by,
+                       const double cx, const double cy, const double px, const double py) {
+  return (cx - px) * (ay - py) >= (ax - px) * (cy - py) &&
+         (ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+         (bx - px) * (cy - py) >= (cx - px) * (by - py);
+}
+
+// q lies on segment pr, given that the three points are collinear.
+bool on_segment(const Node* p, const Node* q, const Node* r) {
+  return q->x <= std::max(p->x, r->x) && q->x >= std::min(p->x, r->x) &&
+         q->y <= std::max(p->y, r->y) && q->y >= std::min(p->y, r->y);
+}
+
+bool intersects(const Node* p1, const Node* q1, const Node* p2, const Node* q2) {
+  const int o1 = sign(area(p1, q1, p2));
+  const int o2 = sign(area(p1, q1, q2));
+  const int o3 = sign(area(p2, q2, p1));
+  const int o4 = sign(area(p2, q2, q1));
+  if (o1 != o2 && o3 != o4) {
+    return true;
+  }
+  return (o1 == 0 && on_segment(p1, p2, q1)) || (o2 == 0 && on_segment(p1, q2, q1)) ||
+         (o3 == 0 && on_segment(p2, p1, q2)) || (o4 == 0 && on_segment(p2, q1, q2));
+}
+
+// The diagonal ab crosses an edge of a's ring.
+bool intersects_polygon(const Node* a, const Node* b) {
+  const Node* p = a;
+  do {
+    if (p->index != a->index && p->next->index != a->index && p->index != b->index &&
+        p->next->index != b->index && intersects(p, p->next, a, b)) {
+      return true;
+    }
+    p = p->next;
+  } while (p != a);
+  return false;
+}
+
+// The diagonal ab starts into the polygon's interior at a.
+bool locally_inside(const Node* a, const Node* b) {
+  return area(a->prev, a, a->next) < 0.0
+             ? area(a, b, a->next) >= 0.0 && area(a, a->prev, b) >= 0.0
+             : area(a, b, a->prev) < 0.0 || area(a, a->next, b) < 0.0;
+}
+
+// The midpoint of ab is inside the ring (even-odd ray cast).
+bool middle_inside(const Node* a, const Node* b) {
+  const Node* p = a;
+  bool inside = false;
+  const double px = (a->x + b->x) / 2.0;
+  const double py = (a->y + b->y) / 2.0;
+  do {
+    if (((p->y > py) != (p->next->y > py)) && p->next->y != p->y &&
+        (px < (p->next->x - p->x) * (py - p->y) / (p->next->y - p->y) + p->x)) {
+      inside = !inside;
+    }
+    p = p->next;
+  } while (p != a);
+  return inside;
+}
+
+bool is_valid_diagonal(const Node* a, const Node* b) {
+  if (a->next->index == b->index || a->prev->index == b->index || intersects_polygon(a, b)) {
+    return false;
+  }
+  // Either a proper diagonal that does not create a zero-area piece, or a
+  // zero-length one between two convex copies of the same point.
+  return (locally_inside(a, b) && locally_inside(b, a) && middle_inside(a, b) &&
+          (area(a->prev, a, b->prev) != 0.0 || area(a, b->prev, b) != 0.0)) ||
+         (equals(a, b) && area(a->prev, a, a->next) > 0.0 && area(b->prev, b, b->next) > 0.0);
+}
+
+void remove_node(Node* p) {
+  p->removed = true;
+  p->next->prev = p->prev;
+  p->prev->next = p->next;
+  if (p->prev_z != nullptr) {
+    p->prev_z->next_z = p->next_z;
+  }
+  if (p->next_z != nullptr) {
+    p->next_z->prev_z = p->prev_z;
+  }
 }
 
 double signed_area(const std::vector<Vec2>& polygon) {
@@ -23,80 +143,649 @@ double signed_area(const std::vector<Vec2>& polygon) {
   return 0.5 * sum;
 }
 
-bool point_in_triangle(const Vec2& point, const Vec2& a, const Vec2& b, const Vec2& c) {
-  const double c1 = cross(a, b, point);
-  const double c2 = cross(b, c, point);
-  const double c3 = cross(c, a, point);
+// Ring vertices and edges bucketed into horizontal bands, so bridging a hole
+// looks at the band its leftward ray runs along instead of walking the whole
+// merged ring. Only rings already joined to the outer ring are added.
+class BridgeIndex {
+ public:
+  BridgeIndex(const double min_y, const double max_y, const std::size_t vertex_count)
+      : min_y_(min_y) {
+    const auto bands = std::max<std::size_t>(
+        1, static_cast<std::size_t>(std::sqrt(static_cast<double>(vertex_count))));
+    inv_band_height_ = max_y > min_y ? static_cast<double>(bands) / (max_y - min_y) : 0.0;
+    vertex_bands_.resize(bands);
+    edge_bands_.resize(bands);
+  }
+
+  void add_ring(Node* start) {
+    Node* p = start;
+    do {
+      add_vertex(p);
+      add_edge(p);
+      p = p->next;
+    } while (p != start);
+  }
 
-  const bool has_negative = (c1 < -kEpsilon) || (c2 < -kEpsilon) || (c3 < -kEpsilon);
-  const bool has_positive = (c1 > kEpsilon) || (c2 > kEpsilon) || (c3 > kEpsilon);
-  return !(has_negative && has_positive);
-}
+  void add_vertex(Node* p) { vertex_bands_[band(p->y)].push_back(p); }
 
-}  // namespace
+  // Files the edge p -> p->next under every band it spans. Entries are not
+  // updated as filter_points() unlinks nodes: the edge replacing two removed
+  // ones spans no band that theirs did not, so edges_at() follows a removed
+  // entry back to the live node that now owns the merged edge.
+  void add_edge(Node* p) {
+    const std::size_t first = band(std::min(p->y, p->next->y));
+    const std::size_t last = band(std::max(p->y, p->next->y));
+    if (last - first >= kLongEdgeBands) {
+      long_edges_.push_back(p);
+      return;
+    }
+    for (std::size_t i = first; i <= last; ++i) {
+      edge_bands_[i].push_back(p);
+    }
+  }
 
-std::vector<uint32_t> triangulate_polygon_ear_clipping(const std::vector<Vec2>& polygon) {
-  std::vector<uint32_t> triangles;
-  if (polygon.size() < 3) {
-    return triangles;
+  // Calls visit(p) for every live p whose edge p -> p->next may cross y.
+  template <typename Visit>
+  void edges_at(const double y, Visit&& visit) const {
+    for (const auto* entries : {&edge_bands_[band(y)], &long_edges_}) {
+      for (Node* p : *entries) {
+        while (p->removed) {
+          p = p->prev;
+        }
+        visit(p);
+      }
+    }
   }
 
-  std::vector<uint32_t> vertex_indices(polygon.size());
-  for (uint32_t i = 0; i < polygon.size(); ++i) {
-    vertex_indices[i] = i;
+  // Calls visit(p) for every live vertex that may lie in [y0, y1].
+  template <typename Visit>
+  void vertices_between(const double y0, const double y1, Visit&& visit) const {
+    for (std::size_t i = band(y0), last = band(y1); i <= last; ++i) {
+      for (Node* p : vertex_bands_[i]) {
+        if (!p->removed) {
+          visit(p);
+        }
+      }
+    }
   }
 
-  const bool ccw = signed_area(polygon) > 0.0;
+ private:
+  // Edges spanning more bands than this go on a list every query scans.
+  static constexpr std::size_t kLongEdgeBands = 8;
 
-  while (vertex_indices.size() > 3) {
-    bool ear_found = false;
+  [[nodiscard]] std::size_t band(const double y) const {
+    const double offset = (y - min_y_) * inv_band_height_;
+    if (!(offset > 0.0)) {
+      return 0;
+    }
+    return std::min(static_cast<std::size_t>(offset), vertex_bands_.size() - 1);
+  }
+
+  double min_y_ = 0.0;
+  double inv_band_height_ = 0.0;
+  std::vector<std::vector<Node*>> vertex_bands_;
+  std::vector<std::vector<Node*>> edge_bands_;
+  std::vector<Node*> long_edges_;
+};
 
-    for (size_t i = 0; i < vertex_indices.size(); ++i) {
-      const uint32_t prev = vertex_indices[(i + vertex_indices.size() - 1) % vertex_indices.size()];
-      const uint32_t curr = vertex_indices[i];
-      const uint32_t next = vertex_indices[(i + 1) % vertex_indices.size()];
+// Ear clipping over a linked vertex ring (the "earcut" scheme): each ear test
+// only looks at reflex vertices inside the candidate's bounding box, found
+// through a z-order curve index on large polygons, so typical inputs run in
+// O(n log n). When no ear is left the ring is cleaned of degenerate vertices,
+// then of local self-intersections, then split along a diagonal, and only as
+// a last resort fanned, so bad input still yields a covering triangulation.
+class Earcut {
+ public:
+  // Indices refer to `outer` followed by each ring of `holes`.
+  Earcut(const std::vector<Vec2>& outer, const std::vector<std::vector<Vec2>>& holes)
+      : outer_(outer), holes_(holes) {}
 
-      const auto& a = polygon[prev];
-      const auto& b = polygon[curr];
-      const auto& c = polygon[next];
+  std::vector<uint32_t> run() {
+    // The outer ring is built counter-clockwise and holes clockwise; an outer
+    // ring given clockwise has its triangles flipped on output to keep the
+    // caller's winding.
+    reversed_ = signed_area(outer_) < 0.0;
+    Node* ring = link_ring(outer_, 0, true);
+    if (ring == nullptr || ring->next == ring->prev) {
+      return {};
+    }
 
-      const double turn = cross(a, b, c);
-      if ((ccw && turn <= kEpsilon) || (!ccw && turn >= -kEpsilon)) {
+    std::size_t vertex_count = outer_.size();
+    for (const auto& hole : holes_) {
+      vertex_count += hole.size();
+    }
+    triangles_.reserve((vertex_count + 2 * holes_.size() - 2) * 3);
+    if (!holes_.empty()) {
+      ring = eliminate_holes(ring);
+    }
+    if (vertex_count > kZOrderHashThreshold) {
+      double max_x = min_x_ = outer_[0][0];
+      double max_y = min_y_ = outer_[0][1];
+      const auto extend = [&](const std::vector<Vec2>& points) {
+        for (const auto& point : points) {
+          min_x_ = std::min(min_x_, point[0]);
+          min_y_ = std::min(min_y_, point[1]);
+          max_x = std::max(max_x, point[0]);
+          max_y = std::max(max_y, point[1]);
+        }
+      };
+      // Hole vertices join the ring through the bridges, so they are hashed
+      // too and must not fall outside the box.
+      extend(outer_);
+      for (const auto& hole : holes_) {
+        extend(hole);
+      }
+      // z-order coordinates are 15-bit integers over the bounding box.
+      const double size = std::max(max_x - min_x_, max_y - min_y_);
+      inv_size_ = size > 0.0 ? 32767.0 / size : 0.0;
+    }
+    earcut_linked(ring, 0);
+    return std::move(triangles_);
+  }
+
+ private:
+  Node* insert_node(const uint32_t index, const Vec2& point, Node* last) {
+    Node& node = nodes_.emplace_back();
+    node.index = index;
+    node.x = point[0];
+    node.y = point[1];
+    if (last == nullptr) {
+      node.prev = &node;
+      node.next = &node;
+    } else {
+      node.next = last->next;
+      node.prev = last;
+      last->next->prev = &node;
+      last->next = &node;
+    }
+    return &node;
+  }
+
+  // Links `ring` (whose first vertex has index `base`) in the requested
+  // winding; returns nullptr for an empty ring.
+  Node* link_ring(const std::vector<Vec2>& ring, const uint32_t base,
+                  const bool counter_clockwise) {
+    const double ring_area = signed_area(ring);
+    const bool reverse = counter_clockwise ? ring_area < 0.0 : ring_area > 0.0;
+    Node* last = nullptr;
+    const auto count = static_cast<uint32_t>(ring.size());
+    for (uint32_t i = 0; i < count; ++i) {
+      const uint32_t offset = reverse ? count - 1 - i : i;
+      last = insert_node(base + offset, ring[offset], last);
+    }
+    if (last != nullptr && last != last->next && equals(last, last->next)) {
+      Node* duplicate = last;
+      last = last->next;
+      remove_node(duplicate);
+    }
+    return last;
+  }
+
+  // Joins every hole to the outer ring with a zero-width bridge, from the
+  // hole's leftmost vertex to a visible outer vertex, so the result is a
+  // single ring. Holes are bridged left to right, so a bridge never has to
+  // cross a hole that is still unjoined.
+  Node* eliminate_holes(Node* outer) {
+    std::vector<Node*> leftmost;
+    leftmost.reserve(holes_.size());
+    auto base = static_cast<uint32_t>(outer_.size());
+    double min_y = std::numeric_limits<double>::infinity();
+    double max_y = -min_y;
+    std::size_t vertex_count = outer_.size();
+    for (const auto& point : outer_) {
+      min_y = std::min(min_y, point[1]);
+      max_y = std::max(max_y, point[1]);
+    }
+    for (const auto& hole : holes_) {
+      for (const auto& point : hole) {
+        min_y = std::min(min_y, point[1]);
+        max_y = std::max(max_y, point[1]);
+      }
+      vertex_count += hole.size();
+      Node* ring = link_ring(hole, base, false);
+      base += static_cast<uint32_t>(hole.size());
+      if (ring == nullptr) {
+        continue;
+      }
+      if (ring == ring->next) {
+        ring->steiner = true;
+      }
+      leftmost.push_back(get_leftmost(ring));
+    }
+    std::sort(leftmost.begin(), leftmost.end(), [](const Node* a, const Node* b) {
+      return a->x != b->x ? a->x < b->x : a->y < b->y;
+    });
+
+    BridgeIndex index(min_y, max_y, vertex_count);
+    index.add_ring(outer);
+    for (Node* hole : leftmost) {
+      Node* bridge = find_hole_bridge(hole, index);
+      if (bridge == nullptr) {
         continue;
       }
+      index.add_ring(hole);
+      Node* bridge_reverse = split_polygon(bridge, hole);
+      // split_polygon() re-pointed bridge at the hole and added the two
+      // copies; the hole's last edge keeps its span, now ending at a copy.
+      index.add_edge(bridge);
+      for (Node* copy : {bridge_reverse, bridge_reverse->next}) {
+        index.add_vertex(copy);
+        index.add_edge(copy);
+      }
+      filter_points(bridge_reverse, bridge_reverse->next);
+      outer = filter_points(bridge, bridge->next);
+    }
+    return outer;
+  }
 
-      bool contains_other_point = false;
-      for (const auto candidate : vertex_indices) {
-        if (candidate == prev || candidate == curr || candidate == next) {
-          continue;
+  static Node* get_leftmost(Node* start) {
+    Node* leftmost = start;
+    Node* p = start;
+    do {
+      if (p->x < leftmost->x || (p->x == leftmost->x && p->y < leftmost->y)) {
+        leftmost = p;
+      }
+      p = p->next;
+    } while (p != start);
+    return leftmost;
+  }
+
+  // The outer vertex the hole's leftmost vertex connects to (David Eberly's
+  // "Triangulation by Ear Clipping"): cast a ray to the left, take the edge
+  // it hits first, then the vertex of that edge, or the reflex vertex inside
+  // the ray/edge triangle with the smallest angle to the ray.
+  static Node* find_hole_bridge(const Node* hole, const BridgeIndex& index) {
+    const double hx = hole->x;
+    const double hy = hole->y;
+    double qx = -std::numeric_limits<double>::infinity();
+    Node* m = nullptr;
+    bool touching = false;
+    index.edges_at(hy, [&](Node* p) {
+      if (touching || !(hy <= p->y && hy >= p->next->y && p->next->y != p->y)) {
+        return;
+      }
+      const double x = p->x + (hy - p->y) * (p->next->x - p->x) / (p->next->y - p->y);
+      if (x <= hx && x > qx) {
+        qx = x;
+        m = p->x < p->next->x ? p : p->next;
+        // The hole touches the outer edge; bridge to its left end.
+        touching = x == hx;
+      }
+    });
+    if (m == nullptr || touching) {
+      return m;
+    }
+
+    const double mx = m->x;
+    const double my = m->y;
+    double tan_min = std::numeric_limits<double>::infinity();
+    index.vertices_between(std::min(hy, my), std::max(hy, my), [&](Node* p) {
+      if (hx >= p->x && p->x >= mx && hx != p->x &&
+          point_in_triangle(hy < my ? hx : qx, hy, mx, my, hy < my ? qx : hx, hy, p->x, p->y)) {
+        const double tan = std::abs(hy - p->y) / (hx - p->x);
+        if (locally_inside(p, hole) &&
+            (tan < tan_min ||
+             (tan == tan_min &&
+              (p->x > m->x || (p->x == m->x && sector_contains_sector(m, p)))))) {
+          m = p;
+          tan_min = tan;
+        }
+      }
+    });
+    return m;
+  }
+
+  // The wedge at m contains the wedge at p (both at the same point).
+  static bool sector_contains_sector(const Node* m, const Node* p) {
+    return area(m->prev, m, p->prev) < 0.0 && area(p->next, m, m->next) < 0.0;
+  }
+
+  void emit(const Node* a, const Node* b, const Node* c) {
+    if (reversed_) {
+      std::swap(a, c);
+    }
+    triangles_.push_back(a->index);
+    triangles_.push_back(b->index);
+    triangles_.push_back(c->index);
+  }
+
+  int32_t z_order(const double x, const double y) const {
+    auto interleave = [](double coordinate) {
+      auto bits = static_cast<uint32_t>(static_cast<int32_t>(coordinate));
+      bits = (bits | (bits << 8U)) & 0x00FF00FFU;
+      bits = (bits | (bits << 4U)) & 0x0F0F0F0FU;
+      bits = (bits | (bits << 2U)) & 0x33333333U;
+      bits = (bits | (bits << 1U)) & 0x55555555U;
+      return bits;
+    };
+    return static_cast<int32_t>(interleave((x - min_x_) * inv_size_) |
+                                (interleave((y - min_y_) * inv_size_) << 1U));
+  }
+
+  // Links the ring's nodes in z-order through prev_z/next_z.
+  void index_curve(Node* start) {
+    Node* p = start;
+    do {
+      if (p->z == 0) {
+        p->z = z_order(p->x, p->y);
+      }
+      p->prev_z = p->prev;
+      p->next_z = p->next;
+      p = p->next;
+    } while (p != start);
+    p->prev_z->next_z = nullptr;
+    p->prev_z = nullptr;
+    sort_linked(p);
+  }
+
+  // Bottom-up merge sort of the next_z list by z.
+  static void sort_linked(Node* list) {
+    std::size_t run_size = 1;
+    std::size_t merges = 0;
+    do {
+      Node* p = list;
+      list = nullptr;
+      Node* tail = nullptr;
+      merges = 0;
+      while (p != nullptr) {
+        ++merges;
+        Node* q = p;
+        std::size_t p_size = 0;
+        for (std::size_t i = 0; i < run_size && q != nullptr; ++i) {
+          ++p_size;
+          q = q->next_z;
         }
-        if (point_in_triangle(polygon[candidate], a, b, c)) {
-          contains_other_point = true;
+        std::size_t q_size = run_size;
+        while (p_size > 0 || (q_size > 0 && q != nullptr)) {
+          Node* e = nullptr;
+          if (p_size != 0 && (q_size == 0 || q == nullptr || p->z <= q->z)) {
+            e = p;
+            p = p->next_z;
+            --p_size;
+          } else {
+            e = q;
+            q = q->next_z;
+            --q_size;
+          }
+          if (tail != nullptr) {
+            tail->next_z = e;
+          } else {
+            list = e;
+          }
+          e->prev_z = tail;
+          tail = e;
+        }
+        p = q;
+      }
+      tail->next_z = nullptr;
+      run_size *= 2;
+    } while (merges > 1);
+  }
+
+  // Drops duplicate and collinear vertices between start and end; returns a
+  // node still on the ring.
+  static Node* filter_points(Node* start, Node* end = nullptr) {
+    if (end == nullptr) {
+      end = start;
+    }
+    Node* p = start;
+    bool again = false;
+    do {
+      again = false;
+      if (!p->steiner && (equals(p, p->next) || area(p->prev, p, p->next) == 0.0)) {
+        remove_node(p);
+        p = end = p->prev;
+        if (p == p->next) {
           break;
         }
+        again = true;
+      } else {
+        p = p->next;
       }
+    } while (again || p != end);
+    return end;
+  }
 
-      if (contains_other_point) {
-        continue;
+  bool is_ear(const Node* ear) const {
+    const Node* a = ear->prev;
+    const Node* b = ear;
+    const Node* c = ear->next;
+    if (area(a, b, c) >= 0.0) {
+      return false;
+    }
+    const double x0 = std::min({a->x, b->x, c->x});
+    const double y0 = std::min({a->y, b->y, c->y});
+    const double x1 = std::max({a->x, b->x, c->x});
+    const double y1 = std::max({a->y, b->y, c->y});
+    for (const Node* p = c->next; p != a; p = p->next) {
+      if (p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 &&
+          point_in_triangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+          area(p->prev, p, p->next) >= 0.0) {
+        return false;
       }
+    }
+    return true;
+  }
 
-      triangles.push_back(prev);
-      triangles.push_back(curr);
-      triangles.push_back(next);
-      vertex_indices.erase(vertex_indices.begin() + static_cast<std::ptrdiff_t>(i));
-      ear_found = true;
-      break;
+  bool is_ear_hashed(const Node* ear) const {
+    const Node* a = ear->prev;
+    const Node* b = ear;
+    const Node* c = ear->next;
+    if (area(a, b, c) >= 0.0) {
+      return false;
     }
+    const double x0 = std::min({a->x, b->x, c->x});
+    const double y0 = std::min({a->y, b->y, c->y});
+    const double x1 = std::max({a->x, b->x, c->x});
+    const double y1 = std::max({a->y, b->y, c->y});
+    const int32_t min_z = z_order(x0, y0);
+    const int32_t max_z = z_order(x1, y1);
+    const auto blocks = [&](const Node* p) {
+      return p->x >= x0 && p->x <= x1 && p->y >= y0 && p->y <= y1 && p != a && p != c &&
+             point_in_triangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+             area(p->prev, p, p->next) >= 0.0;
+    };
 
-    if (!ear_found) {
-      return {};
+    // Walk out from the ear in both z directions, bounded by the z range of
+    // the triangle's bounding box.
+    const Node* p = ear->prev_z;
+    const Node* n = ear->next_z;
+    while (p != nullptr && p->z >= min_z && n != nullptr && n->z <= max_z) {
+      if (blocks(p) || blocks(n)) {
+        return false;
+      }
+      p = p->prev_z;
+      n = n->next_z;
+    }
+    for (; p != nullptr && p->z >= min_z; p = p->prev_z) {
+      if (blocks(p)) {
+        return false;
+      }
     }
+    for (; n != nullptr && n->z <= max_z; n = n->next_z) {
+      if (blocks(n)) {
+        return false;
+      }
+    }
+    return true;
   }
 
-  triangles.push_back(vertex_indices[0]);
-  triangles.push_back(vertex_indices[1]);
-  triangles.push_back(vertex_indices[2]);
-  return triangles;
+  // Clips ears in sweeps over the ring. A vertex is only tested again once a
+  // neighbour was clipped, so concave stretches are not rescanned on every
+  // loop; vertices next to an ear wait for the following sweep, which leaves
+  // fewer sliver triangles. When a sweep over the whole ring finds no ear,
+  // pass 1 filters degenerate vertices, pass 2 also clips local
+  // self-intersections, and after that the ring is split in two.
+  void earcut_linked(Node* ear, const int pass) {
+    if (ear == nullptr) {
+      return;
+    }
+    const bool hashed = inv_size_ > 0.0;
+    if (pass == 0 && hashed) {
+      index_curve(ear);
+    }
+    std::vector<Node*> candidates;
+    std::vector<Node*> deferred;
+    std::size_t ring_size = 0;
+    bool full_sweep = true;
+    while (true) {
+      ++sweep_;
+      if (full_sweep) {
+        candidates.clear();
+        const Node* p = ear;
+        do {
+          candidates.push_back(ear);
+          ear->queued_sweep = sweep_;
+          ear = ear->next;
+        } while (ear != p);
+        ring_size = candidates.size();
+      }
+      deferred.clear();
+      for (Node* candidate : candidates) {
+        if (ring_size < 3) {
+          return;
+        }
+        if (candidate->removed || candidate->queued_sweep != sweep_) {
+          continue;
+        }
+        if (!(hashed ? is_ear_hashed(candidate) : is_ear(candidate))) {
+          continue;
+        }
+        Node* prev = candidate->prev;
+        Node* next = candidate->next;
+        emit(prev, candidate, next);
+        remove_node(candidate);
+        --ring_size;
+        ear = next;
+        for (Node* neighbour : {prev, next}) {
+          if (neighbour->queued_sweep != sweep_ + 1) {
+            neighbour->queued_sweep = sweep_ + 1;
+            deferred.push_back(neighbour);
+          }
+        }
+      }
+      if (ring_size < 3) {
+        return;
+      }
+      if (!deferred.empty()) {
+        std::swap(candidates, deferred);
+        full_sweep = false;
+      } else if (!full_sweep) {
+        // A clipped ear may have been the only thing blocking a vertex that
+        // was not its neighbour, so rescan everything before giving up.
+        full_sweep = true;
+      } else {
+        break;
+      }
+    }
+
+    if (pass == 0) {
+      earcut_linked(filter_points(ear), 1);
+    } else if (pass == 1) {
+      earcut_linked(cure_local_intersections(filter_points(ear)), 2);
+    } else {
+      split_earcut(ear);
+    }
+  }
+
+  // Clips a-p-b wherever the edges before and after p cross.
+  Node* cure_local_intersections(Node* start) {
+    Node* p = start;
+    do {
+      Node* a = p->prev;
+      Node* b = p->next->next;
+      if (!equals(a, b) && intersects(a, p, p->next, b) && locally_inside(a, b) &&
+          locally_inside(b, a)) {
+        emit(a, p, b);
+        remove_node(p);
+        remove_node(p->next);
+        p = start = b;
+      }
+      p = p->next;
+    } while (p != start);
+    return filter_points(p);
+  }
+
+  // Splits the ring along the first valid diagonal and triangulates both
+  // halves; fans what is left if there is none.
+  void split_earcut(Node* start) {
+    Node* a = start;
+    do {
+      for (Node* b = a->next->next; b != a->prev; b = b->next) {
+        if (a->index != b->index && is_valid_diagonal(a, b)) {
+          Node* c = split_polygon(a, b);
+          a = filter_points(a, a->next);
+          c = filter_points(c, c->next);
+          earcut_linked(a, 0);
+          earcut_linked(c, 0);
+          return;
+        }
+      }
+      a = a->next;
+    } while (a != start);
+
+    for (Node* p = start->next; p->next != start; p = p->next) {
+      emit(start, p, p->next);
+    }
+  }
+
+  // Links a to b with a two-way bridge, splitting one ring into two; returns
+  // the copy of b that starts the second ring.
+  Node* split_polygon(Node* a, Node* b) {
+    Node& a2 = nodes_.emplace_back(*a);
+    Node& b2 = nodes_.emplace_back(*b);
+    for (Node* copy : {&a2, &b2}) {
+      copy->prev_z = nullptr;
+      copy->next_z = nullptr;
+      copy->steiner = false;
+    }
+    Node* an = a->next;
+    Node* bp = b->prev;
+    a->next = b;
+    b->prev = a;
+    a2.next = an;
+    an->prev = &a2;
+    b2.next = &a2;
+    a2.prev = &b2;
+    bp->next = &b2;
+    b2.prev = bp;
+    return &b2;
+  }
+
+  const std::vector<Vec2>& outer_;
+  const std::vector<std::vector<Vec2>>& holes_;
+  // A deque keeps node addresses stable as split_polygon() appends.
+  std::deque<Node> nodes_;
+  std::vector<uint32_t> triangles_;
+  bool reversed_ = false;
+  uint64_t sweep_ = 0;
+  double min_x_ = 0.0;
+  double min_y_ = 0.0;
+  // 0 disables the z-order index.
+  double inv_size_ = 0.0;
+};
+
+}  // namespace
+
+std::vector<uint32_t> triangulate_polygon_ear_clipping(const std::vector<Vec2>& polygon) {
+  if (polygon.size() < 3 ||
+      polygon.size() > static_cast<std::size_t>(std::numeric_limits<uint32_t>::max())) {
+    return {};
+  }
+  return Earcut(polygon, {}).run();
+}
+
+std::vector<uint32_t> triangulate_polygon_with_holes(const std::vector<Vec2>& outer,
+                                                     const std::vector<std::vector<Vec2>>& holes) {
+  std::size_t vertex_count = outer.size();
+  for (const auto& hole : holes) {
+    vertex_count += hole.size();
+  }
+  if (outer.size() < 3 ||
+      vertex_count > static_cast<std::size_t>(std::numeric_limits<uint32_t>::max())) {
+    return {};
+  }
+  return Earcut(outer, holes).run();
 }
 
 }  // namespace manim_cpp::math
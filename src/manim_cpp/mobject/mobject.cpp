@@ -46,4 +46,16 @@ void Mobject::set_opacity(const double opacity) {
 
 double Mobject::opacity() const { return opacity_; }
 
+std::shared_ptr<Mobject> Mobject::copy() const {
+  auto result = clone();
+  for (auto& child : result->submobjects_) {
+    if (child != nullptr) {
+      child = child->copy();
+    }
+  }
+  return result;
+}
+
+std::shared_ptr<Mobject> Mobject::clone() const { return std::make_shared<Mobject>(*this); }
+
 }  // namespace manim_cpp::mobject
@@ -1,7 +1,11 @@
 #include "manim_cpp/renderer/cairo_renderer.hpp"
 
 #include <iomanip>
+#include <memory>
 #include <sstream>
+#include <utility>
+
+#include "manim_cpp/renderer/draw_list.hpp"
 
 namespace manim_cpp::renderer {
 
@@ -18,9 +22,47 @@ bool CairoRenderer::should_render_for_signature(
   if (frame_signature.empty()) {
     return true;
   }
-  return seen_frame_signatures_.insert(frame_signature).second;
+  return should_render_for_hash(hash_frame_signature(frame_signature));
+}
+
+bool CairoRenderer::should_render_for_hash(const FrameHash& frame_hash) {
+  return !frame_cache_.remember(frame_hash);
 }
 
-void CairoRenderer::reset_frame_cache() { seen_frame_signatures_.clear(); }
+void CairoRenderer::reset_frame_cache() { frame_cache_.clear(); }
+
+void CairoRenderer::set_frame_cache_max_bytes(const std::size_t max_bytes) {
+  frame_cache_.set_max_bytes(max_bytes);
+}
+
+FrameHash CairoRenderer::render_frame(
+    const std::vector<std::shared_ptr<mobject::Mobject>>& mobjects,
+    const RasterSettings& settings,
+    FrameBuffer* output) {
+  return render_frame(build_draw_list(mobjects), settings, output);
+}
+
+FrameHash CairoRenderer::render_frame(const DrawList& draw_list,
+                                      const RasterSettings& settings,
+                                      FrameBuffer* output) {
+  const auto frame_hash = hash_draw_state(draw_list, settings);
+  if (output != nullptr) {
+    *output = *render_frame(draw_list, settings, frame_hash);
+  }
+  return frame_hash;
+}
+
+SharedFrame CairoRenderer::render_frame(const DrawList& draw_list,
+                                        const RasterSettings& settings,
+                                        const FrameHash& frame_hash) {
+  if (auto cached = frame_cache_.find(frame_hash); cached != nullptr) {
+    return cached;
+  }
+  auto frame = std::make_shared<FrameBuffer>();
+  rasterizer_.render(draw_list, settings, frame.get());
+  SharedFrame rendered = std::move(frame);
+  frame_cache_.insert(frame_hash, rendered);
+  return rendered;
+}
 
 }  // namespace manim_cpp::renderer
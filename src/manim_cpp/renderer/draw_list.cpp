@@ -0,0 +1,287 @@
+#include "manim_cpp/renderer/draw_list.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <utility>
+
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/mobject/graph.hpp"
+#include "manim_cpp/mobject/mobject.hpp"
+#include "manim_cpp/renderer/mesh_cache.hpp"
+
+namespace manim_cpp::renderer {
+namespace {
+
+using math::Vec2;
+using math::Vec3;
+using Rings = std::vector<std::vector<Vec2>>;
+
+// Points on an origin-centred elliptic arc; meshes are tessellated around
+// their own origin and translated per instance.
+std::vector<Vec2> arc_points(const double radius_x,
+                             const double radius_y,
+                             const double start_angle,
+                             const double angle,
+                             const std::size_t segments) {
+  std::vector<Vec2> points;
+  points.reserve(segments + 1);
+  for (std::size_t i = 0; i <= segments; ++i) {
+    const double theta =
+        start_angle + (angle * static_cast<double>(i) / static_cast<double>(segments));
+    points.push_back(Vec2{radius_x * std::cos(theta), radius_y * std::sin(theta)});
+  }
+  return points;
+}
+
+std::vector<Vec2> closed_ellipse(const double radius_x,
+                                 const double radius_y,
+                                 const std::size_t segments) {
+  auto points = arc_points(radius_x, radius_y, 0.0, 2.0 * math::kPi, segments);
+  points.pop_back();
+  return points;
+}
+
+std::vector<Vec2> to_ring(const std::vector<Vec3>& vertices) {
+  std::vector<Vec2> ring;
+  ring.reserve(vertices.size());
+  for (const auto& vertex : vertices) {
+    ring.push_back(Vec2{vertex[0], vertex[1]});
+  }
+  return ring;
+}
+
+std::vector<Vec2> stroke_segment(const Vec2& start, const Vec2& end, const double width) {
+  const double dx = end[0] - start[0];
+  const double dy = end[1] - start[1];
+  const double length = std::sqrt((dx * dx) + (dy * dy));
+  if (length <= 0.0) {
+    return {};
+  }
+  const double nx = (-dy / length) * (width / 2.0);
+  const double ny = (dx / length) * (width / 2.0);
+  return {
+      Vec2{start[0] + nx, start[1] + ny},
+      Vec2{end[0] + nx, end[1] + ny},
+      Vec2{end[0] - nx, end[1] - ny},
+      Vec2{start[0] - nx, start[1] - ny},
+  };
+}
+
+std::vector<Vec2> annular_sector(const double inner_radius,
+                                 const double outer_radius,
+                                 const double start_angle,
+                                 const double angle) {
+  auto ring = arc_points(outer_radius, outer_radius, start_angle, angle, kCurveSegments);
+  if (inner_radius <= 0.0) {
+    ring.push_back(Vec2{0.0, 0.0});
+    return ring;
+  }
+  const auto inner = arc_points(inner_radius, inner_radius, start_angle, angle, kCurveSegments);
+  ring.insert(ring.end(), inner.rbegin(), inner.rend());
+  return ring;
+}
+
+std::shared_ptr<const Mesh> ellipse_mesh(const double radius_x,
+                                         const double radius_y,
+                                         const std::size_t segments) {
+  const MeshKey key{
+      .shape = MeshShape::kEllipse, .parameters = {radius_x, radius_y}, .segments = segments};
+  return MeshCache::global().find_or_build(
+      key, [&] { return Rings{closed_ellipse(radius_x, radius_y, segments)}; });
+}
+
+std::shared_ptr<const Mesh> annular_sector_mesh(const double inner_radius,
+                                                const double outer_radius,
+                                                const double start_angle,
+                                                const double angle) {
+  const MeshKey key{.shape = MeshShape::kAnnularSector,
+                    .parameters = {inner_radius, outer_radius, start_angle, angle},
+                    .segments = kCurveSegments};
+  return MeshCache::global().find_or_build(key, [&] {
+    return Rings{annular_sector(inner_radius, outer_radius, start_angle, angle)};
+  });
+}
+
+std::shared_ptr<const Mesh> annulus_mesh(const double inner_radius, const double outer_radius) {
+  const MeshKey key{.shape = MeshShape::kAnnulus,
+                    .parameters = {inner_radius, outer_radius},
+                    .segments = kCurveSegments};
+  return MeshCache::global().find_or_build(key, [&] {
+    return Rings{closed_ellipse(outer_radius, outer_radius, kCurveSegments),
+                 closed_ellipse(inner_radius, inner_radius, kCurveSegments)};
+  });
+}
+
+// Same vertices as RegularPolygon::vertices(), around the origin.
+std::shared_ptr<const Mesh> regular_polygon_mesh(const std::size_t n_sides,
+                                                 const double radius) {
+  const MeshKey key{
+      .shape = MeshShape::kRegularPolygon, .parameters = {radius}, .segments = n_sides};
+  return MeshCache::global().find_or_build(key, [&] {
+    std::vector<Vec2> ring;
+    ring.reserve(n_sides);
+    const double angle_step = (2.0 * std::numbers::pi) / static_cast<double>(n_sides);
+    const double start_angle = std::numbers::pi / 2.0;
+    for (std::size_t i = 0; i < n_sides; ++i) {
+      const double angle = start_angle + (static_cast<double>(i) * angle_step);
+      ring.push_back(Vec2{radius * std::cos(angle), radius * std::sin(angle)});
+    }
+    return Rings{std::move(ring)};
+  });
+}
+
+// The mesh's rings moved to `center`: the only per-instance geometry work.
+Rings place(const Mesh& mesh, const Vec3& center) {
+  Rings rings;
+  rings.reserve(mesh.rings().size());
+  for (const auto& local : mesh.rings()) {
+    auto& ring = rings.emplace_back();
+    ring.reserve(local.size());
+    for (const auto& point : local) {
+      ring.push_back(Vec2{center[0] + point[0], center[1] + point[1]});
+    }
+  }
+  return rings;
+}
+
+void push_command(std::vector<std::vector<Vec2>> rings,
+                  const FillRule fill_rule,
+                  const double opacity,
+                  DrawList* output) {
+  DrawCommand command;
+  command.rings = std::move(rings);
+  command.fill_rule = fill_rule;
+  command.opacity = opacity;
+  output->push_back(std::move(command));
+}
+
+void append_own_geometry(const mobject::Mobject& mobject, DrawList* output) {
+  const double opacity = mobject.opacity();
+  const auto& c = mobject.center();
+
+  if (const auto* dot = dynamic_cast<const mobject::Dot*>(&mobject)) {
+    push_command(place(*ellipse_mesh(dot->radius(), dot->radius(), kCurveSegments / 3), c),
+                 FillRule::kNonZero, opacity, output);
+    return;
+  }
+  if (const auto* circle = dynamic_cast<const mobject::Circle*>(&mobject)) {
+    push_command(place(*ellipse_mesh(circle->radius(), circle->radius(), kCurveSegments), c),
+                 FillRule::kNonZero, opacity, output);
+    return;
+  }
+  if (const auto* ellipse = dynamic_cast<const mobject::Ellipse*>(&mobject)) {
+    push_command(
+        place(*ellipse_mesh(ellipse->width() / 2.0, ellipse->height() / 2.0, kCurveSegments), c),
+        FillRule::kNonZero, opacity, output);
+    return;
+  }
+  if (const auto* arc = dynamic_cast<const mobject::Arc*>(&mobject)) {
+    if (arc->angle() == 0.0) {
+      return;
+    }
+    const double half_width = kDefaultStrokeWidth / 2.0;
+    push_command(place(*annular_sector_mesh(std::max(arc->radius() - half_width, 0.0),
+                                            arc->radius() + half_width, arc->start_angle(),
+                                            arc->angle()),
+                       c),
+                 FillRule::kNonZero, opacity, output);
+    return;
+  }
+  if (const auto* annulus = dynamic_cast<const mobject::Annulus*>(&mobject)) {
+    push_command(place(*annulus_mesh(annulus->inner_radius(), annulus->outer_radius()), c),
+                 FillRule::kEvenOdd, opacity, output);
+    return;
+  }
+  if (const auto* sector = dynamic_cast<const mobject::Sector*>(&mobject)) {
+    if (sector->angle() == 0.0) {
+      return;
+    }
+    push_command(place(*annular_sector_mesh(sector->inner_radius(), sector->outer_radius(),
+                                            sector->start_angle(), sector->angle()),
+                       c),
+                 FillRule::kNonZero, opacity, output);
+    return;
+  }
+  if (const auto* square = dynamic_cast<const mobject::Square*>(&mobject)) {
+    push_command({to_ring(square->vertices())}, FillRule::kNonZero, opacity, output);
+    return;
+  }
+  if (const auto* rectangle = dynamic_cast<const mobject::Rectangle*>(&mobject)) {
+    push_command({to_ring(rectangle->vertices())}, FillRule::kNonZero, opacity, output);
+    return;
+  }
+  if (const auto* triangle = dynamic_cast<const mobject::Triangle*>(&mobject)) {
+    push_command({to_ring(triangle->vertices())}, FillRule::kNonZero, opacity, output);
+    return;
+  }
+  if (const auto* polygon = dynamic_cast<const mobject::RegularPolygon*>(&mobject)) {
+    push_command(place(*regular_polygon_mesh(polygon->n_sides(), polygon->radius()), c),
+                 FillRule::kNonZero, opacity, output);
+    return;
+  }
+  if (const auto* line = dynamic_cast<const mobject::Line*>(&mobject)) {
+    const auto start = line->start();
+    const auto end = line->end();
+    auto quad = stroke_segment(Vec2{start[0], start[1]}, Vec2{end[0], end[1]},
+                               kDefaultStrokeWidth);
+    if (!quad.empty()) {
+      push_command({std::move(quad)}, FillRule::kNonZero, opacity, output);
+    }
+    return;
+  }
+  if (const auto* graph = dynamic_cast<const mobject::Graph*>(&mobject)) {
+    std::vector<std::vector<Vec2>> rings;
+    for (const auto& [from, to] : graph->edges()) {
+      const auto start = graph->vertex_position(from);
+      const auto end = graph->vertex_position(to);
+      if (!start.has_value() || !end.has_value()) {
+        continue;
+      }
+      auto quad = stroke_segment(Vec2{(*start)[0], (*start)[1]},
+                                 Vec2{(*end)[0], (*end)[1]}, kDefaultStrokeWidth);
+      if (!quad.empty()) {
+        rings.push_back(std::move(quad));
+      }
+    }
+    const auto vertex_mesh = ellipse_mesh(0.08, 0.08, kCurveSegments / 3);
+    for (const auto& vertex : graph->vertices()) {
+      const auto position = graph->vertex_position(vertex);
+      if (position.has_value()) {
+        rings.push_back(std::move(place(*vertex_mesh, *position).front()));
+      }
+    }
+    if (!rings.empty()) {
+      push_command(std::move(rings), FillRule::kNonZero, opacity, output);
+    }
+  }
+}
+
+}  // namespace
+
+void append_draw_commands(const mobject::Mobject& mobject, DrawList* output) {
+  if (output == nullptr) {
+    return;
+  }
+  if (mobject.opacity() > 0.0) {
+    append_own_geometry(mobject, output);
+  }
+  for (const auto& child : mobject.submobjects()) {
+    if (child != nullptr) {
+      append_draw_commands(*child, output);
+    }
+  }
+}
+
+DrawList build_draw_list(const std::vector<std::shared_ptr<mobject::Mobject>>& mobjects) {
+  DrawList draw_list;
+  for (const auto& mobject : mobjects) {
+    if (mobject != nullptr) {
+      append_draw_commands(*mobject, &draw_list);
+    }
+  }
+  return draw_list;
+}
+
+}  // namespace manim_cpp::renderer
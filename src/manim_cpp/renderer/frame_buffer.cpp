@@ -0,0 +1,32 @@
+#include "manim_cpp/renderer/frame_buffer.hpp"
+
+namespace manim_cpp::renderer {
+
+FrameBuffer::FrameBuffer(const std::size_t width, const std::size_t height) {
+  resize(width, height);
+}
+
+void FrameBuffer::resize(const std::size_t width, const std::size_t height) {
+  width_ = width;
+  height_ = height;
+  pixels_.assign(width * height * kChannels, 0);
+}
+
+void FrameBuffer::clear(const Rgba8 color) {
+  for (std::size_t offset = 0; offset < pixels_.size(); offset += kChannels) {
+    pixels_[offset + 0] = color.r;
+    pixels_[offset + 1] = color.g;
+    pixels_[offset + 2] = color.b;
+    pixels_[offset + 3] = color.a;
+  }
+}
+
+Rgba8 FrameBuffer::pixel(const std::size_t x, const std::size_t y) const {
+  if (x >= width_ || y >= height_) {
+    return Rgba8{0, 0, 0, 0};
+  }
+  const std::uint8_t* value = row(y) + x * kChannels;
+  return Rgba8{value[0], value[1], value[2], value[3]};
+}
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,120 @@
+#include "manim_cpp/renderer/frame_cache.hpp"
+
+#include <utility>
+
+namespace manim_cpp::renderer {
+
+FrameHash hash_draw_state(const DrawList& draw_list, const RasterSettings& settings) {
+  FrameHasher hasher;
+  hasher.update_u64(settings.pixel_width);
+  hasher.update_u64(settings.pixel_height);
+  hasher.update_double(settings.frame_height);
+  hasher.update_u64((static_cast<std::uint64_t>(settings.background.r) << 24U) |
+                    (static_cast<std::uint64_t>(settings.background.g) << 16U) |
+                    (static_cast<std::uint64_t>(settings.background.b) << 8U) |
+                    settings.background.a);
+  hasher.update_u64(settings.vertical_samples);
+
+  hasher.update_u64(draw_list.size());
+  for (const auto& command : draw_list) {
+    hasher.update_u64(command.fill_rule == FillRule::kEvenOdd ? 1 : 0);
+    hasher.update_u64((static_cast<std::uint64_t>(command.color.r) << 24U) |
+                      (static_cast<std::uint64_t>(command.color.g) << 16U) |
+                      (static_cast<std::uint64_t>(command.color.b) << 8U) |
+                      command.color.a);
+    hasher.update_double(command.opacity);
+    hasher.update_u64(command.rings.size());
+    for (const auto& ring : command.rings) {
+      hasher.update_u64(ring.size());
+      for (const auto& point : ring) {
+        hasher.update_double(point[0]);
+        hasher.update_double(point[1]);
+      }
+    }
+  }
+  return hasher.finish();
+}
+
+FrameHash hash_frame_signature(const std::string_view frame_signature) {
+  FrameHasher hasher;
+  hasher.update(frame_signature);
+  return hasher.finish();
+}
+
+FrameCache::FrameCache(const std::size_t max_bytes) : max_bytes_(max_bytes) {}
+
+void FrameCache::set_max_bytes(const std::size_t max_bytes) {
+  max_bytes_ = max_bytes;
+  evict_to(max_bytes_);
+}
+
+bool FrameCache::contains(const FrameHash& hash) const { return index_.contains(hash); }
+
+SharedFrame FrameCache::find(const FrameHash& hash) {
+  const auto it = index_.find(hash);
+  if (it == index_.end() || it->second->frame == nullptr) {
+    ++misses_;
+    return nullptr;
+  }
+  ++hits_;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return it->second->frame;
+}
+
+bool FrameCache::remember(const FrameHash& hash) {
+  if (const auto it = index_.find(hash); it != index_.end()) {
+    ++hits_;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return true;
+  }
+  ++misses_;
+  insert(hash, nullptr);
+  return false;
+}
+
+bool FrameCache::insert(const FrameHash& hash, SharedFrame frame) {
+  // A rejected frame must not leave a stale one behind under its hash.
+  erase(hash);
+  const std::size_t cost = charge(frame);
+  if (cost > max_bytes_) {
+    return false;
+  }
+
+  evict_to(max_bytes_ - cost);
+  entries_.push_front(Entry{.hash = hash, .frame = std::move(frame)});
+  index_[hash] = entries_.begin();
+  used_bytes_ += cost;
+  return true;
+}
+
+void FrameCache::clear() {
+  entries_.clear();
+  index_.clear();
+  used_bytes_ = 0;
+}
+
+std::size_t FrameCache::charge(const SharedFrame& frame) {
+  return (frame == nullptr ? 0 : frame->byte_size()) + kEntryOverheadBytes;
+}
+
+void FrameCache::erase(const FrameHash& hash) {
+  const auto it = index_.find(hash);
+  if (it == index_.end()) {
+    return;
+  }
+  used_bytes_ -= charge(it->second->frame);
+  entries_.erase(it->second);
+  index_.erase(it);
+}
+
+void FrameCache::evict_to(const std::size_t max_bytes) {
+  while (used_bytes_ > max_bytes && !entries_.empty()) {
+    const auto& victim = entries_.back();
+    used_bytes_ -= charge(victim.frame);
+    index_.erase(victim.hash);
+    entries_.pop_back();
+    ++evictions_;
+  }
+}
+
+}  // namespace manim_cpp::renderer
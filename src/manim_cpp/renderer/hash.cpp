@@ -0,0 +1,632 @@
+#include "manim_cpp/renderer/hash.hpp"
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define MANIM_CPP_HASH_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace manim_cpp::renderer {
+namespace {
+
+// hash_file() reads and hashes in chunks of this size.
+constexpr std::size_t kFileChunkBytes = 64 * 1024;
+
+constexpr std::uint64_t kPrime32_1 = 0x9E3779B1ULL;
+constexpr std::uint64_t kPrime32_2 = 0x85EBCA77ULL;
+constexpr std::uint64_t kPrime32_3 = 0xC2B2AE3DULL;
+constexpr std::uint64_t kPrime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr std::uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr std::uint64_t kPrime64_3 = 0x165667B19E3779F9ULL;
+constexpr std::uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr std::uint64_t kPrime64_5 = 0x27D4EB2F165667C5ULL;
+constexpr std::uint64_t kPrimeMx1 = 0x165667919E3779F9ULL;
+constexpr std::uint64_t kPrimeMx2 = 0x9FB21C651E98DF25ULL;
+
+constexpr std::size_t kSecretSize = 192;
+constexpr std::size_t kStripeSize = 64;
+// Secret bytes the key window advances by per stripe.
+constexpr std::size_t kSecretConsumeRate = 8;
+constexpr std::size_t kStripesPerBlock = (kSecretSize - kStripeSize) / kSecretConsumeRate;
+constexpr std::size_t kBlockSize = kStripeSize * kStripesPerBlock;
+constexpr std::size_t kMidSizeMax = 240;
+constexpr std::size_t kMidSizeStartOffset = 3;
+constexpr std::size_t kMidSizeLastOffset = 17;
+constexpr std::size_t kSecretSizeMin = 136;
+// Deliberately unaligned, so the last stripe and the merge see different
+// secret bytes than the accumulate and scramble steps.
+constexpr std::size_t kLastStripeSecretOffset = 7;
+constexpr std::size_t kMergeSecretOffset = 11;
+
+// The default XXH3 secret, taken from FARSH.
+alignas(64) constexpr std::uint8_t kSecret[kSecretSize] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+constexpr std::array<std::uint64_t, 8> kInitialAccumulators = {
+    kPrime32_3, kPrime64_1, kPrime64_2, kPrime64_3, kPrime64_4, kPrime32_2, kPrime64_5, kPrime32_1};
+
+std::uint32_t read32(const std::uint8_t* bytes) {
+  std::uint32_t value = 0;
+  std::memcpy(&value, bytes, sizeof(value));
+  if constexpr (std::endian::native == std::endian::big) {
+    value = std::byteswap(value);
+  }
+  return value;
+}
+
+std::uint64_t read64(const std::uint8_t* bytes) {
+  std::uint64_t value = 0;
+  std::memcpy(&value, bytes, sizeof(value));
+  if constexpr (std::endian::native == std::endian::big) {
+    value = std::byteswap(value);
+  }
+  return value;
+}
+
+void write64(std::uint8_t* bytes, std::uint64_t value) {
+  if constexpr (std::endian::native == std::endian::big) {
+    value = std::byteswap(value);
+  }
+  std::memcpy(bytes, &value, sizeof(value));
+}
+
+// The full 128-bit product of two 64-bit values.
+FrameHash multiply_128(const std::uint64_t lhs, const std::uint64_t rhs) {
+#if defined(__SIZEOF_INT128__)
+  // __extension__ keeps -Wpedantic quiet about the non-standard type.
+  __extension__ typedef unsigned __int128 Uint128;
+  const auto product = static_cast<Uint128>(lhs) * rhs;
+  return {.high = static_cast<std::uint64_t>(product >> 64U),
+          .low = static_cast<std::uint64_t>(product)};
+#else
+  const std::uint64_t lo_lo = (lhs & 0xFFFFFFFFU) * (rhs & 0xFFFFFFFFU);
+  const std::uint64_t hi_lo = (lhs >> 32U) * (rhs & 0xFFFFFFFFU);
+  const std::uint64_t lo_hi = (lhs & 0xFFFFFFFFU) * (rhs >> 32U);
+  const std::uint64_t hi_hi = (lhs >> 32U) * (rhs >> 32U);
+  const std::uint64_t cross = (lo_lo >> 32U) + (hi_lo & 0xFFFFFFFFU) + lo_hi;
+  return {.high = (hi_lo >> 32U) + (cross >> 32U) + hi_hi,
+          .low = (cross << 32U) | (lo_lo & 0xFFFFFFFFU)};
+#endif
+}
+
+std::uint64_t multiply_fold(const std::uint64_t lhs, const std::uint64_t rhs) {
+  const FrameHash product = multiply_128(lhs, rhs);
+  return product.low ^ product.high;
+}
+
+std::uint64_t xorshift(const std::uint64_t value, const unsigned shift) {
+  return value ^ (value >> shift);
+}
+
+std::uint64_t xxh64_avalanche(std::uint64_t value) {
+  value ^= value >> 33U;
+  value *= kPrime64_2;
+  value ^= value >> 29U;
+  value *= kPrime64_3;
+  value ^= value >> 32U;
+  return value;
+}
+
+std::uint64_t avalanche(std::uint64_t value) {
+  value = xorshift(value, 37);
+  value *= kPrimeMx1;
+  return xorshift(value, 32);
+}
+
+std::uint64_t rrmxmx(std::uint64_t value, const std::uint64_t size) {
+  value ^= std::rotl(value, 49) ^ std::rotl(value, 24);
+  value *= kPrimeMx2;
+  value ^= (value >> 35U) + size;
+  value *= kPrimeMx2;
+  return xorshift(value, 28);
+}
+
+std::uint64_t mix16(const std::uint8_t* input,
+                    const std::uint8_t* secret,
+                    const std::uint64_t seed) {
+  return multiply_fold(read64(input) ^ (read64(secret) + seed),
+                       read64(input + 8) ^ (read64(secret + 8) - seed));
+}
+
+FrameHash mix32(FrameHash accumulator,
+                const std::uint8_t* first,
+                const std::uint8_t* second,
+                const std::uint8_t* secret,
+                const std::uint64_t seed) {
+  accumulator.low += mix16(first, secret, seed);
+  accumulator.low ^= read64(second) + read64(second + 8);
+  accumulator.high += mix16(second, secret + 16, seed);
+  accumulator.high ^= read64(first) + read64(first + 8);
+  return accumulator;
+}
+
+// ---- Inputs of at most kMidSizeMax bytes, always keyed by kSecret. ----
+
+std::uint64_t hash64_short(const std::uint8_t* input,
+                           const std::size_t size,
+                           const std::uint64_t seed) {
+  const std::uint8_t* secret = kSecret;
+  if (size == 0) {
+    return xxh64_avalanche(seed ^ (read64(secret + 56) ^ read64(secret + 64)));
+  }
+  if (size <= 3) {
+    const std::uint32_t combined = (static_cast<std::uint32_t>(input[0]) << 16U) |
+                                   (static_cast<std::uint32_t>(input[size >> 1U]) << 24U) |
+                                   input[size - 1] | (static_cast<std::uint32_t>(size) << 8U);
+    const std::uint64_t bitflip = (read32(secret) ^ read32(secret + 4)) + seed;
+    return xxh64_avalanche(combined ^ bitflip);
+  }
+  if (size <= 8) {
+    const std::uint64_t keyed_seed =
+        seed ^ (static_cast<std::uint64_t>(std::byteswap(static_cast<std::uint32_t>(seed))) << 32U);
+    const std::uint64_t bitflip = (read64(secret + 8) ^ read64(secret + 16)) - keyed_seed;
+    const std::uint64_t value =
+        read32(input + size - 4) + (static_cast<std::uint64_t>(read32(input)) << 32U);
+    return rrmxmx(value ^ bitflip, size);
+  }
+  if (size <= 16) {
+    const std::uint64_t bitflip_low = (read64(secret + 24) ^ read64(secret + 32)) + seed;
+    const std::uint64_t bitflip_high = (read64(secret + 40) ^ read64(secret + 48)) - seed;
+    const std::uint64_t low = read64(input) ^ bitflip_low;
+    const std::uint64_t high = read64(input + size - 8) ^ bitflip_high;
+    return avalanche(size + std::byteswap(low) + high + multiply_fold(low, high));
+  }
+  std::uint64_t accumulator = size * kPrime64_1;
+  if (size <= 128) {
+    // Pairs of 16-byte lanes from both ends, innermost pair first.
+    for (std::size_t round = (size - 1) / 32 + 1; round > 0; --round) {
+      const std::size_t i = round - 1;
+      accumulator += mix16(input + 16 * i, secret + 32 * i, seed);
+      accumulator += mix16(input + size - 16 * (i + 1), secret + 32 * i + 16, seed);
+    }
+    return avalanche(accumulator);
+  }
+  for (std::size_t i = 0; i < 8; ++i) {
+    accumulator += mix16(input + 16 * i, secret + 16 * i, seed);
+  }
+  std::uint64_t tail =
+      mix16(input + size - 16, secret + kSecretSizeMin - kMidSizeLastOffset, seed);
+  accumulator = avalanche(accumulator);
+  for (std::size_t i = 8; i < size / 16; ++i) {
+    tail += mix16(input + 16 * i, secret + 16 * (i - 8) + kMidSizeStartOffset, seed);
+  }
+  return avalanche(accumulator + tail);
+}
+
+FrameHash finish_128(const FrameHash& accumulator,
+                     const std::size_t size,
+                     const std::uint64_t seed) {
+  const std::uint64_t low = accumulator.low + accumulator.high;
+  const std::uint64_t high = (accumulator.low * kPrime64_1) + (accumulator.high * kPrime64_4) +
+                             ((size - seed) * kPrime64_2);
+  return {.high = 0 - avalanche(high), .low = avalanche(low)};
+}
+
+FrameHash hash128_short(const std::uint8_t* input,
+                        const std::size_t size,
+                        const std::uint64_t seed) {
+  const std::uint8_t* secret = kSecret;
+  if (size == 0) {
+    return {.high = xxh64_avalanche(seed ^ read64(secret + 80) ^ read64(secret + 88)),
+            .low = xxh64_avalanche(seed ^ read64(secret + 64) ^ read64(secret + 72))};
+  }
+  if (size <= 3) {
+    const std::uint32_t combined_low = (static_cast<std::uint32_t>(input[0]) << 16U) |
+                                       (static_cast<std::uint32_t>(input[size >> 1U]) << 24U) |
+                                       input[size - 1] | (static_cast<std::uint32_t>(size) << 8U);
+    const std::uint32_t combined_high = std::rotl(std::byteswap(combined_low), 13);
+    const std::uint64_t bitflip_low = (read32(secret) ^ read32(secret + 4)) + seed;
+    const std::uint64_t bitflip_high = (read32(secret + 8) ^ read32(secret + 12)) - seed;
+    return {.high = xxh64_avalanche(combined_high ^ bitflip_high),
+            .low = xxh64_avalanche(combined_low ^ bitflip_low)};
+  }
+  if (size <= 8) {
+    const std::uint64_t keyed_seed =
+        seed ^ (static_cast<std::uint64_t>(std::byteswap(static_cast<std::uint32_t>(seed))) << 32U);
+    const std::uint64_t value =
+        read32(input) + (static_cast<std::uint64_t>(read32(input + size - 4)) << 32U);
+    const std::uint64_t bitflip = (read64(secret + 16) ^ read64(secret + 24)) + keyed_seed;
+    FrameHash product = multiply_128(value ^ bitflip, kPrime64_1 + (size << 2U));
+    product.high += product.low << 1U;
+    product.low ^= product.high >> 3U;
+    product.low = xorshift(product.low, 35) * kPrimeMx2;
+    product.low = xorshift(product.low, 28);
+    product.high = avalanche(product.high);
+    return product;
+  }
+  if (size <= 16) {
+    const std::uint64_t bitflip_low = (read64(secret + 32) ^ read64(secret + 40)) - seed;
+    const std::uint64_t bitflip_high = (read64(secret + 48) ^ read64(secret + 56)) + seed;
+    const std::uint64_t low = read64(input);
+    std::uint64_t high = read64(input + size - 8);
+    FrameHash product = multiply_128(low ^ high ^ bitflip_low, kPrime64_1);
+    product.low += static_cast<std::uint64_t>(size - 1) << 54U;
+    high ^= bitflip_high;
+    product.high += high + (static_cast<std::uint32_t>(high) * (kPrime32_2 - 1));
+    product.low ^= std::byteswap(product.high);
+    FrameHash result = multiply_128(product.low, kPrime64_2);
+    result.high += product.high * kPrime64_2;
+    return {.high = avalanche(result.high), .low = avalanche(result.low)};
+  }
+  FrameHash accumulator{.high = 0, .low = size * kPrime64_1};
+  if (size <= 128) {
+    for (std::size_t round = (size - 1) / 32 + 1; round > 0; --round) {
+      const std::size_t i = round - 1;
+      accumulator = mix32(accumulator, input + 16 * i, input + size - 16 * (i + 1),
+                          secret + 32 * i, seed);
+    }
+    return finish_128(accumulator, size, seed);
+  }
+  for (std::size_t i = 32; i < 160; i += 32) {
+    accumulator = mix32(accumulator, input + i - 32, input + i - 16, secret + i - 32, seed);
+  }
+  accumulator.low = avalanche(accumulator.low);
+  accumulator.high = avalanche(accumulator.high);
+  for (std::size_t i = 160; i <= size; i += 32) {
+    accumulator = mix32(accumulator, input + i - 32, input + i - 16,
+                        secret + kMidSizeStartOffset + i - 160, seed);
+  }
+  accumulator = mix32(accumulator, input + size - 16, input + size - 32,
+                      secret + kSecretSizeMin - kMidSizeLastOffset - 16, 0 - seed);
+  return finish_128(accumulator, size, seed);
+}
+
+// ---- Inputs over kMidSizeMax bytes: eight accumulators over 64-byte stripes. ----
+
+using AccumulateFn = void (*)(std::uint64_t* accumulators,
+                              const std::uint8_t* input,
+                              const std::uint8_t* secret,
+                              std::size_t stripes);
+using ScrambleFn = void (*)(std::uint64_t* accumulators, const std::uint8_t* secret);
+
+struct StripeKernel {
+  AccumulateFn accumulate = nullptr;
+  ScrambleFn scramble = nullptr;
+};
+
+// Stripe n is keyed by the secret from byte 8n on.
+void accumulate_scalar(std::uint64_t* accumulators,
+                       const std::uint8_t* input,
+                       const std::uint8_t* secret,
+                       const std::size_t stripes) {
+  for (std::size_t stripe = 0; stripe < stripes; ++stripe) {
+    const std::uint8_t* data = input + stripe * kStripeSize;
+    const std::uint8_t* key = secret + stripe * kSecretConsumeRate;
+    for (std::size_t lane = 0; lane < 8; ++lane) {
+      const std::uint64_t value = read64(data + lane * 8);
+      const std::uint64_t keyed = value ^ read64(key + lane * 8);
+      accumulators[lane ^ 1U] += value;
+      accumulators[lane] += (keyed & 0xFFFFFFFFU) * (keyed >> 32U);
+    }
+  }
+}
+
+void scramble_scalar(std::uint64_t* accumulators, const std::uint8_t* secret) {
+  for (std::size_t lane = 0; lane < 8; ++lane) {
+    const std::uint64_t keyed = xorshift(accumulators[lane], 47) ^ read64(secret + lane * 8);
+    accumulators[lane] = keyed * kPrime32_1;
+  }
+}
+
+#if defined(MANIM_CPP_HASH_AVX2)
+
+__attribute__((target("avx2"))) __m256i load_avx2(const void* bytes) {
+  return _mm256_loadu_si256(static_cast<const __m256i*>(bytes));
+}
+
+// One stripe into one half of the accumulators: the data's 64-bit lanes are
+// added with their neighbour swapped, plus the 32x32 product of the keyed
+// lane's halves.
+__attribute__((target("avx2"))) __m256i accumulate_half_avx2(const __m256i accumulator,
+                                                             const std::uint8_t* data,
+                                                             const std::uint8_t* key) {
+  const __m256i value = load_avx2(data);
+  const __m256i keyed = _mm256_xor_si256(value, load_avx2(key));
+  const __m256i product = _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+  const __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+  return _mm256_add_epi64(product, _mm256_add_epi64(accumulator, swapped));
+}
+
+__attribute__((target("avx2"))) void accumulate_avx2(std::uint64_t* accumulators,
+                                                     const std::uint8_t* input,
+                                                     const std::uint8_t* secret,
+                                                     const std::size_t stripes) {
+  __m256i low = load_avx2(accumulators);
+  __m256i high = load_avx2(accumulators + 4);
+  for (std::size_t stripe = 0; stripe < stripes; ++stripe) {
+    const std::uint8_t* data = input + stripe * kStripeSize;
+    const std::uint8_t* key = secret + stripe * kSecretConsumeRate;
+    low = accumulate_half_avx2(low, data, key);
+    high = accumulate_half_avx2(high, data + 32, key + 32);
+  }
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators), low);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators + 4), high);
+}
+
+__attribute__((target("avx2"))) __m256i scramble_half_avx2(const __m256i accumulator,
+                                                           const std::uint8_t* key) {
+  const __m256i prime = _mm256_set1_epi32(static_cast<int>(kPrime32_1));
+  const __m256i keyed = _mm256_xor_si256(
+      _mm256_xor_si256(accumulator, _mm256_srli_epi64(accumulator, 47)), load_avx2(key));
+  // 64x32-bit multiply from two 32x32 products.
+  const __m256i product_low = _mm256_mul_epu32(keyed, prime);
+  const __m256i product_high = _mm256_mul_epu32(_mm256_srli_epi64(keyed, 32), prime);
+  return _mm256_add_epi64(product_low, _mm256_slli_epi64(product_high, 32));
+}
+
+__attribute__((target("avx2"))) void scramble_avx2(std::uint64_t* accumulators,
+                                                   const std::uint8_t* secret) {
+  const __m256i low = scramble_half_avx2(load_avx2(accumulators), secret);
+  const __m256i high = scramble_half_avx2(load_avx2(accumulators + 4), secret + 32);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators), low);
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators + 4), high);
+}
+
+bool cpu_has_avx2() {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2") != 0;
+  return has_avx2;
+}
+
+#endif
+
+constexpr StripeKernel kScalarKernel{.accumulate = accumulate_scalar, .scramble = scramble_scalar};
+
+const StripeKernel& best_kernel() {
+#if defined(MANIM_CPP_HASH_AVX2)
+  static constexpr StripeKernel kAvx2Kernel{.accumulate = accumulate_avx2,
+                                            .scramble = scramble_avx2};
+  if (cpu_has_avx2()) {
+    return kAvx2Kernel;
+  }
+#endif
+  return kScalarKernel;
+}
+
+// kSecret with the seed added to the first and subtracted from the second
+// 64-bit word of every 16 bytes.
+std::array<std::uint8_t, kSecretSize> seeded_secret(const std::uint64_t seed) {
+  std::array<std::uint8_t, kSecretSize> secret{};
+  for (std::size_t i = 0; i < kSecretSize; i += 16) {
+    write64(secret.data() + i, read64(kSecret + i) + seed);
+    write64(secret.data() + i + 8, read64(kSecret + i + 8) - seed);
+  }
+  return secret;
+}
+
+std::array<std::uint64_t, 8> accumulate_long(const std::uint8_t* input,
+                                             const std::size_t size,
+                                             const std::uint8_t* secret,
+                                             const StripeKernel& kernel) {
+  auto accumulators = kInitialAccumulators;
+  const std::size_t blocks = (size - 1) / kBlockSize;
+  for (std::size_t block = 0; block < blocks; ++block) {
+    kernel.accumulate(accumulators.data(), input + block * kBlockSize, secret, kStripesPerBlock);
+    kernel.scramble(accumulators.data(), secret + kSecretSize - kStripeSize);
+  }
+  const std::size_t stripes = ((size - 1) - (blocks * kBlockSize)) / kStripeSize;
+  kernel.accumulate(accumulators.data(), input + blocks * kBlockSize, secret, stripes);
+  // The last stripe ends at the last byte, overlapping earlier stripes.
+  kernel.accumulate(accumulators.data(), input + size - kStripeSize,
+                    secret + kSecretSize - kStripeSize - kLastStripeSecretOffset, 1);
+  return accumulators;
+}
+
+std::uint64_t merge_accumulators(const std::array<std::uint64_t, 8>& accumulators,
+                                 const std::uint8_t* secret,
+                                 std::uint64_t start) {
+  for (std::size_t i = 0; i < 4; ++i) {
+    start += multiply_fold(accumulators[2 * i] ^ read64(secret + 16 * i),
+                           accumulators[2 * i + 1] ^ read64(secret + 16 * i + 8));
+  }
+  return avalanche(start);
+}
+
+FrameHash merge_128(const std::array<std::uint64_t, 8>& accumulators,
+                    const std::uint8_t* secret,
+                    const std::uint64_t size) {
+  return {.high = merge_accumulators(accumulators,
+                                     secret + kSecretSize - kStripeSize - kMergeSecretOffset,
+                                     ~(size * kPrime64_2)),
+          .low = merge_accumulators(accumulators, secret + kMergeSecretOffset, size * kPrime64_1)};
+}
+
+FrameHash hash128_with(const std::span<const std::uint8_t> bytes,
+                       const std::uint64_t seed,
+                       const StripeKernel& kernel) {
+  if (bytes.size() <= kMidSizeMax) {
+    return hash128_short(bytes.data(), bytes.size(), seed);
+  }
+  if (seed == 0) {
+    return merge_128(accumulate_long(bytes.data(), bytes.size(), kSecret, kernel), kSecret,
+                     bytes.size());
+  }
+  const auto secret = seeded_secret(seed);
+  return merge_128(accumulate_long(bytes.data(), bytes.size(), secret.data(), kernel),
+                   secret.data(), bytes.size());
+}
+
+// Streaming counterpart of accumulate_long(): accumulates whole stripes,
+// scrambling each time a block of kStripesPerBlock fills up.
+const std::uint8_t* consume_stripes(std::uint64_t* accumulators,
+                                    std::size_t* block_stripes,
+                                    const std::uint8_t* input,
+                                    std::size_t stripes,
+                                    const StripeKernel& kernel) {
+  const std::uint8_t* secret = kSecret + *block_stripes * kSecretConsumeRate;
+  if (stripes >= kStripesPerBlock - *block_stripes) {
+    std::size_t block_rest = kStripesPerBlock - *block_stripes;
+    do {
+      kernel.accumulate(accumulators, input, secret, block_rest);
+      kernel.scramble(accumulators, kSecret + kSecretSize - kStripeSize);
+      input += block_rest * kStripeSize;
+      stripes -= block_rest;
+      block_rest = kStripesPerBlock;
+      secret = kSecret;
+    } while (stripes >= kStripesPerBlock);
+    *block_stripes = 0;
+  }
+  if (stripes > 0) {
+    kernel.accumulate(accumulators, input, secret, stripes);
+    input += stripes * kStripeSize;
+    *block_stripes += stripes;
+  }
+  return input;
+}
+
+}  // namespace
+
+std::string FrameHash::to_hex() const {
+  std::ostringstream stream;
+  stream << std::hex << std::setfill('0') << std::setw(16) << high << std::setw(16) << low;
+  return stream.str();
+}
+
+std::uint64_t hash64(const std::span<const std::uint8_t> bytes, const std::uint64_t seed) {
+  if (bytes.size() <= kMidSizeMax) {
+    return hash64_short(bytes.data(), bytes.size(), seed);
+  }
+  const StripeKernel& kernel = best_kernel();
+  if (seed == 0) {
+    return merge_accumulators(accumulate_long(bytes.data(), bytes.size(), kSecret, kernel),
+                              kSecret + kMergeSecretOffset, bytes.size() * kPrime64_1);
+  }
+  const auto secret = seeded_secret(seed);
+  return merge_accumulators(accumulate_long(bytes.data(), bytes.size(), secret.data(), kernel),
+                            secret.data() + kMergeSecretOffset, bytes.size() * kPrime64_1);
+}
+
+FrameHash hash128(const std::span<const std::uint8_t> bytes, const std::uint64_t seed) {
+  return hash128_with(bytes, seed, best_kernel());
+}
+
+FrameHash hash128_scalar(const std::span<const std::uint8_t> bytes, const std::uint64_t seed) {
+  return hash128_with(bytes, seed, kScalarKernel);
+}
+
+FrameHash hash_frame_buffer(const FrameBuffer& frame) {
+  FrameHasher hasher;
+  hasher.update_u64(frame.width());
+  hasher.update_u64(frame.height());
+  hasher.update(frame.data(), frame.byte_size());
+  return hasher.finish();
+}
+
+std::optional<FrameHash> hash_file(const std::filesystem::path& path) {
+  std::ifstream input(path, std::ios::binary);
+  if (!input.is_open()) {
+    return std::nullopt;
+  }
+  FrameHasher hasher;
+  std::vector<char> chunk(kFileChunkBytes);
+  while (input) {
+    input.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    hasher.update(chunk.data(), static_cast<std::size_t>(input.gcount()));
+  }
+  if (input.bad()) {
+    return std::nullopt;
+  }
+  return hasher.finish();
+}
+
+const char* hash_kernel_name() {
+#if defined(MANIM_CPP_HASH_AVX2)
+  return cpu_has_avx2() ? "avx2" : "scalar";
+#else
+  return "scalar";
+#endif
+}
+
+FrameHasher::FrameHasher() : accumulators_(kInitialAccumulators) {}
+
+void FrameHasher::update(const void* data, std::size_t size) {
+  const auto* input = static_cast<const std::uint8_t*>(data);
+  total_size_ += size;
+  if (size <= kBufferSize - buffered_size_) {
+    if (size > 0) {
+      std::memcpy(buffer_.data() + buffered_size_, input, size);
+    }
+    buffered_size_ += size;
+    return;
+  }
+
+  // The buffer only ever flushes when more input follows, so whatever it
+  // holds at finish() still contains the final stripe.
+  const StripeKernel& kernel = best_kernel();
+  const std::uint8_t* const end = input + size;
+  if (buffered_size_ > 0) {
+    const std::size_t fill = kBufferSize - buffered_size_;
+    std::memcpy(buffer_.data() + buffered_size_, input, fill);
+    input += fill;
+    consume_stripes(accumulators_.data(), &block_stripes_, buffer_.data(),
+                    kBufferSize / kStripeSize, kernel);
+    buffered_size_ = 0;
+  }
+  if (static_cast<std::size_t>(end - input) > kBufferSize) {
+    const std::size_t stripes = static_cast<std::size_t>(end - 1 - input) / kStripeSize;
+    input = consume_stripes(accumulators_.data(), &block_stripes_, input, stripes, kernel);
+    // finish() may need the previous stripe when little input follows.
+    std::memcpy(buffer_.data() + kBufferSize - kStripeSize, input - kStripeSize, kStripeSize);
+  }
+  buffered_size_ = static_cast<std::size_t>(end - input);
+  std::memcpy(buffer_.data(), input, buffered_size_);
+}
+
+void FrameHasher::update(const std::string_view text) {
+  update_u64(text.size());
+  update(text.data(), text.size());
+}
+
+void FrameHasher::update_u64(const std::uint64_t value) {
+  std::uint8_t bytes[8];
+  write64(bytes, value);
+  update(bytes, sizeof(bytes));
+}
+
+void FrameHasher::update_double(const double value) {
+  update_u64(std::bit_cast<std::uint64_t>(value == 0.0 ? 0.0 : value));
+}
+
+FrameHash FrameHasher::finish() const {
+  if (total_size_ <= kMidSizeMax) {
+    return hash128_short(buffer_.data(), static_cast<std::size_t>(total_size_), 0);
+  }
+
+  const StripeKernel& kernel = best_kernel();
+  auto accumulators = accumulators_;
+  std::uint8_t last_stripe[kStripeSize];
+  const std::uint8_t* last_stripe_start = last_stripe;
+  if (buffered_size_ >= kStripeSize) {
+    std::size_t block_stripes = block_stripes_;
+    consume_stripes(accumulators.data(), &block_stripes, buffer_.data(),
+                    (buffered_size_ - 1) / kStripeSize, kernel);
+    last_stripe_start = buffer_.data() + buffered_size_ - kStripeSize;
+  } else {
+    // The stripe ending at the last byte starts in the previous buffer fill.
+    const std::size_t carried = kStripeSize - buffered_size_;
+    std::memcpy(last_stripe, buffer_.data() + kBufferSize - carried, carried);
+    std::memcpy(last_stripe + carried, buffer_.data(), buffered_size_);
+  }
+  kernel.accumulate(accumulators.data(), last_stripe_start,
+                    kSecret + kSecretSize - kStripeSize - kLastStripeSecretOffset, 1);
+  return merge_128(accumulators, kSecret, total_size_);
+}
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,28 @@
+#include "manim_cpp/renderer/image_io.hpp"
+
+#include <fstream>
+
+#include "manim_cpp/renderer/png_encoder.hpp"
+
+namespace manim_cpp::renderer {
+
+std::vector<std::uint8_t> encode_png(const FrameBuffer& frame) {
+  PngEncoder encoder({.worker_count = 1});
+  return encoder.encode(frame);
+}
+
+bool write_png(const std::filesystem::path& output_path, const FrameBuffer& frame) {
+  const auto png = encode_png(frame);
+  if (png.empty()) {
+    return false;
+  }
+  std::ofstream output(output_path, std::ios::binary | std::ios::trunc);
+  if (!output.is_open()) {
+    return false;
+  }
+  output.write(reinterpret_cast<const char*>(png.data()),
+               static_cast<std::streamsize>(png.size()));
+  return output.good();
+}
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,107 @@
+#include "manim_cpp/renderer/mesh_cache.hpp"
+
+#include <utility>
+
+#include "manim_cpp/math/triangulation.hpp"
+#include "manim_cpp/renderer/hash.hpp"
+
+namespace manim_cpp::renderer {
+
+std::size_t MeshKeyHasher::operator()(const MeshKey& key) const {
+  FrameHasher hasher;
+  hasher.update_u64(static_cast<std::uint64_t>(key.shape));
+  for (const double parameter : key.parameters) {
+    hasher.update_double(parameter);
+  }
+  hasher.update_u64(key.segments);
+  return FrameHashHasher{}(hasher.finish());
+}
+
+Mesh::Mesh(std::vector<std::vector<math::Vec2>> rings) : rings_(std::move(rings)) {}
+
+const std::vector<uint32_t>& Mesh::indices() const {
+  std::call_once(indices_once_, [this] {
+    if (rings_.empty()) {
+      return;
+    }
+    const std::vector<std::vector<math::Vec2>> holes(rings_.begin() + 1, rings_.end());
+    indices_ = math::triangulate_polygon_with_holes(rings_.front(), holes);
+  });
+  return indices_;
+}
+
+double MeshCacheStats::hit_rate() const {
+  const std::size_t lookups = hits + misses;
+  return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+MeshCache::MeshCache(const std::size_t max_entries) : max_entries_(max_entries) {}
+
+MeshCache& MeshCache::global() {
+  static MeshCache cache;
+  return cache;
+}
+
+std::shared_ptr<const Mesh> MeshCache::find_or_build(
+    const MeshKey& key, const std::function<std::vector<std::vector<math::Vec2>>()>& tessellate) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = index_.find(key);
+    if (it != index_.end()) {
+      ++hits_;
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->mesh;
+    }
+    ++misses_;
+  }
+
+  auto mesh = std::make_shared<const Mesh>(tessellate());
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = index_.find(key);
+  if (it != index_.end()) {
+    return it->second->mesh;
+  }
+  if (max_entries_ == 0) {
+    return mesh;
+  }
+  evict_to(max_entries_ - 1);
+  entries_.push_front(Entry{.key = key, .mesh = mesh});
+  index_[key] = entries_.begin();
+  return mesh;
+}
+
+std::size_t MeshCache::max_entries() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_entries_;
+}
+
+void MeshCache::set_max_entries(const std::size_t max_entries) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  max_entries_ = max_entries;
+  evict_to(max_entries_);
+}
+
+MeshCacheStats MeshCache::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return MeshCacheStats{
+      .hits = hits_, .misses = misses_, .evictions = evictions_, .entries = entries_.size()};
+}
+
+void MeshCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  hits_ = 0;
+  misses_ = 0;
+  evictions_ = 0;
+}
+
+void MeshCache::evict_to(const std::size_t max_entries) {
+  while (entries_.size() > max_entries) {
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+    ++evictions_;
+  }
+}
+
+}  // namespace manim_cpp::renderer
@@ -39,9 +39,17 @@ bool OpenGLRenderer::should_render_for_signature(
   if (frame_signature.empty()) {
     return true;
   }
-  return seen_frame_signatures_.insert(frame_signature).second;
+  return should_render_for_hash(hash_frame_signature(frame_signature));
 }
 
-void OpenGLRenderer::reset_frame_cache() { seen_frame_signatures_.clear(); }
+bool OpenGLRenderer::should_render_for_hash(const FrameHash& frame_hash) {
+  return !frame_cache_.remember(frame_hash);
+}
+
+void OpenGLRenderer::reset_frame_cache() { frame_cache_.clear(); }
+
+void OpenGLRenderer::set_frame_cache_max_bytes(const std::size_t max_bytes) {
+  frame_cache_.set_max_bytes(max_bytes);
+}
 
 }  // namespace manim_cpp::renderer
@@ -0,0 +1,104 @@
+#include "manim_cpp/renderer/pixel_convert.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MANIM_CPP_PIXEL_SSSE3 1
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#define MANIM_CPP_PIXEL_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace manim_cpp::renderer {
+namespace {
+
+#if defined(MANIM_CPP_PIXEL_SSSE3)
+
+// 16 pixels per iteration: each 16-byte load of four RGBA pixels shuffles to
+// 12 RGB bytes, and the four results are spliced into three 16-byte stores.
+__attribute__((target("ssse3"))) void rgba_to_rgb_ssse3(const std::uint8_t* rgba,
+                                                        const std::size_t pixel_count,
+                                                        std::uint8_t* rgb) {
+  const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+  std::size_t pixel = 0;
+  for (; pixel + 16 <= pixel_count; pixel += 16) {
+    const auto* source = reinterpret_cast<const __m128i*>(rgba + pixel * 4);
+    const __m128i a = _mm_shuffle_epi8(_mm_loadu_si128(source + 0), pack);
+    const __m128i b = _mm_shuffle_epi8(_mm_loadu_si128(source + 1), pack);
+    const __m128i c = _mm_shuffle_epi8(_mm_loadu_si128(source + 2), pack);
+    const __m128i d = _mm_shuffle_epi8(_mm_loadu_si128(source + 3), pack);
+    auto* target = reinterpret_cast<__m128i*>(rgb + pixel * 3);
+    // a[0..11] b[0..3] | b[4..11] c[0..7] | c[8..11] d[0..11]
+    _mm_storeu_si128(target + 0, _mm_or_si128(a, _mm_slli_si128(b, 12)));
+    _mm_storeu_si128(target + 1, _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+    _mm_storeu_si128(target + 2, _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(d, 4)));
+  }
+  rgba_to_rgb_scalar(rgba + pixel * 4, pixel_count - pixel, rgb + pixel * 3);
+}
+
+bool cpu_has_ssse3() {
+  static const bool has_ssse3 = __builtin_cpu_supports("ssse3") != 0;
+  return has_ssse3;
+}
+
+#elif defined(MANIM_CPP_PIXEL_NEON)
+
+void rgba_to_rgb_neon(const std::uint8_t* rgba, const std::size_t pixel_count, std::uint8_t* rgb) {
+  std::size_t pixel = 0;
+  for (; pixel + 16 <= pixel_count; pixel += 16) {
+    const uint8x16x4_t source = vld4q_u8(rgba + pixel * 4);
+    uint8x16x3_t target;
+    target.val[0] = source.val[0];
+    target.val[1] = source.val[1];
+    target.val[2] = source.val[2];
+    vst3q_u8(rgb + pixel * 3, target);
+  }
+  rgba_to_rgb_scalar(rgba + pixel * 4, pixel_count - pixel, rgb + pixel * 3);
+}
+
+#endif
+
+}  // namespace
+
+void rgba_to_rgb_scalar(const std::uint8_t* rgba,
+                        const std::size_t pixel_count,
+                        std::uint8_t* rgb) {
+  for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+    rgb[pixel * 3 + 0] = rgba[pixel * 4 + 0];
+    rgb[pixel * 3 + 1] = rgba[pixel * 4 + 1];
+    rgb[pixel * 3 + 2] = rgba[pixel * 4 + 2];
+  }
+}
+
+void rgba_to_rgb(const std::uint8_t* rgba, const std::size_t pixel_count, std::uint8_t* rgb) {
+#if defined(MANIM_CPP_PIXEL_SSSE3)
+  if (cpu_has_ssse3()) {
+    rgba_to_rgb_ssse3(rgba, pixel_count, rgb);
+    return;
+  }
+#elif defined(MANIM_CPP_PIXEL_NEON)
+  rgba_to_rgb_neon(rgba, pixel_count, rgb);
+  return;
+#endif
+  rgba_to_rgb_scalar(rgba, pixel_count, rgb);
+}
+
+void rgb_to_rgba(const std::uint8_t* rgb, const std::size_t pixel_count, std::uint8_t* rgba) {
+  for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+    rgba[pixel * 4 + 0] = rgb[pixel * 3 + 0];
+    rgba[pixel * 4 + 1] = rgb[pixel * 3 + 1];
+    rgba[pixel * 4 + 2] = rgb[pixel * 3 + 2];
+    rgba[pixel * 4 + 3] = 255;
+  }
+}
+
+const char* pixel_converter_name() {
+#if defined(MANIM_CPP_PIXEL_SSSE3)
+  return cpu_has_ssse3() ? "ssse3" : "scalar";
+#elif defined(MANIM_CPP_PIXEL_NEON)
+  return "neon";
+#else
+  return "scalar";
+#endif
+}
+
+}  // namespace manim_cpp::renderer
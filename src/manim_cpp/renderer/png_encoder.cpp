@@ -0,0 +1,425 @@
+#include "manim_cpp/renderer/png_encoder.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MANIM_CPP_PNG_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace manim_cpp::renderer {
+namespace {
+
+constexpr std::array<std::uint8_t, 8> kPngSignature = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+constexpr std::size_t kBytesPerPixel = FrameBuffer::kChannels;
+constexpr std::size_t kFilterCount = 5;
+constexpr std::size_t kDeflateWindowBytes = 32 * 1024;
+// Rows per filtering task are sized to keep a band in L2.
+constexpr std::size_t kFilterBandBytes = 256 * 1024;
+
+enum FilterType : std::uint8_t {
+  kFilterNone = 0,
+  kFilterSub = 1,
+  kFilterUp = 2,
+  kFilterAverage = 3,
+  kFilterPaeth = 4,
+};
+
+// Heuristic cost of a filtered byte: its magnitude read as a signed value.
+std::uint32_t filter_cost(const std::uint8_t value) {
+  return value < 128 ? value : 256U - value;
+}
+
+std::uint8_t paeth_predictor(const int a, const int b, const int c) {
+  const int pa = std::abs(b - c);
+  const int pb = std::abs(a - c);
+  const int pc = std::abs(a + b - 2 * c);
+  if (pa <= pb && pa <= pc) {
+    return static_cast<std::uint8_t>(a);
+  }
+  return static_cast<std::uint8_t>(pb <= pc ? b : c);
+}
+
+int filter_predictor(const std::uint8_t filter, const int a, const int b, const int c) {
+  switch (filter) {
+    case kFilterSub:
+      return a;
+    case kFilterUp:
+      return b;
+    case kFilterAverage:
+      return (a + b) >> 1;
+    case kFilterPaeth:
+      return paeth_predictor(a, b, c);
+    default:
+      return 0;
+  }
+}
+
+// Adds every filter's cost over bytes [begin, stride) to costs.
+void filter_costs_scalar(const std::uint8_t* row,
+                         const std::uint8_t* previous,
+                         const std::size_t stride,
+                         const std::size_t begin,
+                         std::uint64_t* costs) {
+  for (std::size_t x = begin; x < stride; ++x) {
+    const int a = x >= kBytesPerPixel ? row[x - kBytesPerPixel] : 0;
+    const int b = previous[x];
+    const int c = x >= kBytesPerPixel ? previous[x - kBytesPerPixel] : 0;
+    for (std::uint8_t filter = kFilterNone; filter < kFilterCount; ++filter) {
+      costs[filter] +=
+          filter_cost(static_cast<std::uint8_t>(row[x] - filter_predictor(filter, a, b, c)));
+    }
+  }
+}
+
+void apply_filter_scalar(const std::uint8_t filter,
+                         const std::uint8_t* row,
+                         const std::uint8_t* previous,
+                         const std::size_t stride,
+                         const std::size_t begin,
+                         std::uint8_t* output) {
+  for (std::size_t x = begin; x < stride; ++x) {
+    const int a = x >= kBytesPerPixel ? row[x - kBytesPerPixel] : 0;
+    const int c = x >= kBytesPerPixel ? previous[x - kBytesPerPixel] : 0;
+    output[x] = static_cast<std::uint8_t>(row[x] - filter_predictor(filter, a, previous[x], c));
+  }
+}
+
+#if defined(MANIM_CPP_PNG_SSE2)
+
+// Sum of |signed byte| over 16 bytes, accumulated into two 64-bit lanes.
+__m128i accumulate_cost_sse2(const __m128i sum, const __m128i filtered) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i magnitude = _mm_min_epu8(filtered, _mm_sub_epi8(zero, filtered));
+  return _mm_add_epi64(sum, _mm_sad_epu8(magnitude, zero));
+}
+
+__m128i abs_epi16_sse2(const __m128i value) {
+  return _mm_max_epi16(value, _mm_sub_epi16(_mm_setzero_si128(), value));
+}
+
+// Paeth prediction on eight 16-bit lanes.
+__m128i paeth8_sse2(const __m128i a, const __m128i b, const __m128i c) {
+  const __m128i pa = abs_epi16_sse2(_mm_sub_epi16(b, c));
+  const __m128i pb = abs_epi16_sse2(_mm_sub_epi16(a, c));
+  const __m128i pc = abs_epi16_sse2(_mm_add_epi16(_mm_sub_epi16(a, c), _mm_sub_epi16(b, c)));
+  // not_a: pa > pb || pa > pc; not_b: pb > pc.
+  const __m128i not_a = _mm_or_si128(_mm_cmpgt_epi16(pa, pb), _mm_cmpgt_epi16(pa, pc));
+  const __m128i not_b = _mm_cmpgt_epi16(pb, pc);
+  const __m128i b_or_c = _mm_or_si128(_mm_andnot_si128(not_b, b), _mm_and_si128(not_b, c));
+  return _mm_or_si128(_mm_andnot_si128(not_a, a), _mm_and_si128(not_a, b_or_c));
+}
+
+__m128i paeth16_sse2(const __m128i a, const __m128i b, const __m128i c) {
+  const __m128i zero = _mm_setzero_si128();
+  return _mm_packus_epi16(
+      paeth8_sse2(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero),
+                  _mm_unpacklo_epi8(c, zero)),
+      paeth8_sse2(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero),
+                  _mm_unpackhi_epi8(c, zero)));
+}
+
+// _mm_avg_epu8 rounds up; PNG's average truncates.
+__m128i average16_sse2(const __m128i a, const __m128i b) {
+  return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+}
+
+__m128i load16_sse2(const std::uint8_t* pointer) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pointer));
+}
+
+// Loads the 16 bytes at x with their left (a) and upper-left (c)
+// neighbours; the neighbours left of the first pixel are zero.
+void load_neighbours_sse2(const std::uint8_t* row,
+                          const std::uint8_t* previous,
+                          const std::size_t x,
+                          __m128i* raw,
+                          __m128i* a,
+                          __m128i* b,
+                          __m128i* c) {
+  *raw = load16_sse2(row + x);
+  *b = load16_sse2(previous + x);
+  *a = x == 0 ? _mm_slli_si128(*raw, kBytesPerPixel) : load16_sse2(row + x - kBytesPerPixel);
+  *c = x == 0 ? _mm_slli_si128(*b, kBytesPerPixel) : load16_sse2(previous + x - kBytesPerPixel);
+}
+
+// Both return the first byte left to the scalar tail.
+std::size_t filter_costs_sse2(const std::uint8_t* row,
+                              const std::uint8_t* previous,
+                              const std::size_t stride,
+                              std::uint64_t* costs) {
+  __m128i sums[kFilterCount];
+  for (auto& sum : sums) {
+    sum = _mm_setzero_si128();
+  }
+  std::size_t x = 0;
+  for (; x + 16 <= stride; x += 16) {
+    __m128i raw, a, b, c;
+    load_neighbours_sse2(row, previous, x, &raw, &a, &b, &c);
+    sums[kFilterNone] = accumulate_cost_sse2(sums[kFilterNone], raw);
+    sums[kFilterSub] = accumulate_cost_sse2(sums[kFilterSub], _mm_sub_epi8(raw, a));
+    sums[kFilterUp] = accumulate_cost_sse2(sums[kFilterUp], _mm_sub_epi8(raw, b));
+    sums[kFilterAverage] =
+        accumulate_cost_sse2(sums[kFilterAverage], _mm_sub_epi8(raw, average16_sse2(a, b)));
+    sums[kFilterPaeth] =
+        accumulate_cost_sse2(sums[kFilterPaeth], _mm_sub_epi8(raw, paeth16_sse2(a, b, c)));
+  }
+  for (std::size_t filter = 0; filter < kFilterCount; ++filter) {
+    std::array<std::uint64_t, 2> lanes{};
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes.data()), sums[filter]);
+    costs[filter] += lanes[0] + lanes[1];
+  }
+  return x;
+}
+
+std::size_t apply_filter_sse2(const std::uint8_t filter,
+                              const std::uint8_t* row,
+                              const std::uint8_t* previous,
+                              const std::size_t stride,
+                              std::uint8_t* output) {
+  std::size_t x = 0;
+  for (; x + 16 <= stride; x += 16) {
+    __m128i raw, a, b, c;
+    load_neighbours_sse2(row, previous, x, &raw, &a, &b, &c);
+    __m128i predictor = _mm_setzero_si128();
+    switch (filter) {
+      case kFilterSub:
+        predictor = a;
+        break;
+      case kFilterUp:
+        predictor = b;
+        break;
+      case kFilterAverage:
+        predictor = average16_sse2(a, b);
+        break;
+      case kFilterPaeth:
+        predictor = paeth16_sse2(a, b, c);
+        break;
+      default:
+        break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + x), _mm_sub_epi8(raw, predictor));
+  }
+  return x;
+}
+
+#endif
+
+void append_u32_be(std::vector<std::uint8_t>* output, const std::uint32_t value) {
+  output->push_back(static_cast<std::uint8_t>((value >> 24U) & 0xFFU));
+  output->push_back(static_cast<std::uint8_t>((value >> 16U) & 0xFFU));
+  output->push_back(static_cast<std::uint8_t>((value >> 8U) & 0xFFU));
+  output->push_back(static_cast<std::uint8_t>(value & 0xFFU));
+}
+
+void append_chunk(std::vector<std::uint8_t>* output,
+                  const std::string_view type,
+                  const std::uint8_t* payload,
+                  const std::size_t payload_size) {
+  append_u32_be(output, static_cast<std::uint32_t>(payload_size));
+  const std::size_t type_offset = output->size();
+  output->insert(output->end(), type.begin(), type.end());
+  if (payload_size > 0) {
+    output->insert(output->end(), payload, payload + payload_size);
+  }
+  const uLong crc = crc32(0L, output->data() + type_offset,
+                          static_cast<uInt>(type.size() + payload_size));
+  append_u32_be(output, static_cast<std::uint32_t>(crc));
+}
+
+// Second byte of the zlib header (FLEVEL plus the FCHECK bits) as zlib itself
+// writes it for each level.
+std::uint8_t zlib_flags_for_level(const int level) {
+  if (level < 2) {
+    return 0x01;
+  }
+  if (level < 6) {
+    return 0x5E;
+  }
+  if (level == 6) {
+    return 0x9C;
+  }
+  return 0xDA;
+}
+
+}  // namespace
+
+struct PngEncoder::DeflateBlock {
+  std::vector<std::uint8_t> output;
+  uLong adler = 1;
+  bool ok = false;
+};
+
+std::uint8_t png_filter_row(const std::uint8_t* row,
+                            const std::uint8_t* previous,
+                            const std::size_t stride,
+                            std::uint8_t* output) {
+  thread_local std::vector<std::uint8_t> zero_row;
+  if (previous == nullptr) {
+    // The row above the image is defined as zeros.
+    zero_row.assign(stride, 0);
+    previous = zero_row.data();
+  }
+
+  std::array<std::uint64_t, kFilterCount> costs{};
+  std::size_t begin = 0;
+#if defined(MANIM_CPP_PNG_SSE2)
+  begin = filter_costs_sse2(row, previous, stride, costs.data());
+#endif
+  filter_costs_scalar(row, previous, stride, begin, costs.data());
+
+  std::uint8_t best = kFilterNone;
+  for (std::uint8_t filter = kFilterSub; filter < kFilterCount; ++filter) {
+    if (costs[filter] < costs[best]) {
+      best = filter;
+    }
+  }
+  output[0] = best;
+  if (best == kFilterNone) {
+    std::memcpy(output + 1, row, stride);
+    return best;
+  }
+  begin = 0;
+#if defined(MANIM_CPP_PNG_SSE2)
+  begin = apply_filter_sse2(best, row, previous, stride, output + 1);
+#endif
+  apply_filter_scalar(best, row, previous, stride, begin, output + 1);
+  return best;
+}
+
+PngEncoder::PngEncoder(PngEncodeSettings settings) : settings_(settings) {
+  settings_.compression_level = std::clamp(settings_.compression_level, 0, 9);
+  settings_.chunk_bytes = std::max<std::size_t>(settings_.chunk_bytes, kDeflateWindowBytes);
+}
+
+PngEncoder::~PngEncoder() = default;
+
+std::size_t PngEncoder::worker_count() const {
+  return settings_.worker_count == 0 ? default_worker_count() : settings_.worker_count;
+}
+
+void PngEncoder::for_each_task(const std::size_t task_count, const ParallelTask& task) {
+  if (worker_count() <= 1 || task_count <= 1) {
+    for (std::size_t index = 0; index < task_count; ++index) {
+      task(index);
+    }
+    return;
+  }
+  if (pool_ == nullptr) {
+    pool_ = std::make_unique<WorkStealingThreadPool>(worker_count());
+  }
+  pool_->parallel_for(task_count, task);
+}
+
+std::vector<std::uint8_t> PngEncoder::encode(const FrameBuffer& frame) {
+  if (frame.empty()) {
+    return {};
+  }
+
+  const std::size_t stride = frame.stride_bytes();
+  const std::size_t line_bytes = stride + 1;
+  const std::size_t height = frame.height();
+  filtered_.resize(line_bytes * height);
+
+  const std::size_t band_rows = std::max<std::size_t>(1, kFilterBandBytes / line_bytes);
+  const std::size_t band_count = (height + band_rows - 1) / band_rows;
+  for_each_task(band_count, [&](const std::size_t band) {
+    const std::size_t last_row = std::min(height, (band + 1) * band_rows);
+    for (std::size_t y = band * band_rows; y < last_row; ++y) {
+      std::uint8_t* line = filtered_.data() + y * line_bytes;
+      if (settings_.adaptive_filters) {
+        png_filter_row(frame.row(y), y == 0 ? nullptr : frame.row(y - 1), stride, line);
+      } else {
+        line[0] = kFilterNone;
+        std::memcpy(line + 1, frame.row(y), stride);
+      }
+    }
+  });
+
+  const std::size_t block_count =
+      (filtered_.size() + settings_.chunk_bytes - 1) / settings_.chunk_bytes;
+  blocks_.resize(block_count);
+  for_each_task(block_count, [&](const std::size_t index) {
+    auto& block = blocks_[index];
+    block.ok = false;
+    const std::size_t begin = index * settings_.chunk_bytes;
+    const std::size_t size = std::min(settings_.chunk_bytes, filtered_.size() - begin);
+    const bool last = index + 1 == block_count;
+
+    z_stream stream{};
+    if (deflateInit2(&stream, settings_.compression_level, Z_DEFLATED, -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      return;
+    }
+    if (begin > 0) {
+      const std::size_t dictionary_size = std::min(begin, kDeflateWindowBytes);
+      deflateSetDictionary(&stream, filtered_.data() + begin - dictionary_size,
+                           static_cast<uInt>(dictionary_size));
+    }
+    // A sync flush appends at most an empty stored block beyond the bound.
+    block.output.resize(deflateBound(&stream, static_cast<uLong>(size)) + 16);
+    stream.next_in = filtered_.data() + begin;
+    stream.avail_in = static_cast<uInt>(size);
+    stream.next_out = block.output.data();
+    stream.avail_out = static_cast<uInt>(block.output.size());
+    const int result = deflate(&stream, last ? Z_FINISH : Z_SYNC_FLUSH);
+    // A sync flush that fills the output exactly may not have finished; the
+    // margin above makes that a failure rather than a truncated block.
+    block.ok = (last ? result == Z_STREAM_END : result == Z_OK && stream.avail_out != 0) &&
+               stream.avail_in == 0;
+    block.output.resize(stream.total_out);
+    deflateEnd(&stream);
+    block.adler = adler32(1L, filtered_.data() + begin, static_cast<uInt>(size));
+  });
+
+  std::size_t compressed_size = 2 + 4;
+  uLong adler = 1;
+  for (std::size_t index = 0; index < block_count; ++index) {
+    if (!blocks_[index].ok) {
+      return {};
+    }
+    compressed_size += blocks_[index].output.size();
+    const std::size_t begin = index * settings_.chunk_bytes;
+    const std::size_t size = std::min(settings_.chunk_bytes, filtered_.size() - begin);
+    adler = index == 0 ? blocks_[index].adler
+                       : adler32_combine(adler, blocks_[index].adler, static_cast<z_off_t>(size));
+  }
+
+  std::vector<std::uint8_t> compressed;
+  compressed.reserve(compressed_size);
+  compressed.push_back(0x78);
+  compressed.push_back(zlib_flags_for_level(settings_.compression_level));
+  for (const auto& block : blocks_) {
+    compressed.insert(compressed.end(), block.output.begin(), block.output.end());
+  }
+  append_u32_be(&compressed, static_cast<std::uint32_t>(adler));
+
+  std::array<std::uint8_t, 13> header{};
+  const auto width = static_cast<std::uint32_t>(frame.width());
+  const auto image_height = static_cast<std::uint32_t>(height);
+  for (int i = 0; i < 4; ++i) {
+    header[static_cast<std::size_t>(i)] = static_cast<std::uint8_t>(width >> (24 - (8 * i)));
+    header[static_cast<std::size_t>(4 + i)] =
+        static_cast<std::uint8_t>(image_height >> (24 - (8 * i)));
+  }
+  header[8] = 8;   // bit depth
+  header[9] = 6;   // color type: RGBA
+  header[10] = 0;  // compression
+  header[11] = 0;  // filter method
+  header[12] = 0;  // interlace
+
+  std::vector<std::uint8_t> png(kPngSignature.begin(), kPngSignature.end());
+  png.reserve(png.size() + compressed.size() + 64);
+  append_chunk(&png, "IHDR", header.data(), header.size());
+  append_chunk(&png, "IDAT", compressed.data(), compressed.size());
+  append_chunk(&png, "IEND", nullptr, 0);
+  return png;
+}
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,112 @@
+#include "manim_cpp/renderer/qoi_encoder.hpp"
+
+#include <array>
+#include <limits>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+
+namespace manim_cpp::renderer {
+namespace {
+
+constexpr std::uint8_t kOpIndex = 0x00;
+constexpr std::uint8_t kOpDiff = 0x40;
+constexpr std::uint8_t kOpLuma = 0x80;
+constexpr std::uint8_t kOpRun = 0xC0;
+constexpr std::uint8_t kOpRgb = 0xFE;
+constexpr std::uint8_t kOpRgba = 0xFF;
+constexpr int kMaxRun = 62;
+
+std::size_t color_hash(const Rgba8& color) {
+  return (color.r * 3U + color.g * 5U + color.b * 7U + color.a * 11U) % 64U;
+}
+
+void append_u32_be(std::vector<std::uint8_t>* output, const std::uint32_t value) {
+  output->push_back(static_cast<std::uint8_t>(value >> 24U));
+  output->push_back(static_cast<std::uint8_t>(value >> 16U));
+  output->push_back(static_cast<std::uint8_t>(value >> 8U));
+  output->push_back(static_cast<std::uint8_t>(value));
+}
+
+}  // namespace
+
+std::vector<std::uint8_t> encode_qoi(const std::uint8_t* pixels,
+                                     const std::size_t width,
+                                     const std::size_t height,
+                                     const std::size_t channels) {
+  if (pixels == nullptr || width == 0 || height == 0 || (channels != 3 && channels != 4) ||
+      width > std::numeric_limits<std::uint32_t>::max() ||
+      height > std::numeric_limits<std::uint32_t>::max()) {
+    return {};
+  }
+
+  const std::size_t pixel_count = width * height;
+  std::vector<std::uint8_t> output;
+  // Worst case: every pixel as QOI_OP_RGBA, plus header and end marker.
+  output.reserve(14 + pixel_count * (channels + 1) + 8);
+  output.insert(output.end(), {'q', 'o', 'i', 'f'});
+  append_u32_be(&output, static_cast<std::uint32_t>(width));
+  append_u32_be(&output, static_cast<std::uint32_t>(height));
+  output.push_back(static_cast<std::uint8_t>(channels));
+  output.push_back(0);  // sRGB with linear alpha
+
+  std::array<Rgba8, 64> seen{};
+  for (auto& color : seen) {
+    color = {.r = 0, .g = 0, .b = 0, .a = 0};
+  }
+  Rgba8 previous;
+  int run = 0;
+  for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+    const std::uint8_t* source = pixels + pixel * channels;
+    const Rgba8 color{
+        .r = source[0],
+        .g = source[1],
+        .b = source[2],
+        .a = channels == 4 ? source[3] : std::uint8_t{255},
+    };
+    if (color == previous) {
+      ++run;
+      if (run == kMaxRun || pixel + 1 == pixel_count) {
+        output.push_back(static_cast<std::uint8_t>(kOpRun | (run - 1)));
+        run = 0;
+      }
+      continue;
+    }
+    if (run > 0) {
+      output.push_back(static_cast<std::uint8_t>(kOpRun | (run - 1)));
+      run = 0;
+    }
+
+    const std::size_t slot = color_hash(color);
+    if (seen[slot] == color) {
+      output.push_back(static_cast<std::uint8_t>(kOpIndex | slot));
+    } else {
+      seen[slot] = color;
+      if (color.a == previous.a) {
+        // Wrapping 8-bit differences, as the format specifies.
+        const auto dr = static_cast<std::int8_t>(color.r - previous.r);
+        const auto dg = static_cast<std::int8_t>(color.g - previous.g);
+        const auto db = static_cast<std::int8_t>(color.b - previous.b);
+        const int dr_dg = dr - dg;
+        const int db_dg = db - dg;
+        if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+          output.push_back(
+              static_cast<std::uint8_t>(kOpDiff | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2)));
+        } else if (dg >= -32 && dg <= 31 && dr_dg >= -8 && dr_dg <= 7 && db_dg >= -8 &&
+                   db_dg <= 7) {
+          output.push_back(static_cast<std::uint8_t>(kOpLuma | (dg + 32)));
+          output.push_back(static_cast<std::uint8_t>(((dr_dg + 8) << 4) | (db_dg + 8)));
+        } else {
+          output.insert(output.end(), {kOpRgb, color.r, color.g, color.b});
+        }
+      } else {
+        output.insert(output.end(), {kOpRgba, color.r, color.g, color.b, color.a});
+      }
+    }
+    previous = color;
+  }
+
+  output.insert(output.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+  return output;
+}
+
+}  // namespace manim_cpp::renderer
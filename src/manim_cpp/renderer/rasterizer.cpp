@@ -0,0 +1,318 @@
+#include "manim_cpp/renderer/rasterizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace manim_cpp::renderer {
+namespace {
+
+struct Edge {
+  double x0 = 0.0;
+  double y0 = 0.0;
+  double y1 = 0.0;
+  double dxdy = 0.0;
+  int winding = 1;
+};
+
+struct PreparedCommand {
+  std::vector<Edge> edges;
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  FillRule fill_rule = FillRule::kNonZero;
+  float red = 1.0F;
+  float green = 1.0F;
+  float blue = 1.0F;
+  float alpha = 1.0F;
+};
+
+struct Crossing {
+  double x = 0.0;
+  int winding = 1;
+};
+
+struct TileScratch {
+  std::vector<const Edge*> edges;
+  std::vector<Crossing> crossings;
+  std::vector<float> coverage;
+};
+
+PreparedCommand prepare_command(const DrawCommand& command,
+                                const double scale,
+                                const double half_frame_width,
+                                const double half_frame_height) {
+  PreparedCommand prepared;
+  prepared.fill_rule = command.fill_rule;
+  prepared.red = static_cast<float>(command.color.r) / 255.0F;
+  prepared.green = static_cast<float>(command.color.g) / 255.0F;
+  prepared.blue = static_cast<float>(command.color.b) / 255.0F;
+  prepared.alpha = static_cast<float>(
+      std::clamp(command.opacity, 0.0, 1.0) * (static_cast<double>(command.color.a) / 255.0));
+
+  for (const auto& ring : command.rings) {
+    if (ring.size() < 3) {
+      continue;
+    }
+    for (std::size_t i = 0; i < ring.size(); ++i) {
+      const auto& a = ring[i];
+      const auto& b = ring[(i + 1) % ring.size()];
+      const double ax = (a[0] + half_frame_width) * scale;
+      const double ay = (half_frame_height - a[1]) * scale;
+      const double bx = (b[0] + half_frame_width) * scale;
+      const double by = (half_frame_height - b[1]) * scale;
+      if (!std::isfinite(ax) || !std::isfinite(ay) || !std::isfinite(bx) || !std::isfinite(by)) {
+        // A NaN or infinite point has no pixel position; skip the command.
+        prepared.edges.clear();
+        return prepared;
+      }
+
+      prepared.min_x = std::min({prepared.min_x, ax, bx});
+      prepared.max_x = std::max({prepared.max_x, ax, bx});
+      prepared.min_y = std::min({prepared.min_y, ay, by});
+      prepared.max_y = std::max({prepared.max_y, ay, by});
+
+      if (ay == by) {
+        continue;
+      }
+      Edge edge;
+      if (ay < by) {
+        edge = Edge{.x0 = ax, .y0 = ay, .y1 = by, .dxdy = (bx - ax) / (by - ay), .winding = 1};
+      } else {
+        edge = Edge{.x0 = bx, .y0 = by, .y1 = ay, .dxdy = (ax - bx) / (ay - by), .winding = -1};
+      }
+      prepared.edges.push_back(edge);
+    }
+  }
+  return prepared;
+}
+
+// Clamps in floating point before converting: casting a double outside the
+// range of std::size_t is undefined.
+std::size_t clamp_to_pixels(const double value, const std::size_t limit) {
+  return static_cast<std::size_t>(std::clamp(value, 0.0, static_cast<double>(limit)));
+}
+
+void add_span(float* row,
+              const std::size_t tile_x0,
+              const std::size_t tile_x1,
+              double x_start,
+              double x_end,
+              const float weight) {
+  x_start = std::max(x_start, static_cast<double>(tile_x0));
+  x_end = std::min(x_end, static_cast<double>(tile_x1));
+  if (x_end <= x_start) {
+    return;
+  }
+
+  const auto first = static_cast<std::size_t>(x_start);
+  const auto last = static_cast<std::size_t>(x_end);
+  if (first == last) {
+    row[first - tile_x0] += static_cast<float>(x_end - x_start) * weight;
+    return;
+  }
+  row[first - tile_x0] += static_cast<float>(static_cast<double>(first + 1) - x_start) * weight;
+  for (std::size_t x = first + 1; x < last; ++x) {
+    row[x - tile_x0] += weight;
+  }
+  if (last < tile_x1) {
+    row[last - tile_x0] += static_cast<float>(x_end - static_cast<double>(last)) * weight;
+  }
+}
+
+std::uint8_t blend_channel(const std::uint8_t destination,
+                           const float source,
+                           const float alpha) {
+  const float value = static_cast<float>(destination) +
+                      ((source * 255.0F) - static_cast<float>(destination)) * alpha;
+  return static_cast<std::uint8_t>(std::clamp(std::lround(value), 0L, 255L));
+}
+
+void rasterize_command_into_tile(const PreparedCommand& command,
+                                 const std::size_t tile_x0,
+                                 const std::size_t tile_y0,
+                                 const std::size_t tile_x1,
+                                 const std::size_t tile_y1,
+                                 const std::size_t vertical_samples,
+                                 TileScratch* scratch,
+                                 FrameBuffer* output) {
+  const std::size_t tile_width = tile_x1 - tile_x0;
+  const auto row_begin = std::max(tile_y0, clamp_to_pixels(command.min_y, tile_y1));
+  const auto row_end = clamp_to_pixels(std::ceil(command.max_y), tile_y1);
+  if (row_begin >= row_end) {
+    return;
+  }
+
+  scratch->edges.clear();
+  for (const auto& edge : command.edges) {
+    if (edge.y1 > static_cast<double>(row_begin) && edge.y0 < static_cast<double>(row_end)) {
+      scratch->edges.push_back(&edge);
+    }
+  }
+  if (scratch->edges.empty()) {
+    return;
+  }
+
+  const float sample_weight = 1.0F / static_cast<float>(vertical_samples);
+  scratch->coverage.assign(tile_width, 0.0F);
+  for (std::size_t y = row_begin; y < row_end; ++y) {
+    std::fill(scratch->coverage.begin(), scratch->coverage.end(), 0.0F);
+    bool touched = false;
+
+    for (std::size_t sample = 0; sample < vertical_samples; ++sample) {
+      const double sample_y = static_cast<double>(y) +
+                              ((static_cast<double>(sample) + 0.5) /
+                               static_cast<double>(vertical_samples));
+      scratch->crossings.clear();
+      for (const Edge* edge : scratch->edges) {
+        if (sample_y < edge->y0 || sample_y >= edge->y1) {
+          continue;
+        }
+        scratch->crossings.push_back(
+            Crossing{.x = edge->x0 + ((sample_y - edge->y0) * edge->dxdy),
+                     .winding = edge->winding});
+      }
+      if (scratch->crossings.size() < 2) {
+        continue;
+      }
+      std::sort(scratch->crossings.begin(), scratch->crossings.end(),
+                [](const Crossing& a, const Crossing& b) { return a.x < b.x; });
+
+      int winding = 0;
+      for (std::size_t i = 0; i + 1 < scratch->crossings.size(); ++i) {
+        if (command.fill_rule == FillRule::kEvenOdd) {
+          winding ^= 1;
+        } else {
+          winding += scratch->crossings[i].winding;
+        }
+        if (winding == 0) {
+          continue;
+        }
+        add_span(scratch->coverage.data(), tile_x0, tile_x1, scratch->crossings[i].x,
+                 scratch->crossings[i + 1].x, sample_weight);
+        touched = true;
+      }
+    }
+
+    if (!touched) {
+      continue;
+    }
+    std::uint8_t* pixel = output->row(y) + tile_x0 * FrameBuffer::kChannels;
+    for (std::size_t x = 0; x < tile_width; ++x, pixel += FrameBuffer::kChannels) {
+      const float coverage = std::min(scratch->coverage[x], 1.0F);
+      if (coverage <= 0.0F) {
+        continue;
+      }
+      const float alpha = coverage * command.alpha;
+      pixel[0] = blend_channel(pixel[0], command.red, alpha);
+      pixel[1] = blend_channel(pixel[1], command.green, alpha);
+      pixel[2] = blend_channel(pixel[2], command.blue, alpha);
+      pixel[3] = blend_channel(pixel[3], 1.0F, alpha);
+    }
+  }
+}
+
+}  // namespace
+
+TileRasterizer::TileRasterizer(const std::size_t worker_count)
+    : requested_worker_count_(worker_count) {}
+
+std::size_t TileRasterizer::worker_count() const {
+  if (pool_ != nullptr) {
+    return pool_->worker_count();
+  }
+  return requested_worker_count_ == 0 ? default_worker_count() : requested_worker_count_;
+}
+
+WorkStealingThreadPool& TileRasterizer::pool() {
+  if (pool_ == nullptr) {
+    pool_ = std::make_unique<WorkStealingThreadPool>(requested_worker_count_);
+  }
+  return *pool_;
+}
+
+void TileRasterizer::render(const DrawList& draw_list,
+                            const RasterSettings& settings,
+                            FrameBuffer* output) {
+  if (output == nullptr) {
+    return;
+  }
+  if (output->width() != settings.pixel_width || output->height() != settings.pixel_height) {
+    output->resize(settings.pixel_width, settings.pixel_height);
+  }
+  if (output->empty()) {
+    return;
+  }
+
+  const double frame_height = settings.frame_height > 0.0 ? settings.frame_height : 8.0;
+  const double scale = static_cast<double>(settings.pixel_height) / frame_height;
+  const double half_frame_height = frame_height / 2.0;
+  const double half_frame_width =
+      half_frame_height * static_cast<double>(settings.pixel_width) /
+      static_cast<double>(settings.pixel_height);
+
+  std::vector<PreparedCommand> prepared;
+  prepared.reserve(draw_list.size());
+  for (const auto& command : draw_list) {
+    auto prepared_command = prepare_command(command, scale, half_frame_width, half_frame_height);
+    if (prepared_command.edges.empty() || prepared_command.alpha <= 0.0F) {
+      continue;
+    }
+    prepared.push_back(std::move(prepared_command));
+  }
+
+  const std::size_t tile_size = std::max<std::size_t>(settings.tile_size, 8);
+  const std::size_t vertical_samples = std::max<std::size_t>(settings.vertical_samples, 1);
+  const std::size_t tiles_x = (settings.pixel_width + tile_size - 1) / tile_size;
+  const std::size_t tiles_y = (settings.pixel_height + tile_size - 1) / tile_size;
+
+  // Bin commands in draw order so every tile composites back-to-front.
+  std::vector<std::vector<std::uint32_t>> bins(tiles_x * tiles_y);
+  for (std::size_t index = 0; index < prepared.size(); ++index) {
+    const auto& command = prepared[index];
+    if (command.max_x <= 0.0 || command.max_y <= 0.0 ||
+        command.min_x >= static_cast<double>(settings.pixel_width) ||
+        command.min_y >= static_cast<double>(settings.pixel_height)) {
+      continue;
+    }
+    const auto first_tile_x = clamp_to_pixels(command.min_x, settings.pixel_width) / tile_size;
+    const auto first_tile_y = clamp_to_pixels(command.min_y, settings.pixel_height) / tile_size;
+    const auto last_tile_x =
+        std::min(tiles_x - 1, clamp_to_pixels(command.max_x, settings.pixel_width) / tile_size);
+    const auto last_tile_y =
+        std::min(tiles_y - 1, clamp_to_pixels(command.max_y, settings.pixel_height) / tile_size);
+    for (std::size_t ty = first_tile_y; ty <= last_tile_y; ++ty) {
+      for (std::size_t tx = first_tile_x; tx <= last_tile_x; ++tx) {
+        bins[ty * tiles_x + tx].push_back(static_cast<std::uint32_t>(index));
+      }
+    }
+  }
+
+  const auto background = settings.background;
+  pool().parallel_for(bins.size(), [&](const std::size_t tile_index) {
+    thread_local TileScratch scratch;
+    const std::size_t tile_x0 = (tile_index % tiles_x) * tile_size;
+    const std::size_t tile_y0 = (tile_index / tiles_x) * tile_size;
+    const std::size_t tile_x1 = std::min(tile_x0 + tile_size, settings.pixel_width);
+    const std::size_t tile_y1 = std::min(tile_y0 + tile_size, settings.pixel_height);
+
+    for (std::size_t y = tile_y0; y < tile_y1; ++y) {
+      std::uint8_t* pixel = output->row(y) + tile_x0 * FrameBuffer::kChannels;
+      for (std::size_t x = tile_x0; x < tile_x1; ++x, pixel += FrameBuffer::kChannels) {
+        pixel[0] = background.r;
+        pixel[1] = background.g;
+        pixel[2] = background.b;
+        pixel[3] = background.a;
+      }
+    }
+    for (const auto command_index : bins[tile_index]) {
+      rasterize_command_into_tile(prepared[command_index], tile_x0, tile_y0, tile_x1, tile_y1,
+                                  vertical_samples, &scratch, output);
+    }
+  });
+}
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,155 @@
+#include "manim_cpp/renderer/thread_pool.hpp"
+
+namespace manim_cpp::renderer {
+
+std::size_t default_worker_count() {
+  const unsigned int hardware = std::thread::hardware_concurrency();
+  return hardware == 0 ? 1 : static_cast<std::size_t>(hardware);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(std::size_t worker_count) {
+  if (worker_count == 0) {
+    worker_count = default_worker_count();
+  }
+
+  queues_.reserve(worker_count);
+  for (std::size_t i = 0; i < worker_count; ++i) {
+    queues_.push_back(std::make_unique<TaskQueue>());
+  }
+
+  // The last queue belongs to the calling thread.
+  threads_.reserve(worker_count - 1);
+  for (std::size_t i = 0; i + 1 < worker_count; ++i) {
+    threads_.emplace_back([this, i]() { worker_loop(i); });
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(batch_mutex_);
+    stopping_ = true;
+  }
+  batch_cv_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkStealingThreadPool::parallel_for(const std::size_t task_count,
+                                          const ParallelTask& task) {
+  if (task_count == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> dispatch_lock(dispatch_mutex_);
+  if (queues_.size() == 1 || task_count == 1) {
+    for (std::size_t i = 0; i < task_count; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  const std::size_t queue_count = queues_.size();
+  {
+    std::lock_guard<std::mutex> lock(batch_mutex_);
+    batch_task_ = &task;
+    first_error_ = nullptr;
+    remaining_.store(task_count, std::memory_order_relaxed);
+
+    // Contiguous ranges keep neighbouring tiles on the same thread until
+    // somebody runs dry and starts stealing.
+    for (std::size_t q = 0; q < queue_count; ++q) {
+      const std::size_t begin = (task_count * q) / queue_count;
+      const std::size_t end = (task_count * (q + 1)) / queue_count;
+      std::lock_guard<std::mutex> queue_lock(queues_[q]->mutex);
+      for (std::size_t i = begin; i < end; ++i) {
+        queues_[q]->tasks.push_back(i);
+      }
+    }
+    ++batch_generation_;
+  }
+  batch_cv_.notify_all();
+
+  drain(queue_count - 1);
+
+  std::unique_lock<std::mutex> lock(batch_mutex_);
+  done_cv_.wait(lock, [this]() {
+    return remaining_.load(std::memory_order_acquire) == 0;
+  });
+  batch_task_ = nullptr;
+  if (first_error_) {
+    std::rethrow_exception(first_error_);
+  }
+}
+
+void WorkStealingThreadPool::worker_loop(const std::size_t queue_index) {
+  std::size_t seen_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(batch_mutex_);
+      batch_cv_.wait(lock, [this, seen_generation]() {
+        return stopping_ || batch_generation_ != seen_generation;
+      });
+      if (stopping_) {
+        return;
+      }
+      seen_generation = batch_generation_;
+    }
+    drain(queue_index);
+  }
+}
+
+void WorkStealingThreadPool::drain(const std::size_t queue_index) {
+  while (true) {
+    auto task_index = pop_local(queue_index);
+    if (!task_index.has_value()) {
+      task_index = steal(queue_index);
+    }
+    if (!task_index.has_value()) {
+      return;
+    }
+
+    try {
+      (*batch_task_)(task_index.value());
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(batch_mutex_);
+      if (!first_error_) {
+        first_error_ = std::current_exception();
+      }
+    }
+
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::lock_guard<std::mutex> lock(batch_mutex_);
+      done_cv_.notify_all();
+    }
+  }
+}
+
+std::optional<std::size_t> WorkStealingThreadPool::pop_local(
+    const std::size_t queue_index) {
+  auto& queue = *queues_[queue_index];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.tasks.empty()) {
+    return std::nullopt;
+  }
+  const std::size_t task_index = queue.tasks.front();
+  queue.tasks.pop_front();
+  return task_index;
+}
+
+std::optional<std::size_t> WorkStealingThreadPool::steal(const std::size_t thief_index) {
+  const std::size_t queue_count = queues_.size();
+  for (std::size_t offset = 1; offset < queue_count; ++offset) {
+    auto& victim = *queues_[(thief_index + offset) % queue_count];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (victim.tasks.empty()) {
+      continue;
+    }
+    const std::size_t task_index = victim.tasks.back();
+    victim.tasks.pop_back();
+    return task_index;
+  }
+  return std::nullopt;
+}
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,152 @@
+#include "manim_cpp/renderer/y4m_writer.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+namespace manim_cpp::renderer {
+namespace {
+
+constexpr char kFrameMarker[] = "FRAME\n";
+constexpr std::size_t kFrameMarkerSize = sizeof(kFrameMarker) - 1;
+
+struct FrameRateRatio {
+  long long numerator = 0;
+  long long denominator = 1;
+};
+
+FrameRateRatio frame_rate_ratio(const double frame_rate) {
+  if (!(frame_rate > 0.0)) {
+    return {.numerator = 0, .denominator = 1};
+  }
+  const auto whole = std::llround(frame_rate);
+  if (std::abs(frame_rate - static_cast<double>(whole)) < 1e-6) {
+    return {.numerator = whole, .denominator = 1};
+  }
+  const auto ntsc = std::llround(frame_rate * 1.001);
+  if (std::abs(frame_rate - static_cast<double>(ntsc) * 1000.0 / 1001.0) < 1e-3) {
+    return {.numerator = ntsc * 1000, .denominator = 1001};
+  }
+  const auto numerator = std::llround(frame_rate * 1000.0);
+  const auto divisor = std::gcd(numerator, 1000LL);
+  return {.numerator = numerator / divisor, .denominator = 1000 / divisor};
+}
+
+}  // namespace
+
+Y4mWriter::~Y4mWriter() { close(); }
+
+std::string Y4mWriter::header(const std::size_t width,
+                              const std::size_t height,
+                              const double frame_rate) {
+  const auto ratio = frame_rate_ratio(frame_rate);
+  std::ostringstream stream;
+  stream << "YUV4MPEG2 W" << width << " H" << height << " F" << ratio.numerator << ":"
+         << ratio.denominator << " Ip A1:1 C420jpeg XYSCSS=420JPEG XCOLORRANGE=LIMITED\n";
+  return stream.str();
+}
+
+std::size_t Y4mWriter::frame_record_size(const std::size_t width, const std::size_t height) {
+  const auto chroma_size = ((width + 1) / 2) * ((height + 1) / 2);
+  return kFrameMarkerSize + width * height + 2 * chroma_size;
+}
+
+bool Y4mWriter::open(const std::filesystem::path& path,
+                     const std::size_t width,
+                     const std::size_t height,
+                     const double frame_rate) {
+  close();
+  error_.clear();
+  frames_written_ = 0;
+  if (width == 0 || height == 0 || !(frame_rate > 0.0)) {
+    error_ = "Invalid Y4M stream geometry";
+    return false;
+  }
+
+  if (path == "-") {
+#ifdef _WIN32
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    stream_ = &std::cout;
+  } else {
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+      error_ = "Failed to open Y4M output: " + path.string();
+      return false;
+    }
+    stream_ = &file_;
+  }
+  width_ = width;
+  height_ = height;
+
+  const auto stream_header = header(width, height, frame_rate);
+  stream_->write(stream_header.data(), static_cast<std::streamsize>(stream_header.size()));
+  if (!stream_->good()) {
+    error_ = "Failed to write Y4M header";
+    return false;
+  }
+  return true;
+}
+
+bool Y4mWriter::write_frame(const FrameBuffer& frame) {
+  if (stream_ == nullptr) {
+    error_ = "Y4M stream is not open";
+    return false;
+  }
+  if (frame.width() != width_ || frame.height() != height_) {
+    std::ostringstream stream;
+    stream << "Frame size " << frame.width() << "x" << frame.height()
+           << " does not match Y4M stream size " << width_ << "x" << height_;
+    error_ = stream.str();
+    return false;
+  }
+  rgba_to_yuv420(frame, &frame_);
+  return write_planes();
+}
+
+bool Y4mWriter::repeat_last_frame() {
+  if (stream_ == nullptr || frames_written_ == 0) {
+    error_ = "No Y4M frame to repeat";
+    return false;
+  }
+  return write_planes();
+}
+
+bool Y4mWriter::write_planes() {
+  stream_->write(kFrameMarker, static_cast<std::streamsize>(kFrameMarkerSize));
+  for (const auto* plane : {&frame_.y, &frame_.u, &frame_.v}) {
+    stream_->write(reinterpret_cast<const char*>(plane->data()),
+                   static_cast<std::streamsize>(plane->size()));
+  }
+  if (!stream_->good()) {
+    error_ = "Failed to write Y4M frame";
+    return false;
+  }
+  ++frames_written_;
+  return true;
+}
+
+bool Y4mWriter::close() {
+  if (stream_ == nullptr) {
+    return error_.empty();
+  }
+  stream_->flush();
+  const bool ok = stream_->good();
+  if (file_.is_open()) {
+    file_.close();
+  }
+  stream_ = nullptr;
+  if (!ok && error_.empty()) {
+    error_ = "Failed to flush Y4M output";
+  }
+  return ok && error_.empty();
+}
+
+}  // namespace manim_cpp::renderer
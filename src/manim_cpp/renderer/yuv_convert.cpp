@@ -0,0 +1,318 @@
+#include "manim_cpp/renderer/yuv_convert.hpp"
+
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MANIM_CPP_YUV_AVX2 1
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#define MANIM_CPP_YUV_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace manim_cpp::renderer {
+namespace {
+
+// BT.601 limited range, 8.8 fixed point:
+//   Y = ((66 R + 129 G + 25 B + 128) >> 8) + 16
+//   U = ((-38 R - 74 G + 112 B + 128) >> 8) + 128
+//   V = ((112 R - 94 G - 18 B + 128) >> 8) + 128
+// Every intermediate fits in 16 bits, which is what lets the SIMD paths
+// reproduce the scalar results exactly.
+std::uint8_t luma(const int r, const int g, const int b) {
+  return static_cast<std::uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+}
+
+// Takes channel sums over a 2x2 block.
+void chroma(const int r_sum,
+            const int g_sum,
+            const int b_sum,
+            std::uint8_t* u,
+            std::uint8_t* v) {
+  const int r = (r_sum + 2) >> 2;
+  const int g = (g_sum + 2) >> 2;
+  const int b = (b_sum + 2) >> 2;
+  *u = static_cast<std::uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+  *v = static_cast<std::uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+}
+
+void prepare_output(const FrameBuffer& frame, Yuv420Frame* output) {
+  output->width = frame.width();
+  output->height = frame.height();
+  output->y.resize(output->width * output->height);
+  output->u.resize(output->chroma_width() * output->chroma_height());
+  output->v.resize(output->chroma_width() * output->chroma_height());
+}
+
+// Converts chroma row `chroma_row` and the (up to) two luma rows it covers,
+// starting at the even pixel column `x_begin`.
+void convert_row_pair_scalar(const FrameBuffer& frame,
+                             const std::size_t chroma_row,
+                             const std::size_t x_begin,
+                             Yuv420Frame* output) {
+  const std::size_t width = frame.width();
+  const std::size_t row0 = chroma_row * 2;
+  const std::size_t row1 = std::min(row0 + 1, frame.height() - 1);
+  const std::uint8_t* top = frame.row(row0);
+  const std::uint8_t* bottom = frame.row(row1);
+
+  for (std::size_t x = x_begin; x < width; ++x) {
+    const std::uint8_t* pixel = top + x * FrameBuffer::kChannels;
+    output->y[row0 * width + x] = luma(pixel[0], pixel[1], pixel[2]);
+    if (row1 != row0) {
+      pixel = bottom + x * FrameBuffer::kChannels;
+      output->y[row1 * width + x] = luma(pixel[0], pixel[1], pixel[2]);
+    }
+  }
+
+  const std::size_t chroma_width = output->chroma_width();
+  for (std::size_t cx = x_begin / 2; cx < chroma_width; ++cx) {
+    const std::size_t x0 = cx * 2;
+    const std::size_t x1 = std::min(x0 + 1, width - 1);
+    int sums[3] = {0, 0, 0};
+    for (const std::uint8_t* row : {top, bottom}) {
+      for (const std::size_t x : {x0, x1}) {
+        const std::uint8_t* pixel = row + x * FrameBuffer::kChannels;
+        sums[0] += pixel[0];
+        sums[1] += pixel[1];
+        sums[2] += pixel[2];
+      }
+    }
+    const std::size_t offset = chroma_row * chroma_width + cx;
+    chroma(sums[0], sums[1], sums[2], &output->u[offset], &output->v[offset]);
+  }
+}
+
+#if defined(MANIM_CPP_YUV_AVX2)
+
+// Two signed 16-bit coefficients packed for _mm256_madd_epi16 against lanes
+// holding (low, high) 16-bit channel values.
+constexpr int coefficient_pair(const int low, const int high) {
+  return static_cast<int>((static_cast<unsigned>(static_cast<std::uint16_t>(high)) << 16) |
+                          static_cast<std::uint16_t>(low));
+}
+
+__attribute__((target("avx2"))) __m256i load8_avx2(const std::uint8_t* pixels) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pixels));
+}
+
+// Eight RGBA pixels -> eight 32-bit luma values.
+__attribute__((target("avx2"))) __m256i luma8_avx2(const __m256i pixels) {
+  const __m256i rb_mask = _mm256_set1_epi32(0x00FF00FF);
+  const __m256i g_mask = _mm256_set1_epi32(0x000000FF);
+  const __m256i rb = _mm256_and_si256(pixels, rb_mask);
+  const __m256i g = _mm256_and_si256(_mm256_srli_epi32(pixels, 8), g_mask);
+  __m256i y = _mm256_add_epi32(_mm256_madd_epi16(rb, _mm256_set1_epi32(coefficient_pair(66, 25))),
+                               _mm256_madd_epi16(g, _mm256_set1_epi32(coefficient_pair(129, 0))));
+  y = _mm256_srli_epi32(_mm256_add_epi32(y, _mm256_set1_epi32(128)), 8);
+  return _mm256_add_epi32(y, _mm256_set1_epi32(16));
+}
+
+// Stores eight 32-bit values (each < 256) from `low` then eight from `high`
+// as sixteen bytes.
+__attribute__((target("avx2"))) void store16_avx2(std::uint8_t* output,
+                                                  const __m256i low,
+                                                  const __m256i high) {
+  const __m256i words = _mm256_packs_epi32(low, high);
+  const __m256i bytes = _mm256_packus_epi16(words, _mm256_setzero_si256());
+  const __m256i ordered =
+      _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm256_castsi256_si128(ordered));
+}
+
+__attribute__((target("avx2"))) void store8_avx2(std::uint8_t* output, const __m256i values) {
+  const __m256i words = _mm256_packs_epi32(values, _mm256_setzero_si256());
+  const __m256i bytes = _mm256_packus_epi16(words, _mm256_setzero_si256());
+  const __m256i ordered =
+      _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm256_castsi256_si128(ordered));
+}
+
+// Sums each horizontal pixel pair of two rows; `left`/`right` hold pixels
+// 0-7 and 8-15. Channel sums stay below 1024, so the packed 16-bit halves
+// never carry into each other.
+__attribute__((target("avx2"))) __m256i pair_sums_avx2(const __m256i left, const __m256i right) {
+  const __m256i sums = _mm256_hadd_epi32(left, right);
+  return _mm256_permute4x64_epi64(sums, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+__attribute__((target("avx2"))) void convert_avx2(const FrameBuffer& frame, Yuv420Frame* output) {
+  const std::size_t width = frame.width();
+  const std::size_t chroma_width = output->chroma_width();
+  const __m256i rb_mask = _mm256_set1_epi32(0x00FF00FF);
+  const __m256i g_mask = _mm256_set1_epi32(0x000000FF);
+  const __m256i round2 = _mm256_set1_epi16(2);
+  const __m256i bias = _mm256_set1_epi32(128);
+
+  for (std::size_t chroma_row = 0; chroma_row < output->chroma_height(); ++chroma_row) {
+    const std::size_t row0 = chroma_row * 2;
+    if (row0 + 1 >= frame.height()) {
+      convert_row_pair_scalar(frame, chroma_row, 0, output);
+      continue;
+    }
+    const std::uint8_t* top = frame.row(row0);
+    const std::uint8_t* bottom = frame.row(row0 + 1);
+    std::uint8_t* y_top = output->y.data() + row0 * width;
+    std::uint8_t* y_bottom = y_top + width;
+    std::uint8_t* u_row = output->u.data() + chroma_row * chroma_width;
+    std::uint8_t* v_row = output->v.data() + chroma_row * chroma_width;
+
+    std::size_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+      const __m256i top_left = load8_avx2(top + x * FrameBuffer::kChannels);
+      const __m256i top_right = load8_avx2(top + (x + 8) * FrameBuffer::kChannels);
+      const __m256i bottom_left = load8_avx2(bottom + x * FrameBuffer::kChannels);
+      const __m256i bottom_right = load8_avx2(bottom + (x + 8) * FrameBuffer::kChannels);
+
+      store16_avx2(y_top + x, luma8_avx2(top_left), luma8_avx2(top_right));
+      store16_avx2(y_bottom + x, luma8_avx2(bottom_left), luma8_avx2(bottom_right));
+
+      const __m256i rb_left = _mm256_add_epi32(_mm256_and_si256(top_left, rb_mask),
+                                               _mm256_and_si256(bottom_left, rb_mask));
+      const __m256i rb_right = _mm256_add_epi32(_mm256_and_si256(top_right, rb_mask),
+                                                _mm256_and_si256(bottom_right, rb_mask));
+      const __m256i g_left =
+          _mm256_add_epi32(_mm256_and_si256(_mm256_srli_epi32(top_left, 8), g_mask),
+                           _mm256_and_si256(_mm256_srli_epi32(bottom_left, 8), g_mask));
+      const __m256i g_right =
+          _mm256_add_epi32(_mm256_and_si256(_mm256_srli_epi32(top_right, 8), g_mask),
+                           _mm256_and_si256(_mm256_srli_epi32(bottom_right, 8), g_mask));
+      const __m256i rb = _mm256_srli_epi16(
+          _mm256_add_epi16(pair_sums_avx2(rb_left, rb_right), round2), 2);
+      const __m256i g =
+          _mm256_srli_epi16(_mm256_add_epi16(pair_sums_avx2(g_left, g_right), round2), 2);
+
+      __m256i u = _mm256_add_epi32(
+          _mm256_madd_epi16(rb, _mm256_set1_epi32(coefficient_pair(-38, 112))),
+          _mm256_madd_epi16(g, _mm256_set1_epi32(coefficient_pair(-74, 0))));
+      __m256i v = _mm256_add_epi32(
+          _mm256_madd_epi16(rb, _mm256_set1_epi32(coefficient_pair(112, -18))),
+          _mm256_madd_epi16(g, _mm256_set1_epi32(coefficient_pair(-94, 0))));
+      u = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(u, bias), 8), bias);
+      v = _mm256_add_epi32(_mm256_srai_epi32(_mm256_add_epi32(v, bias), 8), bias);
+      store8_avx2(u_row + x / 2, u);
+      store8_avx2(v_row + x / 2, v);
+    }
+    if (x < width) {
+      convert_row_pair_scalar(frame, chroma_row, x, output);
+    }
+  }
+}
+
+bool cpu_has_avx2() {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2") != 0;
+  return has_avx2;
+}
+
+#elif defined(MANIM_CPP_YUV_NEON)
+
+void luma16_neon(const uint8x16x4_t& pixels, std::uint8_t* output) {
+  const auto half = [&](const uint8x8_t r, const uint8x8_t g, const uint8x8_t b) {
+    uint16x8_t sum = vmull_u8(r, vdup_n_u8(66));
+    sum = vmlal_u8(sum, g, vdup_n_u8(129));
+    sum = vmlal_u8(sum, b, vdup_n_u8(25));
+    sum = vaddq_u16(sum, vdupq_n_u16(128));
+    return vadd_u8(vshrn_n_u16(sum, 8), vdup_n_u8(16));
+  };
+  const uint8x8_t low =
+      half(vget_low_u8(pixels.val[0]), vget_low_u8(pixels.val[1]), vget_low_u8(pixels.val[2]));
+  const uint8x8_t high = half(vget_high_u8(pixels.val[0]), vget_high_u8(pixels.val[1]),
+                              vget_high_u8(pixels.val[2]));
+  vst1q_u8(output, vcombine_u8(low, high));
+}
+
+void convert_neon(const FrameBuffer& frame, Yuv420Frame* output) {
+  const std::size_t width = frame.width();
+  const std::size_t chroma_width = output->chroma_width();
+
+  for (std::size_t chroma_row = 0; chroma_row < output->chroma_height(); ++chroma_row) {
+    const std::size_t row0 = chroma_row * 2;
+    if (row0 + 1 >= frame.height()) {
+      convert_row_pair_scalar(frame, chroma_row, 0, output);
+      continue;
+    }
+    const std::uint8_t* top = frame.row(row0);
+    const std::uint8_t* bottom = frame.row(row0 + 1);
+    std::uint8_t* y_top = output->y.data() + row0 * width;
+    std::uint8_t* u_row = output->u.data() + chroma_row * chroma_width;
+    std::uint8_t* v_row = output->v.data() + chroma_row * chroma_width;
+
+    std::size_t x = 0;
+    for (; x + 16 <= width; x += 16) {
+      const uint8x16x4_t top_pixels = vld4q_u8(top + x * FrameBuffer::kChannels);
+      const uint8x16x4_t bottom_pixels = vld4q_u8(bottom + x * FrameBuffer::kChannels);
+      luma16_neon(top_pixels, y_top + x);
+      luma16_neon(bottom_pixels, y_top + width + x);
+
+      // Pairwise-widening adds give 2x2 sums; vrshrq_n_u16(.., 2) is the
+      // rounded (sum + 2) >> 2 mean.
+      const auto mean = [&](const int channel) {
+        const uint16x8_t sum = vaddq_u16(vpaddlq_u8(top_pixels.val[channel]),
+                                         vpaddlq_u8(bottom_pixels.val[channel]));
+        return vreinterpretq_s16_u16(vrshrq_n_u16(sum, 2));
+      };
+      const int16x8_t r = mean(0);
+      const int16x8_t g = mean(1);
+      const int16x8_t b = mean(2);
+      const int16x8_t bias = vdupq_n_s16(128);
+
+      int16x8_t u = vmulq_n_s16(r, -38);
+      u = vmlaq_n_s16(u, g, -74);
+      u = vmlaq_n_s16(u, b, 112);
+      u = vaddq_s16(vshrq_n_s16(vaddq_s16(u, bias), 8), bias);
+      int16x8_t v = vmulq_n_s16(r, 112);
+      v = vmlaq_n_s16(v, g, -94);
+      v = vmlaq_n_s16(v, b, -18);
+      v = vaddq_s16(vshrq_n_s16(vaddq_s16(v, bias), 8), bias);
+      vst1_u8(u_row + x / 2, vqmovun_s16(u));
+      vst1_u8(v_row + x / 2, vqmovun_s16(v));
+    }
+    if (x < width) {
+      convert_row_pair_scalar(frame, chroma_row, x, output);
+    }
+  }
+}
+
+#endif
+
+}  // namespace
+
+void rgba_to_yuv420_scalar(const FrameBuffer& frame, Yuv420Frame* output) {
+  if (output == nullptr) {
+    return;
+  }
+  prepare_output(frame, output);
+  for (std::size_t chroma_row = 0; chroma_row < output->chroma_height(); ++chroma_row) {
+    convert_row_pair_scalar(frame, chroma_row, 0, output);
+  }
+}
+
+void rgba_to_yuv420(const FrameBuffer& frame, Yuv420Frame* output) {
+  if (output == nullptr) {
+    return;
+  }
+#if defined(MANIM_CPP_YUV_AVX2)
+  if (cpu_has_avx2()) {
+    prepare_output(frame, output);
+    convert_avx2(frame, output);
+    return;
+  }
+#elif defined(MANIM_CPP_YUV_NEON)
+  prepare_output(frame, output);
+  convert_neon(frame, output);
+  return;
+#endif
+  rgba_to_yuv420_scalar(frame, output);
+}
+
+const char* yuv420_converter_name() {
+#if defined(MANIM_CPP_YUV_AVX2)
+  return cpu_has_avx2() ? "avx2" : "scalar";
+#elif defined(MANIM_CPP_YUV_NEON)
+  return "neon";
+#else
+  return "scalar";
+#endif
+}
+
+}  // namespace manim_cpp::renderer
@@ -0,0 +1,744 @@
+#include "manim_cpp/scene/async_file_writer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <iterator>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && \
+    defined(__NR_io_uring_register)
+#define MANIM_CPP_HAS_IO_URING 1
+#endif
+#endif
+
+namespace manim_cpp::scene {
+namespace {
+
+std::string errno_message(const int error) {
+  return std::generic_category().message(error);
+}
+
+std::string failure(const std::string& step,
+                    const std::filesystem::path& path,
+                    const int error) {
+  return "Failed to " + step + " frame image file: " + path.string() + ": " +
+         errno_message(error);
+}
+
+int sync_file_data(const int fd) {
+#if defined(_WIN32)
+  return _commit(fd);
+#elif defined(__APPLE__)
+  return ::fsync(fd);
+#else
+  return ::fdatasync(fd);
+#endif
+}
+
+int close_file(const int fd) {
+#ifdef _WIN32
+  return _close(fd);
+#else
+  return ::close(fd);
+#endif
+}
+
+void sync_written_filesystems(const std::set<std::filesystem::path>& directories) {
+#if defined(__linux__)
+  for (const auto& directory : directories) {
+    const auto path = directory.empty() ? std::filesystem::path(".") : directory;
+    const int fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0) {
+      ::syncfs(fd);
+      ::close(fd);
+    }
+  }
+#elif !defined(_WIN32)
+  if (!directories.empty()) {
+    ::sync();
+  }
+#else
+  // Windows commits each file as it is closed instead.
+  (void)directories;
+#endif
+}
+
+}  // namespace
+
+std::string to_string(const FsyncPolicy policy) {
+  switch (policy) {
+    case FsyncPolicy::kNever:
+      return "never";
+    case FsyncPolicy::kPerFile:
+      return "per_file";
+    case FsyncPolicy::kOnFlush:
+      return "on_flush";
+  }
+  return "unknown";
+}
+
+std::optional<FsyncPolicy> parse_fsync_policy(const std::string& value) {
+  if (value == "never") {
+    return FsyncPolicy::kNever;
+  }
+  if (value == "per_file") {
+    return FsyncPolicy::kPerFile;
+  }
+  if (value == "on_flush") {
+    return FsyncPolicy::kOnFlush;
+  }
+  return std::nullopt;
+}
+
+std::string to_string(const AsyncIoBackend backend) {
+  switch (backend) {
+    case AsyncIoBackend::kAuto:
+      return "auto";
+    case AsyncIoBackend::kIoUring:
+      return "io_uring";
+    case AsyncIoBackend::kThreads:
+      return "threads";
+  }
+  return "unknown";
+}
+
+std::optional<AsyncIoBackend> parse_async_io_backend(const std::string& value) {
+  if (value == "auto") {
+    return AsyncIoBackend::kAuto;
+  }
+  if (value == "io_uring") {
+    return AsyncIoBackend::kIoUring;
+  }
+  if (value == "threads") {
+    return AsyncIoBackend::kThreads;
+  }
+  return std::nullopt;
+}
+
+#if defined(MANIM_CPP_HAS_IO_URING)
+
+// Minimal io_uring wrapper over the raw syscalls and the shared ring
+// mappings. Used by the single I/O thread only.
+class AsyncFileWriter::IoUring {
+ public:
+  // Returns null, with the reason in `error`, when the kernel (or a seccomp
+  // policy) refuses io_uring or lacks one of the file operations used here.
+  static std::unique_ptr<IoUring> create(const unsigned entries, std::string* error) {
+    io_uring_params params{};
+    const int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+      *error = "io_uring_setup failed: " + errno_message(errno);
+      return nullptr;
+    }
+    std::unique_ptr<IoUring> ring(new IoUring(fd));
+    if (!ring->map(params)) {
+      *error = "Failed to map the io_uring rings: " + errno_message(errno);
+      return nullptr;
+    }
+    if (!ring->supports_file_operations()) {
+      *error = "io_uring lacks openat, write, fsync or close support";
+      return nullptr;
+    }
+    return ring;
+  }
+
+  ~IoUring() { close(); }
+
+  // Unmaps the rings and closes the instance; later calls do nothing.
+  void close() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+      sqes_ = nullptr;
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_size_);
+    }
+    cq_ring_ = nullptr;
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_size_);
+      sq_ring_ = nullptr;
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  [[nodiscard]] unsigned sq_entries() const { return sq_entries_; }
+  void fail_submit_at(const std::size_t call) { fail_submit_at_ = call; }
+
+  // Returns a zeroed entry, or null when the submission queue is full.
+  io_uring_sqe* next_sqe() {
+    const unsigned head = std::atomic_ref<unsigned>(*sq_head_).load(std::memory_order_acquire);
+    if (sqe_tail_ - head >= sq_entries_) {
+      return nullptr;
+    }
+    const unsigned index = sqe_tail_ & *sq_mask_;
+    sq_array_[index] = index;
+    io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    ++sqe_tail_;
+    return sqe;
+  }
+
+  // Publishes prepared entries and waits for `wait_count` completions.
+  // Returns 0 or a negative errno.
+  int submit(const unsigned wait_count) {
+    std::atomic_ref<unsigned>(*sq_tail_).store(sqe_tail_, std::memory_order_release);
+    const unsigned head = std::atomic_ref<unsigned>(*sq_head_).load(std::memory_order_acquire);
+    const unsigned to_submit = sqe_tail_ - head;
+    const bool inject_failure = ++submit_calls_ == fail_submit_at_;
+    while (true) {
+      const unsigned flags = wait_count > 0 && !inject_failure ? IORING_ENTER_GETEVENTS : 0U;
+      const long result = syscall(__NR_io_uring_enter, fd_, to_submit, wait_count, flags, nullptr, 0);
+      if (result >= 0) {
+        return inject_failure ? -EIO : 0;
+      }
+      if (errno != EINTR) {
+        return -errno;
+      }
+    }
+  }
+
+  // Takes back the prepared entries the kernel has not consumed and returns
+  // their user data. Only submit() hands entries over, so these stay ours.
+  std::vector<std::uint64_t> reclaim_unsubmitted() {
+    const unsigned head = std::atomic_ref<unsigned>(*sq_head_).load(std::memory_order_acquire);
+    std::vector<std::uint64_t> user_data;
+    for (unsigned entry = head; entry != sqe_tail_; ++entry) {
+      user_data.push_back(sqes_[sq_array_[entry & *sq_mask_]].user_data);
+    }
+    sqe_tail_ = head;
+    std::atomic_ref<unsigned>(*sq_tail_).store(head, std::memory_order_release);
+    return user_data;
+  }
+
+  // Returns the number of completions handled.
+  template <typename Handler>
+  unsigned drain_completions(Handler&& handler) {
+    const unsigned start = *cq_head_;
+    unsigned head = start;
+    const unsigned tail = std::atomic_ref<unsigned>(*cq_tail_).load(std::memory_order_acquire);
+    for (; head != tail; ++head) {
+      const io_uring_cqe& cqe = cqes_[head & *cq_mask_];
+      handler(cqe.user_data, cqe.res);
+    }
+    std::atomic_ref<unsigned>(*cq_head_).store(head, std::memory_order_release);
+    return head - start;
+  }
+
+ private:
+  explicit IoUring(const int fd) : fd_(fd) {}
+
+  bool map(const io_uring_params& params) {
+    sq_entries_ = params.sq_entries;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    const auto map_region = [this](const std::size_t size, const off_t offset) -> void* {
+      void* region =
+          mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+      return region == MAP_FAILED ? nullptr : region;
+    };
+    sq_ring_ = map_region(sq_ring_size_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == nullptr) {
+      return false;
+    }
+    cq_ring_ = single_mmap ? sq_ring_ : map_region(cq_ring_size_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == nullptr) {
+      return false;
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe*>(map_region(sqes_size_, IORING_OFF_SQES));
+    if (sqes_ == nullptr) {
+      return false;
+    }
+
+    auto* sq = static_cast<std::uint8_t*>(sq_ring_);
+    sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto* cq = static_cast<std::uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    sqe_tail_ = *sq_tail_;
+    return true;
+  }
+
+  bool supports_file_operations() const {
+    constexpr unsigned kProbeOps = 256;
+    std::vector<std::uint8_t> buffer(sizeof(io_uring_probe) + kProbeOps * sizeof(io_uring_probe_op));
+    auto* probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+    if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe, kProbeOps) < 0) {
+      return false;
+    }
+    for (const unsigned op : {IORING_OP_OPENAT, IORING_OP_WRITE, IORING_OP_FSYNC, IORING_OP_CLOSE}) {
+      if (op > probe->last_op || (probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  int fd_ = -1;
+  void* sq_ring_ = nullptr;
+  void* cq_ring_ = nullptr;
+  std::size_t sq_ring_size_ = 0;
+  std::size_t cq_ring_size_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  std::size_t sqes_size_ = 0;
+  unsigned sq_entries_ = 0;
+  unsigned sqe_tail_ = 0;
+  std::size_t submit_calls_ = 0;
+  std::size_t fail_submit_at_ = 0;
+  unsigned* sq_head_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_mask_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned* cq_mask_ = nullptr;
+  io_uring_cqe* cqes_ = nullptr;
+};
+
+#else
+
+class AsyncFileWriter::IoUring {};
+
+#endif
+
+AsyncFileWriter::AsyncFileWriter(AsyncFileWriterSettings settings, CompletionCallback on_complete)
+    : settings_(settings), on_complete_(std::move(on_complete)) {
+  settings_.queue_depth = std::max<std::size_t>(settings_.queue_depth, 1);
+  settings_.thread_count = std::max<std::size_t>(settings_.thread_count, 1);
+#if defined(MANIM_CPP_HAS_IO_URING)
+  std::string ring_error;
+  if (settings_.backend != AsyncIoBackend::kThreads) {
+    ring_ = IoUring::create(static_cast<unsigned>(std::min<std::size_t>(settings_.queue_depth, 4096)),
+                            &ring_error);
+  }
+#else
+  const std::string ring_error = "io_uring is not supported on this platform";
+#endif
+  if (ring_ == nullptr && settings_.backend == AsyncIoBackend::kIoUring) {
+    backend_fallback_reason_ = ring_error;
+  }
+  if (ring_ != nullptr) {
+    ring_->fail_submit_at(settings_.fail_io_uring_enter_at);
+    threads_.emplace_back([this]() { run_io_uring(); });
+    return;
+  }
+  for (std::size_t index = 0; index < settings_.thread_count; ++index) {
+    threads_.emplace_back([this]() { run_threads(); });
+  }
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+  flush();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+const char* AsyncFileWriter::backend_name() const {
+  return ring_ != nullptr && !ring_failed_.load(std::memory_order_acquire) ? "io_uring"
+                                                                          : "threads";
+}
+
+std::size_t AsyncFileWriter::completed_count() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return completed_;
+}
+
+std::string AsyncFileWriter::error() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return error_;
+}
+
+void AsyncFileWriter::submit(std::filesystem::path path, SharedBytes bytes) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_cv_.wait(lock, [this]() { return pending_ < settings_.queue_depth; });
+    queue_.push_back({.path = std::move(path), .bytes = std::move(bytes)});
+    ++pending_;
+  }
+  work_cv_.notify_one();
+}
+
+bool AsyncFileWriter::flush() {
+  std::set<std::filesystem::path> directories;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_cv_.wait(lock, [this]() { return pending_ == 0; });
+    directories.swap(written_directories_);
+  }
+  if (settings_.fsync_policy == FsyncPolicy::kOnFlush) {
+    sync_written_filesystems(directories);
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  return error_.empty();
+}
+
+bool AsyncFileWriter::take_requests(const std::size_t limit,
+                                    const bool wait,
+                                    std::vector<Request>* requests) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (wait) {
+    work_cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+  }
+  if (queue_.empty()) {
+    return !stopping_;
+  }
+  while (!queue_.empty() && requests->size() < limit) {
+    requests->push_back(std::move(queue_.front()));
+    queue_.pop_front();
+  }
+  return true;
+}
+
+void AsyncFileWriter::requeue_requests(std::vector<Request> requests) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  queue_.insert(queue_.begin(), std::make_move_iterator(requests.begin()),
+                std::make_move_iterator(requests.end()));
+}
+
+void AsyncFileWriter::complete(const Request& request, const bool ok, const std::string& error) {
+  // Before the request stops counting as pending, so flush() returning
+  // implies every callback has run.
+  if (on_complete_) {
+    on_complete_(request.path, ok);
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    --pending_;
+    ++completed_;
+    if (!ok && error_.empty()) {
+      error_ = error;
+    }
+    if (ok && settings_.fsync_policy == FsyncPolicy::kOnFlush) {
+      written_directories_.insert(request.path.parent_path());
+    }
+  }
+  space_cv_.notify_all();
+}
+
+bool AsyncFileWriter::write_blocking(const Request& request, std::string* error) const {
+#ifdef _WIN32
+  const int fd = _wopen(request.path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY,
+                        _S_IREAD | _S_IWRITE);
+#else
+  const int fd = ::open(request.path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+  if (fd < 0) {
+    *error = failure("open", request.path, errno);
+    return false;
+  }
+
+  bool ok = true;
+  const std::uint8_t* data = request.bytes != nullptr ? request.bytes->data() : nullptr;
+  std::size_t remaining = request.bytes != nullptr ? request.bytes->size() : 0;
+  while (ok && remaining > 0) {
+    const auto chunk = static_cast<unsigned>(std::min<std::size_t>(remaining, INT_MAX));
+#ifdef _WIN32
+    const int written = _write(fd, data, chunk);
+#else
+    const ssize_t written = ::write(fd, data, chunk);
+#endif
+    if (written < 0 && errno == EINTR) {
+      continue;
+    }
+    if (written <= 0) {
+      *error = failure("write", request.path, written < 0 ? errno : EIO);
+      ok = false;
+      break;
+    }
+    data += written;
+    remaining -= static_cast<std::size_t>(written);
+  }
+
+  // Windows has no filesystem-wide flush, so on_flush commits per file there.
+#ifdef _WIN32
+  const bool sync_file = settings_.fsync_policy != FsyncPolicy::kNever;
+#else
+  const bool sync_file = settings_.fsync_policy == FsyncPolicy::kPerFile;
+#endif
+  if (ok && sync_file && sync_file_data(fd) != 0) {
+    *error = failure("sync", request.path, errno);
+    ok = false;
+  }
+  if (close_file(fd) != 0 && ok) {
+    *error = failure("close", request.path, errno);
+    ok = false;
+  }
+  return ok;
+}
+
+void AsyncFileWriter::run_threads() {
+  std::vector<Request> requests;
+  while (true) {
+    requests.clear();
+    if (!take_requests(1, true, &requests)) {
+      return;
+    }
+    for (const auto& request : requests) {
+      std::string error;
+      const bool ok = write_blocking(request, &error);
+      complete(request, ok, error);
+    }
+  }
+}
+
+#if defined(MANIM_CPP_HAS_IO_URING)
+
+void AsyncFileWriter::run_io_uring() {
+  enum class Step { kOpen, kWrite, kSync, kClose };
+  struct Operation {
+    Request request;
+    Step step = Step::kOpen;
+    int fd = -1;
+    std::size_t written = 0;
+    std::string error{};
+  };
+
+  // Every operation has at most one entry in the ring and no more operations
+  // than the ring has entries are in flight, so next_sqe() only fails on a
+  // broken ring and the completion queue (twice as large) never overflows.
+  std::vector<std::optional<Operation>> slots(
+      std::min<std::size_t>(settings_.queue_depth, ring_->sq_entries()));
+  std::vector<std::size_t> free_slots;
+  for (std::size_t slot = slots.size(); slot > 0; --slot) {
+    free_slots.push_back(slot - 1);
+  }
+  std::size_t in_flight = 0;
+
+  const auto prepare = [&](const std::size_t slot) {
+    auto& operation = slots[slot].value();
+    io_uring_sqe* sqe = ring_->next_sqe();
+    if (sqe == nullptr) {
+      ring_->submit(0);
+      sqe = ring_->next_sqe();
+    }
+    if (sqe == nullptr) {
+      return false;
+    }
+    sqe->user_data = slot;
+    switch (operation.step) {
+      case Step::kOpen:
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = reinterpret_cast<std::uint64_t>(operation.request.path.c_str());
+        sqe->len = 0644;
+        sqe->open_flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+        break;
+      case Step::kWrite: {
+        const auto& bytes = *operation.request.bytes;
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->fd = operation.fd;
+        sqe->addr = reinterpret_cast<std::uint64_t>(bytes.data() + operation.written);
+        sqe->len =
+            static_cast<unsigned>(std::min<std::size_t>(bytes.size() - operation.written, INT_MAX));
+        sqe->off = operation.written;
+        break;
+      }
+      case Step::kSync:
+        sqe->opcode = IORING_OP_FSYNC;
+        sqe->fd = operation.fd;
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+        break;
+      case Step::kClose:
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->fd = operation.fd;
+        break;
+    }
+    return true;
+  };
+
+  const auto finish = [&](const std::size_t slot) {
+    auto& operation = slots[slot].value();
+    complete(operation.request, operation.error.empty(), operation.error);
+    slots[slot].reset();
+    free_slots.push_back(slot);
+    --in_flight;
+  };
+
+  const auto after_write = [&](Operation& operation) {
+    const std::size_t size = operation.request.bytes != nullptr ? operation.request.bytes->size() : 0;
+    if (operation.written < size) {
+      return Step::kWrite;
+    }
+    return settings_.fsync_policy == FsyncPolicy::kPerFile ? Step::kSync : Step::kClose;
+  };
+
+  const auto advance = [&](const std::size_t slot, const int result) {
+    auto& operation = slots[slot].value();
+    switch (operation.step) {
+      case Step::kOpen:
+        if (result < 0) {
+          operation.error = failure("open", operation.request.path, -result);
+          finish(slot);
+          return;
+        }
+        operation.fd = result;
+        operation.step = after_write(operation);
+        break;
+      case Step::kWrite:
+        if (result <= 0) {
+          operation.error = failure("write", operation.request.path, result < 0 ? -result : EIO);
+          operation.step = Step::kClose;
+          break;
+        }
+        operation.written += static_cast<std::size_t>(result);
+        operation.step = after_write(operation);
+        break;
+      case Step::kSync:
+        if (result < 0) {
+          operation.error = failure("sync", operation.request.path, -result);
+        }
+        operation.step = Step::kClose;
+        break;
+      case Step::kClose:
+        if (result < 0 && operation.error.empty()) {
+          operation.error = failure("close", operation.request.path, -result);
+        }
+        finish(slot);
+        return;
+    }
+    if (!prepare(slot)) {
+      // Without a ring entry the descriptor is closed here instead.
+      ::close(operation.fd);
+      operation.error = "Failed to queue frame image write: " + operation.request.path.string();
+      finish(slot);
+    }
+  };
+
+  // While the kernel is short of resources for new submissions (EAGAIN or
+  // EBUSY) and nothing completes, sleep instead of re-entering at once.
+  auto retry_delay = std::chrono::microseconds(0);
+  std::vector<Request> admitted;
+  while (true) {
+    admitted.clear();
+    if (!take_requests(free_slots.size(), in_flight == 0, &admitted) && in_flight == 0) {
+      return;
+    }
+    for (auto& request : admitted) {
+      const std::size_t slot = free_slots.back();
+      free_slots.pop_back();
+      slots[slot].emplace(Operation{.request = std::move(request)});
+      ++in_flight;
+      if (!prepare(slot)) {
+        slots[slot]->error = "Failed to queue frame image write: " + slots[slot]->request.path.string();
+        finish(slot);
+      }
+    }
+    if (in_flight == 0) {
+      continue;
+    }
+    const int result = ring_->submit(1);
+    const bool busy = result == -EAGAIN || result == -EBUSY;
+    if (result < 0 && !busy) {
+      break;
+    }
+    const unsigned completed =
+        ring_->drain_completions([&](const std::uint64_t user_data, const int completion) {
+          advance(static_cast<std::size_t>(user_data), completion);
+        });
+    if (!busy || completed > 0) {
+      retry_delay = std::chrono::microseconds(0);
+      continue;
+    }
+    retry_delay = std::clamp(retry_delay * 2, std::chrono::microseconds(50),
+                             std::chrono::microseconds(5000));
+    std::this_thread::sleep_for(retry_delay);
+  }
+
+  // The ring is unusable. Entries the kernel never consumed are taken back;
+  // the operations it did consume keep their paths and buffers until their
+  // completions arrive. Every unfinished file is then rewritten from the
+  // start on this thread, as the thread backend would.
+  std::vector<bool> kernel_owned(slots.size());
+  for (std::size_t slot = 0; slot < slots.size(); ++slot) {
+    kernel_owned[slot] = slots[slot].has_value();
+  }
+  for (const std::uint64_t user_data : ring_->reclaim_unsubmitted()) {
+    kernel_owned[static_cast<std::size_t>(user_data)] = false;
+  }
+  auto outstanding = static_cast<std::size_t>(std::count(kernel_owned.begin(), kernel_owned.end(), true));
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (outstanding > 0 && std::chrono::steady_clock::now() < deadline) {
+    ring_->drain_completions([&](const std::uint64_t user_data, const int completion) {
+      const auto slot = static_cast<std::size_t>(user_data);
+      if (!kernel_owned[slot]) {
+        return;
+      }
+      kernel_owned[slot] = false;
+      --outstanding;
+      auto& operation = slots[slot].value();
+      if (operation.step == Step::kOpen && completion >= 0) {
+        operation.fd = completion;
+      } else if (operation.step == Step::kClose) {
+        operation.fd = -1;
+      }
+    });
+    if (outstanding > 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  ring_->close();
+  ring_failed_.store(true, std::memory_order_release);
+
+  std::vector<Request> unfinished;
+  for (std::size_t slot = 0; slot < slots.size(); ++slot) {
+    if (!slots[slot].has_value()) {
+      continue;
+    }
+    if (slots[slot]->fd >= 0 && !kernel_owned[slot]) {
+      ::close(slots[slot]->fd);
+    }
+    unfinished.push_back(slots[slot]->request);
+  }
+  if (outstanding > 0) {
+    // The kernel never answered for some entries and may still read their
+    // paths and buffers, so that memory is deliberately never freed.
+    static_cast<void>(new std::vector<std::optional<Operation>>(std::move(slots)));
+  }
+  requeue_requests(std::move(unfinished));
+  run_threads();
+}
+
+#else
+
+void AsyncFileWriter::run_io_uring() {}
+
+#endif
+
+}  // namespace manim_cpp::scene
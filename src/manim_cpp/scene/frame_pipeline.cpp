@@ -0,0 +1,329 @@
+#include "manim_cpp/scene/frame_pipeline.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "manim_cpp/renderer/cairo_renderer.hpp"
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/spsc_queue.hpp"
+#include "manim_cpp/scene/scene_file_writer.hpp"
+
+namespace manim_cpp::scene {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Handed from rasterize to encode. A frame whose draw state matches the
+// previous one carries no pixels and is written from the last encoding.
+struct RasterizedFrame {
+  std::size_t index = 0;
+  renderer::SharedFrame pixels;
+};
+
+struct Cancelled {};
+
+double seconds_since(const Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Yields first so a waiting stage hands its core to the one it waits on, then
+// sleeps briefly so long stalls do not burn a core.
+class Backoff {
+ public:
+  void pause() {
+    if (spins_ < kYieldLimit) {
+      ++spins_;
+      std::this_thread::yield();
+      return;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+
+ private:
+  static constexpr int kYieldLimit = 64;
+  int spins_ = 0;
+};
+
+template <typename T>
+bool wait_push(renderer::BoundedSpscQueue<T>& queue,
+               T& value,
+               const std::atomic<bool>& cancelled,
+               double* waited_seconds) {
+  if (queue.try_push(value)) {
+    return true;
+  }
+  const auto start = Clock::now();
+  Backoff backoff;
+  bool pushed = false;
+  while (!cancelled.load(std::memory_order_acquire)) {
+    backoff.pause();
+    if (queue.try_push(value)) {
+      pushed = true;
+      break;
+    }
+  }
+  *waited_seconds += seconds_since(start);
+  return pushed;
+}
+
+// Returns false once `upstream_done` is set and the queue is drained, or on
+// cancellation. A null `upstream_done` waits for as long as it takes.
+template <typename T>
+bool wait_pop(renderer::BoundedSpscQueue<T>& queue,
+              T* output,
+              const std::atomic<bool>* upstream_done,
+              const std::atomic<bool>& cancelled,
+              double* waited_seconds) {
+  if (queue.try_pop(output)) {
+    return true;
+  }
+  const auto start = Clock::now();
+  Backoff backoff;
+  bool popped = false;
+  while (!cancelled.load(std::memory_order_acquire)) {
+    if (upstream_done != nullptr && upstream_done->load(std::memory_order_acquire)) {
+      popped = queue.try_pop(output);
+      break;
+    }
+    backoff.pause();
+    if (queue.try_pop(output)) {
+      popped = true;
+      break;
+    }
+  }
+  *waited_seconds += seconds_since(start);
+  return popped;
+}
+
+class QueueDepthRecorder {
+ public:
+  void record(const std::size_t depth) {
+    max_depth_ = std::max(max_depth_, depth);
+    total_depth_ += depth;
+    ++samples_;
+  }
+
+  void finish(FramePipelineStageStats* stats) const {
+    stats->max_queue_depth = max_depth_;
+    stats->mean_queue_depth =
+        samples_ == 0 ? 0.0
+                      : static_cast<double>(total_depth_) / static_cast<double>(samples_);
+  }
+
+ private:
+  std::size_t max_depth_ = 0;
+  std::size_t total_depth_ = 0;
+  std::size_t samples_ = 0;
+};
+
+}  // namespace
+
+double FramePipelineStats::occupancy(const std::size_t stage) const {
+  if (stage >= stages.size() || wall_seconds <= 0.0) {
+    return 0.0;
+  }
+  return std::clamp(stages[stage].busy_seconds / wall_seconds, 0.0, 1.0);
+}
+
+FramePipeline::FramePipeline(FramePipelineSettings settings)
+    : settings_(std::move(settings)) {}
+
+bool FramePipeline::run(Scene& scene, SceneFileWriter& writer) {
+  return run_stages(
+      [this, &scene](const FrameSink& sink) {
+        // Frames written to images_dir must be rasterized even where the
+        // partial movie of their segment is cached.
+        scene.set_frame_output(settings_.images_dir.generic_string());
+        scene.set_frame_sink(sink);
+        try {
+          scene.run();
+        } catch (...) {
+          scene.set_frame_sink(nullptr);
+          throw;
+        }
+        scene.set_frame_sink(nullptr);
+      },
+      scene.scene_name(), writer);
+}
+
+bool FramePipeline::run(const SceneTimeline& timeline,
+                        const FrameRange& range,
+                        const std::string& scene_name,
+                        SceneFileWriter& writer) {
+  return run_stages(
+      [&timeline, &range](const FrameSink& sink) {
+        const auto last_index = std::min(range.last_index, timeline.frame_count());
+        for (auto index = range.first_index; index <= last_index; ++index) {
+          sink(timeline.frame(index));
+        }
+      },
+      scene_name, writer);
+}
+
+bool FramePipeline::run_stages(const std::function<void(const FrameSink&)>& evaluate,
+                               const std::string& scene_name,
+                               SceneFileWriter& writer) {
+  stats_ = {};
+  stats_.stages[0].name = "evaluate";
+  stats_.stages[1].name = "rasterize";
+  stats_.stages[2].name = "encode";
+  error_.clear();
+
+  const bool write_images = !settings_.images_dir.empty();
+  renderer::Y4mWriter* const video_sink = settings_.video_sink;
+  const bool write_frames = write_images || video_sink != nullptr;
+  // Cached segments emit frames without draw lists, which a video stream
+  // cannot carry.
+  if (video_sink != nullptr && !writer.partial_movie_dir().empty()) {
+    error_ = "Partial movie caching must be disabled to stream video for scene: " + scene_name;
+    return false;
+  }
+  const auto frame_file_name = [&](const std::size_t index) {
+    if (settings_.frame_file_name) {
+      return settings_.frame_file_name(index);
+    }
+    return renderer::CairoRenderer().frame_file_name(scene_name, index);
+  };
+
+  renderer::BoundedSpscQueue<SceneFrame> evaluated(settings_.queue_capacity);
+  renderer::BoundedSpscQueue<RasterizedFrame> rasterized(settings_.queue_capacity);
+
+  std::atomic<bool> cancelled{false};
+  std::atomic<bool> evaluate_done{false};
+  std::atomic<bool> rasterize_done{false};
+  std::atomic<bool> cached_frame_written{false};
+  std::exception_ptr scene_error;
+  const auto start = Clock::now();
+
+  std::thread evaluate_thread([&]() {
+    auto& stage = stats_.stages[0];
+    QueueDepthRecorder depth;
+    const FrameSink sink = [&](SceneFrame frame) {
+      ++stage.frames;
+      if (!write_frames) {
+        return;
+      }
+      // A cached segment emits no draw lists, so its frames cannot be
+      // written; the scene replays cached segments once it has a frame
+      // output, but a timeline compiled without one still carries them.
+      if (frame.from_cached_segment) {
+        cached_frame_written.store(true, std::memory_order_release);
+        cancelled.store(true, std::memory_order_release);
+        throw Cancelled{};
+      }
+      if (!wait_push(evaluated, frame, cancelled, &stage.output_wait_seconds)) {
+        throw Cancelled{};
+      }
+      depth.record(evaluated.size());
+    };
+    try {
+      evaluate(sink);
+    } catch (const Cancelled&) {
+    } catch (...) {
+      scene_error = std::current_exception();
+      cancelled.store(true, std::memory_order_release);
+    }
+    stage.busy_seconds = std::max(0.0, seconds_since(start) - stage.output_wait_seconds);
+    depth.finish(&stage);
+    evaluate_done.store(true, std::memory_order_release);
+  });
+
+  std::thread rasterize_thread([&]() {
+    auto& stage = stats_.stages[1];
+    QueueDepthRecorder depth;
+    renderer::CairoRenderer frame_renderer(settings_.raster_worker_count);
+    frame_renderer.set_frame_cache_max_bytes(settings_.frame_cache_max_bytes);
+    std::optional<renderer::FrameHash> previous_hash;
+    SceneFrame frame;
+    while (wait_pop(evaluated, &frame, &evaluate_done, cancelled, &stage.input_wait_seconds)) {
+      const auto work_start = Clock::now();
+      RasterizedFrame output{.index = frame.index, .pixels = nullptr};
+      const auto frame_hash =
+          renderer::hash_draw_state(frame.draw_list, settings_.raster_settings);
+      if (!previous_hash.has_value() || previous_hash.value() != frame_hash) {
+        output.pixels =
+            frame_renderer.render_frame(frame.draw_list, settings_.raster_settings, frame_hash);
+        previous_hash = frame_hash;
+      }
+      stage.busy_seconds += seconds_since(work_start);
+      ++stage.frames;
+      if (!wait_push(rasterized, output, cancelled, &stage.output_wait_seconds)) {
+        break;
+      }
+      depth.record(rasterized.size());
+    }
+    depth.finish(&stage);
+    rasterize_done.store(true, std::memory_order_release);
+  });
+
+  auto& stage = stats_.stages[2];
+  renderer::PngEncoder png_encoder(settings_.png_settings);
+  // Shared so repeated frames queue the same bytes for every file.
+  SharedBytes encoded_frame;
+  RasterizedFrame frame;
+  while (wait_pop(rasterized, &frame, &rasterize_done, cancelled, &stage.input_wait_seconds)) {
+    const auto work_start = Clock::now();
+    bool streamed = true;
+    if (frame.pixels != nullptr) {
+      const auto& buffer = *frame.pixels;
+      if (write_images) {
+        encoded_frame =
+            std::make_shared<const std::vector<std::uint8_t>>(png_encoder.encode(buffer));
+      }
+      if (video_sink != nullptr) {
+        streamed = video_sink->write_frame(buffer);
+      }
+      frame.pixels.reset();
+    } else if (video_sink != nullptr) {
+      streamed = video_sink->repeat_last_frame();
+    }
+    if (!streamed) {
+      error_ = video_sink->error();
+      cancelled.store(true, std::memory_order_release);
+      break;
+    }
+    if (write_images) {
+      if (encoded_frame == nullptr || encoded_frame->empty()) {
+        error_ = "Failed to encode frame image for scene: " + scene_name;
+        cancelled.store(true, std::memory_order_release);
+        break;
+      }
+      const auto frame_path = settings_.images_dir / frame_file_name(frame.index);
+      if (!writer.write_frame_image(frame_path, encoded_frame)) {
+        // A queued write reports the earlier frame that failed.
+        error_ = writer.frame_write_error();
+        if (error_.empty()) {
+          error_ = "Failed to write frame image file: " + frame_path.string();
+        }
+        cancelled.store(true, std::memory_order_release);
+        break;
+      }
+    }
+    stage.busy_seconds += seconds_since(work_start);
+    ++stage.frames;
+  }
+
+  evaluate_thread.join();
+  rasterize_thread.join();
+  if (cached_frame_written.load(std::memory_order_acquire) && error_.empty()) {
+    error_ = "Cannot write frames of a cached segment for scene: " + scene_name;
+  }
+  if (write_images && !writer.flush_frame_images() && error_.empty()) {
+    error_ = writer.frame_write_error();
+  }
+  stats_.wall_seconds = seconds_since(start);
+  if (scene_error) {
+    std::rethrow_exception(scene_error);
+  }
+  return error_.empty();
+}
+
+}  // namespace manim_cpp::scene
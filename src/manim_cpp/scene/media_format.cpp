@@ -29,6 +29,8 @@ std::string to_string(const MediaFormat format) {
       return "webm";
     case MediaFormat::kMov:
       return "mov";
+    case MediaFormat::kY4m:
+      return "y4m";
   }
   return "unknown";
 }
@@ -50,6 +52,9 @@ std::optional<MediaFormat> parse_media_format(std::string format_name) {
   if (format_name == "mov") {
     return MediaFormat::kMov;
   }
+  if (format_name == "y4m") {
+    return MediaFormat::kY4m;
+  }
   return std::nullopt;
 }
 
@@ -65,6 +70,8 @@ std::string codec_hint_for_format(const MediaFormat format) {
       return "vp9+opus";
     case MediaFormat::kMov:
       return "prores+pcm";
+    case MediaFormat::kY4m:
+      return "video/yuv4mpeg2";
   }
   return "unknown";
 }
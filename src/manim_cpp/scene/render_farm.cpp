@@ -0,0 +1,235 @@
+#include "manim_cpp/scene/render_farm.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <system_error>
+#include <utility>
+
+#include "manim_cpp/renderer/thread_pool.hpp"
+#include "manim_cpp/scene/scene_file_writer.hpp"
+
+#ifdef _WIN32
+#include <thread>
+#else
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace manim_cpp::scene {
+namespace {
+
+std::string worker_stem(const std::string& scene_name, const FrameRange& range) {
+  std::ostringstream stream;
+  stream << scene_name << "_frames_" << std::setfill('0') << std::setw(6) << range.first_index
+         << "_" << std::setw(6) << range.last_index;
+  return stream.str();
+}
+
+// Body of one worker: renders its frame range, then records what it produced
+// as a partial movie and a manifest for the coordinator to merge. The
+// pipeline's thread counts, where left at 0, become the worker's share of
+// the cores, so the workers together do not oversubscribe the machine.
+bool render_worker(const SceneTimeline& timeline,
+                   const std::string& scene_name,
+                   const RenderFarmSettings& settings,
+                   const RenderFarmWorker& worker,
+                   const std::size_t worker_count,
+                   const std::filesystem::path& movie_dir,
+                   std::string* error) {
+  SceneFileWriter worker_writer(scene_name);
+  if (settings.async_frame_writes.has_value()) {
+    worker_writer.enable_async_frame_writes(settings.async_frame_writes.value());
+  }
+  FramePipelineSettings pipeline_settings = settings.pipeline;
+  const auto share = std::max<std::size_t>(renderer::default_worker_count() / worker_count, 1);
+  if (pipeline_settings.raster_worker_count == 0) {
+    pipeline_settings.raster_worker_count = share;
+  }
+  if (pipeline_settings.png_settings.worker_count == 0) {
+    pipeline_settings.png_settings.worker_count = share;
+  }
+  FramePipeline pipeline(std::move(pipeline_settings));
+  if (!pipeline.run(timeline, worker.range, scene_name, worker_writer)) {
+    *error = pipeline.error();
+    return false;
+  }
+
+  std::ofstream partial_file(worker.partial_movie_file, std::ios::binary);
+  partial_file << "manim-cpp-partial-movie\n";
+  partial_file << "scene=" << scene_name << "\n";
+  partial_file << "frames=" << worker.range.first_index << "-" << worker.range.last_index
+               << "\n";
+  partial_file.close();
+  if (!partial_file) {
+    *error = "Failed to write partial movie file: " + worker.partial_movie_file.string();
+    return false;
+  }
+
+  // Relative to the coordinator's partial movie dir, like its own entries.
+  auto partial_name = worker.partial_movie_file.lexically_relative(movie_dir);
+  if (movie_dir.empty() || partial_name.empty()) {
+    partial_name = worker.partial_movie_file;
+  }
+  worker_writer.add_partial_movie_file(partial_name.generic_string());
+  worker_writer.set_section_timeline(
+      static_cast<double>(worker.range.first_index - 1) / timeline.frame_rate(),
+      static_cast<double>(worker.range.last_index) / timeline.frame_rate());
+  worker_writer.set_render_summary(worker.range.size(),
+                                   settings.pipeline.raster_settings.pixel_width,
+                                   settings.pipeline.raster_settings.pixel_height,
+                                   timeline.frame_rate(), "mp4", worker.partial_movie_file);
+  if (!worker_writer.write_media_manifest(worker.manifest_file)) {
+    *error = "Failed to write worker manifest: " + worker.manifest_file.string();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+RenderFarm::RenderFarm(RenderFarmSettings settings) : settings_(std::move(settings)) {}
+
+bool RenderFarm::uses_processes() {
+#ifdef _WIN32
+  return false;
+#else
+  return true;
+#endif
+}
+
+bool RenderFarm::run(const SceneTimeline& timeline,
+                     const std::string& scene_name,
+                     SceneFileWriter& writer) {
+  workers_.clear();
+  frame_count_ = 0;
+  error_.clear();
+
+  std::error_code filesystem_error;
+  std::filesystem::remove_all(settings_.worker_dir, filesystem_error);
+  std::filesystem::create_directories(settings_.worker_dir, filesystem_error);
+  if (filesystem_error) {
+    error_ = "Failed to create render worker directory: " + settings_.worker_dir.string();
+    return false;
+  }
+
+  for (const auto& range : timeline.partition_frames(settings_.worker_count)) {
+    const auto stem = worker_stem(scene_name, range);
+    workers_.push_back({
+        .range = range,
+        .partial_movie_file = settings_.worker_dir / (stem + ".mp4"),
+        .manifest_file = settings_.worker_dir / (stem + ".json"),
+    });
+  }
+
+  const auto worker_count = workers_.size();
+  const auto& movie_dir = writer.partial_movie_dir();
+  // One byte per worker: the Windows threads write their slots concurrently.
+  std::vector<char> succeeded(workers_.size(), 0);
+#ifdef _WIN32
+  std::vector<std::string> worker_errors(workers_.size());
+  std::vector<std::thread> threads;
+  for (std::size_t worker = 0; worker < workers_.size(); ++worker) {
+    threads.emplace_back([&, worker]() {
+      try {
+        succeeded[worker] = render_worker(timeline, scene_name, settings_, workers_[worker],
+                                          worker_count, movie_dir, &worker_errors[worker]);
+      } catch (const std::exception& exception) {
+        worker_errors[worker] = exception.what();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+#else
+  // A forked child keeps only the calling thread, so a lock held by any other
+  // thread would stay locked in it. The writer's I/O threads are stopped
+  // before forking and restarted once every worker is running.
+  std::optional<AsyncFileWriterSettings> coordinator_writes;
+  if (const auto* async_writer = writer.async_frame_writer(); async_writer != nullptr) {
+    coordinator_writes = async_writer->settings();
+    if (!writer.disable_async_frame_writes()) {
+      error_ = "Failed to flush frame images before starting render workers";
+      writer.enable_async_frame_writes(coordinator_writes.value());
+      return false;
+    }
+  }
+  // Buffered output would otherwise be flushed once per forked child.
+  std::fflush(nullptr);
+  std::vector<pid_t> pids;
+  for (const auto& worker : workers_) {
+    const pid_t pid = fork();
+    if (pid == 0) {
+      bool ok = false;
+      std::string worker_error;
+      try {
+        ok = render_worker(timeline, scene_name, settings_, worker, worker_count, movie_dir,
+                           &worker_error);
+      } catch (const std::exception& exception) {
+        worker_error = exception.what();
+      }
+      if (!ok) {
+        std::fprintf(stderr, "%s\n", worker_error.c_str());
+        std::fflush(stderr);
+      }
+      _exit(ok ? 0 : 1);
+    }
+    pids.push_back(pid);
+  }
+  if (coordinator_writes.has_value()) {
+    writer.enable_async_frame_writes(coordinator_writes.value());
+  }
+  for (std::size_t worker = 0; worker < pids.size(); ++worker) {
+    if (pids[worker] < 0) {
+      continue;
+    }
+    int status = 0;
+    pid_t waited = 0;
+    do {
+      waited = waitpid(pids[worker], &status, 0);
+    } while (waited < 0 && errno == EINTR);
+    succeeded[worker] = waited == pids[worker] && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  }
+#endif
+
+  for (std::size_t worker = 0; worker < workers_.size(); ++worker) {
+    auto& result = workers_[worker];
+    if (!succeeded[worker]) {
+      std::ostringstream stream;
+      stream << "Render worker " << worker << " failed for frames " << result.range.first_index
+             << "-" << result.range.last_index;
+#ifdef _WIN32
+      if (!worker_errors[worker].empty()) {
+        stream << ": " << worker_errors[worker];
+      }
+#endif
+      error_ = stream.str();
+      return false;
+    }
+    const auto merged = writer.merge_media_manifest(result.manifest_file);
+    if (!merged.has_value()) {
+      error_ = "Failed to merge worker manifest: " + result.manifest_file.string();
+      return false;
+    }
+    result.frame_count = merged.value();
+    frame_count_ += merged.value();
+  }
+
+  if (frame_count_ != timeline.frame_count()) {
+    std::ostringstream stream;
+    stream << "Render workers produced " << frame_count_ << " of "
+           << timeline.frame_count() << " frames";
+    error_ = stream.str();
+    return false;
+  }
+  return true;
+}
+
+}  // namespace manim_cpp::scene
@@ -1,53 +1,127 @@
 #include "manim_cpp/scene/scene.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <utility>
 
 #include "manim_cpp/animation/animation.hpp"
+#include "manim_cpp/mobject/mobject.hpp"
+#include "manim_cpp/mobject/value_tracker.hpp"
+#include "manim_cpp/renderer/draw_list.hpp"
+#include "manim_cpp/renderer/frame_cache.hpp"
+#include "manim_cpp/scene/scene_file_writer.hpp"
+#include "manim_cpp/scene/scene_timeline.hpp"
 
 namespace manim_cpp::scene {
+namespace {
+
+void hash_mobject_tree(const mobject::Mobject& mobject, renderer::FrameHasher* hasher) {
+  hasher->update(mobject.debug_name());
+  hasher->update_double(mobject.center()[0]);
+  hasher->update_double(mobject.center()[1]);
+  hasher->update_double(mobject.center()[2]);
+  hasher->update_double(mobject.opacity());
+  if (const auto* tracker = dynamic_cast<const mobject::ValueTracker*>(&mobject)) {
+    hasher->update_double(tracker->value());
+  }
+  hasher->update_u64(mobject.submobjects().size());
+  for (const auto& child : mobject.submobjects()) {
+    if (child != nullptr) {
+      hash_mobject_tree(*child, hasher);
+    }
+  }
+}
+
+}  // namespace
 
 void Scene::run() {
   setup();
   construct();
   tear_down();
+  emit_frames_until(elapsed_seconds_, true);
+  if (frame_sink_ && emitted_frame_count_ == 0) {
+    // A scene without any elapsed time still produces a single still frame.
+    emit_frames_until(0.5 / frame_rate_, true);
+  }
 }
 
 void Scene::play(animation::Animation& animation, const std::size_t steps) {
+  bool cached = false;
+  if (file_writer_ != nullptr) {
+    // Without a hash the writer neither reuses nor caches the partial movie.
+    const auto animation_hash = has_unkeyed_updaters() || !animation.cacheable()
+                                    ? std::string{}
+                                    : hash_play(animation, steps);
+    cached = frame_output_.empty() && file_writer_->is_partial_movie_cached(animation_hash);
+    file_writer_->begin_animation(true, animation_hash);
+  }
+  in_cached_segment_ = cached;
+
   animation.begin();
   const double run_time_seconds = animation.run_time_seconds();
+  if (timeline_ != nullptr) {
+    timeline_->begin_segment(TimelineSegmentKind::kPlay, elapsed_seconds_, run_time_seconds,
+                             steps, animation.debug_name(), cached);
+  }
   if (steps == 0) {
     animation.interpolate_with_rate(1.0);
     tick(run_time_seconds);
-    animation.finish();
-    return;
+  } else {
+    // A cached segment jumps straight to its end state but keeps the same
+    // tick sequence, so scene time and updaters advance identically.
+    const double delta_seconds = run_time_seconds / static_cast<double>(steps);
+    if (cached) {
+      animation.interpolate_with_rate(1.0);
+    }
+    for (std::size_t frame = 0; frame <= steps; ++frame) {
+      if (!cached) {
+        const double alpha = static_cast<double>(frame) / static_cast<double>(steps);
+        animation.interpolate_with_rate(alpha);
+      }
+      tick(delta_seconds);
+    }
   }
+  animation.finish();
+  in_cached_segment_ = false;
 
-  const double delta_seconds = run_time_seconds / static_cast<double>(steps);
-  for (std::size_t frame = 0; frame <= steps; ++frame) {
-    const double alpha = static_cast<double>(frame) / static_cast<double>(steps);
-    animation.interpolate_with_rate(alpha);
-    tick(delta_seconds);
+  if (file_writer_ != nullptr) {
+    file_writer_->end_animation(true);
   }
-  animation.finish();
 }
 
 void Scene::wait(const double seconds) {
   if (seconds <= 0.0) {
     return;
   }
+  if (file_writer_ != nullptr) {
+    const auto wait_hash = has_unkeyed_updaters() ? std::string{} : hash_wait(seconds);
+    in_cached_segment_ = frame_output_.empty() && file_writer_->is_partial_movie_cached(wait_hash);
+    file_writer_->begin_animation(true, wait_hash);
+  }
+  if (timeline_ != nullptr) {
+    timeline_->begin_segment(TimelineSegmentKind::kWait, elapsed_seconds_, seconds, 0, "",
+                             in_cached_segment_);
+  }
   tick(seconds);
+  in_cached_segment_ = false;
+  if (file_writer_ != nullptr) {
+    file_writer_->end_animation(true);
+  }
 }
 
 void Scene::tick(const double delta_seconds) {
+  if (timeline_ != nullptr) {
+    timeline_->record_snapshot(elapsed_seconds_, mobjects_, in_cached_segment_);
+  }
+  emit_frames_until(elapsed_seconds_ + delta_seconds, false);
   elapsed_seconds_ += delta_seconds;
   for (const auto& updater : updaters_) {
-    updater(delta_seconds);
+    updater.function(delta_seconds);
   }
 }
 
-void Scene::add_updater(SceneUpdater updater) {
-  updaters_.push_back(std::move(updater));
+void Scene::add_updater(SceneUpdater updater, std::string cache_key) {
+  updaters_.push_back({.function = std::move(updater), .cache_key = std::move(cache_key)});
 }
 
 void Scene::clear_updaters() {
@@ -94,6 +168,134 @@ std::uint64_t Scene::random_seed() const {
   return random_seed_;
 }
 
+void Scene::set_file_writer(SceneFileWriter* file_writer) {
+  file_writer_ = file_writer;
+}
+
+SceneFileWriter* Scene::file_writer() const {
+  return file_writer_;
+}
+
+void Scene::set_frame_output(std::string frame_output) {
+  frame_output_ = std::move(frame_output);
+}
+
+const std::string& Scene::frame_output() const {
+  return frame_output_;
+}
+
+void Scene::set_render_settings(const renderer::RasterSettings& raster_settings,
+                                const double frame_rate) {
+  raster_settings_ = raster_settings;
+  frame_rate_ = frame_rate > 0.0 ? frame_rate : 60.0;
+}
+
+const renderer::RasterSettings& Scene::raster_settings() const {
+  return raster_settings_;
+}
+
+double Scene::frame_rate() const {
+  return frame_rate_;
+}
+
+void Scene::hash_scene_state(renderer::FrameHasher* hasher) const {
+  const auto draw_state =
+      renderer::hash_draw_state(renderer::build_draw_list(mobjects_), raster_settings_);
+  hasher->update_u64(draw_state.high);
+  hasher->update_u64(draw_state.low);
+  hasher->update_double(frame_rate_);
+  hasher->update_u64(mobjects_.size());
+  for (const auto& mobject : mobjects_) {
+    if (mobject != nullptr) {
+      hash_mobject_tree(*mobject, hasher);
+    }
+  }
+  hasher->update_u64(updaters_.size());
+  for (const auto& updater : updaters_) {
+    hasher->update_u64(updater.cache_key.size());
+    hasher->update(updater.cache_key);
+  }
+  // A segment that starts on another frame, or writes somewhere else, has
+  // frames of its own even when it animates identically.
+  hasher->update_u64(next_frame_index());
+  hasher->update_u64(frame_output_.size());
+  hasher->update(frame_output_);
+}
+
+std::uint64_t Scene::next_frame_index() const {
+  // Frame k is due once scene time reaches its midpoint (k + 0.5) / rate.
+  const double index = std::ceil(elapsed_seconds_ * frame_rate_ - 0.5);
+  return index > 0.0 ? static_cast<std::uint64_t>(index) : 0;
+}
+
+bool Scene::has_unkeyed_updaters() const {
+  return std::any_of(updaters_.begin(), updaters_.end(),
+                     [](const KeyedUpdater& updater) { return updater.cache_key.empty(); });
+}
+
+std::string Scene::hash_play(const animation::Animation& animation,
+                             const std::size_t steps) const {
+  renderer::FrameHasher hasher;
+  hasher.update(std::string_view("play"));
+  hasher.update_u64(steps);
+  animation.hash_parameters(&hasher);
+  hash_scene_state(&hasher);
+  return hasher.finish().to_hex();
+}
+
+std::string Scene::hash_wait(const double seconds) const {
+  renderer::FrameHasher hasher;
+  hasher.update(std::string_view("wait"));
+  hasher.update_double(seconds);
+  hash_scene_state(&hasher);
+  return hasher.finish().to_hex();
+}
+
+void Scene::set_frame_sink(FrameSink frame_sink) {
+  if (frame_sink) {
+    emitted_frame_count_ = 0;
+  }
+  frame_sink_ = std::move(frame_sink);
+}
+
+void Scene::set_timeline(SceneTimeline* timeline) {
+  timeline_ = timeline;
+}
+
+SceneTimeline* Scene::timeline() const {
+  return timeline_;
+}
+
+std::size_t Scene::emitted_frame_count() const {
+  return emitted_frame_count_;
+}
+
+void Scene::emit_frames_until(const double end_seconds, const bool inclusive) {
+  if (!frame_sink_) {
+    return;
+  }
+  // Frame k is due once scene time passes its midpoint, which makes the total
+  // count for a scene of length T equal to llround(T * frame_rate).
+  while (true) {
+    const double midpoint =
+        (static_cast<double>(emitted_frame_count_) + 0.5) / frame_rate_;
+    if (inclusive ? midpoint > end_seconds : midpoint >= end_seconds) {
+      return;
+    }
+    SceneFrame frame{
+        .index = emitted_frame_count_ + 1,
+        .time_seconds = static_cast<double>(emitted_frame_count_) / frame_rate_,
+        .draw_list = {},
+        .from_cached_segment = in_cached_segment_,
+    };
+    if (!in_cached_segment_) {
+      frame.draw_list = renderer::build_draw_list(mobjects_);
+    }
+    ++emitted_frame_count_;
+    frame_sink_(std::move(frame));
+  }
+}
+
 double Scene::random_unit() {
   static std::uniform_real_distribution<double> distribution(0.0, 1.0);
   return distribution(rng_);
@@ -0,0 +1,409 @@
+#include "manim_cpp/scene/scene_benchmark.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <system_error>
+#include <utility>
+
+#include "manim_cpp/renderer/mesh_cache.hpp"
+#include "manim_cpp/scene/registry.hpp"
+#include "manim_cpp/scene/scene_file_writer.hpp"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <process.h>
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace manim_cpp::scene {
+namespace {
+
+std::filesystem::path default_work_dir() {
+#ifdef _WIN32
+  const auto pid = _getpid();
+#else
+  const auto pid = getpid();
+#endif
+  std::error_code error;
+  auto temp_dir = std::filesystem::temp_directory_path(error);
+  if (error) {
+    temp_dir = std::filesystem::current_path();
+  }
+  return temp_dir / ("manim_cpp_bench_" + std::to_string(pid));
+}
+
+double median_of(std::vector<double> values) {
+  std::sort(values.begin(), values.end());
+  const std::size_t middle = values.size() / 2;
+  return values.size() % 2 == 1 ? values[middle] : 0.5 * (values[middle - 1] + values[middle]);
+}
+
+std::string escape_json(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (const char ch : value) {
+    if (ch == '"' || ch == '\\') {
+      escaped.push_back('\\');
+    }
+    escaped.push_back(ch);
+  }
+  return escaped;
+}
+
+// Scene names come back as written by escape_json, so only \" and \\ occur.
+std::optional<std::string> parse_json_string(const std::string_view text) {
+  if (text.empty() || text.front() != '"') {
+    return std::nullopt;
+  }
+  std::string value;
+  for (std::size_t index = 1; index < text.size(); ++index) {
+    if (text[index] == '"') {
+      return value;
+    }
+    if (text[index] == '\\' && index + 1 < text.size()) {
+      ++index;
+    }
+    value.push_back(text[index]);
+  }
+  return std::nullopt;
+}
+
+// The number after "key": in `text`; each scene object of a report has
+// distinct keys, so the first match is the one wanted.
+template <typename Number>
+std::optional<Number> find_number(const std::string_view text, const std::string_view key) {
+  std::string quoted_key = "\"";
+  quoted_key.append(key).append("\":");
+  const auto position = text.find(quoted_key);
+  if (position == std::string_view::npos) {
+    return std::nullopt;
+  }
+  Number value{};
+  const char* first = text.data() + position + quoted_key.size();
+  const auto [last, parse_error] = std::from_chars(first, text.data() + text.size(), value);
+  if (parse_error != std::errc{} || last == first) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+}  // namespace
+
+SceneBenchmark::SceneBenchmark(SceneBenchmarkSettings settings)
+    : settings_(std::move(settings)) {
+  settings_.runs = std::max<std::size_t>(settings_.runs, 1);
+  if (settings_.work_dir.empty()) {
+    settings_.work_dir = default_work_dir();
+  }
+}
+
+bool SceneBenchmark::run(const std::string& scene_name) {
+  error_.clear();
+  if (!SceneRegistry::instance().create(scene_name)) {
+    error_ = "Unknown scene: " + scene_name;
+    return false;
+  }
+
+  const auto images_dir = settings_.work_dir / scene_name;
+  std::error_code filesystem_error;
+  std::filesystem::create_directories(images_dir, filesystem_error);
+  if (filesystem_error) {
+    error_ = "Failed to create benchmark directory: " + images_dir.string();
+    return false;
+  }
+
+  SceneBenchmarkResult result;
+  result.scene_name = scene_name;
+  result.runs = settings_.runs;
+  std::vector<double> wall_seconds;
+  wall_seconds.reserve(settings_.runs);
+  reset_peak_rss();
+  // Meshes left by earlier scenes would turn this scene's misses into hits.
+  renderer::MeshCache::global().clear();
+  bool succeeded = true;
+  for (std::size_t run = 0; run < settings_.runs && succeeded; ++run) {
+    const auto start = std::chrono::steady_clock::now();
+    auto scene = SceneRegistry::instance().create(scene_name);
+    SceneFileWriter writer(scene->scene_name());
+    scene->set_render_settings(settings_.raster_settings, settings_.frame_rate);
+    scene->set_file_writer(&writer);
+    FramePipelineSettings pipeline_settings;
+    pipeline_settings.raster_settings = settings_.raster_settings;
+    pipeline_settings.frame_cache_max_bytes = settings_.frame_cache_max_bytes;
+    pipeline_settings.images_dir = images_dir;
+    FramePipeline pipeline(std::move(pipeline_settings));
+    try {
+      succeeded = pipeline.run(*scene, writer);
+      if (!succeeded) {
+        error_ = scene_name + ": " + pipeline.error();
+      }
+    } catch (const std::exception& exception) {
+      error_ = scene_name + " threw: " + exception.what();
+      succeeded = false;
+    }
+    scene->set_file_writer(nullptr);
+    wall_seconds.push_back(
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    result.frames = scene->emitted_frame_count();
+    const auto& stats = pipeline.stats();
+    for (std::size_t stage = 0; stage < result.stages.size(); ++stage) {
+      result.stages[stage].name = stats.stages[stage].name;
+      result.stages[stage].busy_seconds += stats.stages[stage].busy_seconds;
+      result.stages[stage].input_wait_seconds += stats.stages[stage].input_wait_seconds;
+      result.stages[stage].output_wait_seconds += stats.stages[stage].output_wait_seconds;
+    }
+  }
+  result.peak_rss_bytes = peak_rss_bytes();
+  const auto mesh_stats = renderer::MeshCache::global().stats();
+  result.mesh_cache_hits = mesh_stats.hits;
+  result.mesh_cache_misses = mesh_stats.misses;
+  std::filesystem::remove_all(images_dir, filesystem_error);
+  // Only succeeds once the directory is empty, so a caller's files are kept.
+  std::filesystem::remove(settings_.work_dir, filesystem_error);
+  if (!succeeded) {
+    return false;
+  }
+
+  const auto runs = static_cast<double>(settings_.runs);
+  for (auto& stage : result.stages) {
+    stage.busy_seconds /= runs;
+    stage.input_wait_seconds /= runs;
+    stage.output_wait_seconds /= runs;
+  }
+  result.median_wall_seconds = median_of(wall_seconds);
+  result.min_wall_seconds = *std::min_element(wall_seconds.begin(), wall_seconds.end());
+  result.max_wall_seconds = *std::max_element(wall_seconds.begin(), wall_seconds.end());
+  if (result.median_wall_seconds > 0.0) {
+    result.frames_per_second = static_cast<double>(result.frames) / result.median_wall_seconds;
+  }
+  results_.push_back(std::move(result));
+  return true;
+}
+
+bool write_benchmark_report(const std::filesystem::path& path,
+                            const SceneBenchmarkReport& report) {
+  std::ofstream output(path, std::ios::binary);
+  if (!output.is_open()) {
+    return false;
+  }
+  output << std::setprecision(9);
+  output << "{";
+  output << "\"version\":1,";
+  output << "\"pixel_width\":" << report.pixel_width << ",";
+  output << "\"pixel_height\":" << report.pixel_height << ",";
+  output << "\"frame_rate\":" << report.frame_rate << ",";
+  output << "\"scenes\":[";
+  for (std::size_t i = 0; i < report.scenes.size(); ++i) {
+    const auto& scene = report.scenes[i];
+    output << "{";
+    output << "\"scene\":\"" << escape_json(scene.scene_name) << "\",";
+    output << "\"runs\":" << scene.runs << ",";
+    output << "\"frames\":" << scene.frames << ",";
+    output << "\"median_wall_seconds\":" << scene.median_wall_seconds << ",";
+    output << "\"min_wall_seconds\":" << scene.min_wall_seconds << ",";
+    output << "\"max_wall_seconds\":" << scene.max_wall_seconds << ",";
+    output << "\"frames_per_second\":" << scene.frames_per_second << ",";
+    output << "\"peak_rss_bytes\":" << scene.peak_rss_bytes << ",";
+    output << "\"mesh_cache_hits\":" << scene.mesh_cache_hits << ",";
+    output << "\"mesh_cache_misses\":" << scene.mesh_cache_misses << ",";
+    output << "\"stages\":[";
+    for (std::size_t stage = 0; stage < scene.stages.size(); ++stage) {
+      output << "{";
+      output << "\"name\":\"" << escape_json(scene.stages[stage].name) << "\",";
+      output << "\"busy_seconds\":" << scene.stages[stage].busy_seconds << ",";
+      output << "\"input_wait_seconds\":" << scene.stages[stage].input_wait_seconds << ",";
+      output << "\"output_wait_seconds\":" << scene.stages[stage].output_wait_seconds;
+      output << "}";
+      if (stage + 1 < scene.stages.size()) {
+        output << ",";
+      }
+    }
+    output << "]";
+    output << "}";
+    if (i + 1 < report.scenes.size()) {
+      output << ",";
+    }
+  }
+  output << "]";
+  output << "}\n";
+  return output.good();
+}
+
+std::optional<SceneBenchmarkReport> read_benchmark_report(const std::filesystem::path& path) {
+  std::ifstream input(path, std::ios::binary);
+  if (!input.is_open()) {
+    return std::nullopt;
+  }
+  const std::string text((std::istreambuf_iterator<char>(input)),
+                         std::istreambuf_iterator<char>());
+  const std::string scenes_key = "\"scenes\":[";
+  const auto scenes_position = text.find(scenes_key);
+  if (scenes_position == std::string::npos) {
+    return std::nullopt;
+  }
+  const std::string_view header(text.data(), scenes_position);
+  const auto pixel_width = find_number<std::size_t>(header, "pixel_width");
+  const auto pixel_height = find_number<std::size_t>(header, "pixel_height");
+  const auto frame_rate = find_number<double>(header, "frame_rate");
+  if (!pixel_width.has_value() || !pixel_height.has_value() || !frame_rate.has_value()) {
+    return std::nullopt;
+  }
+  SceneBenchmarkReport report{
+      .pixel_width = pixel_width.value(),
+      .pixel_height = pixel_height.value(),
+      .frame_rate = frame_rate.value(),
+      .scenes = {},
+  };
+
+  // Every scene object opens with its name, so the text up to the next one
+  // holds exactly that scene's fields.
+  const std::string scene_key = "{\"scene\":";
+  auto position = text.find(scene_key, scenes_position);
+  while (position != std::string::npos) {
+    const auto next = text.find(scene_key, position + scene_key.size());
+    const std::string_view object(text.data() + position,
+                                  (next == std::string::npos ? text.size() : next) - position);
+    auto scene_name = parse_json_string(object.substr(scene_key.size()));
+    const auto runs = find_number<std::size_t>(object, "runs");
+    const auto frames = find_number<std::size_t>(object, "frames");
+    const auto median_wall_seconds = find_number<double>(object, "median_wall_seconds");
+    const auto peak_rss = find_number<std::uint64_t>(object, "peak_rss_bytes");
+    if (!scene_name.has_value() || !runs.has_value() || !frames.has_value() ||
+        !median_wall_seconds.has_value() || !peak_rss.has_value()) {
+      return std::nullopt;
+    }
+    SceneBenchmarkResult result;
+    result.scene_name = std::move(scene_name.value());
+    result.runs = runs.value();
+    result.frames = frames.value();
+    result.median_wall_seconds = median_wall_seconds.value();
+    result.min_wall_seconds = find_number<double>(object, "min_wall_seconds").value_or(0.0);
+    result.max_wall_seconds = find_number<double>(object, "max_wall_seconds").value_or(0.0);
+    result.frames_per_second = find_number<double>(object, "frames_per_second").value_or(0.0);
+    result.peak_rss_bytes = peak_rss.value();
+    result.mesh_cache_hits = find_number<std::size_t>(object, "mesh_cache_hits").value_or(0);
+    result.mesh_cache_misses = find_number<std::size_t>(object, "mesh_cache_misses").value_or(0);
+    // Stage objects follow in pipeline order.
+    std::string_view stages = object;
+    for (auto& stage : result.stages) {
+      const auto stage_position = stages.find("{\"name\":");
+      if (stage_position == std::string_view::npos) {
+        break;
+      }
+      stages.remove_prefix(stage_position + 1);
+      if (const auto name = parse_json_string(stages.substr(stages.find(':') + 1))) {
+        stage.name = name.value();
+      }
+      stage.busy_seconds = find_number<double>(stages, "busy_seconds").value_or(0.0);
+      stage.input_wait_seconds = find_number<double>(stages, "input_wait_seconds").value_or(0.0);
+      stage.output_wait_seconds =
+          find_number<double>(stages, "output_wait_seconds").value_or(0.0);
+    }
+    report.scenes.push_back(std::move(result));
+    position = next;
+  }
+  return report;
+}
+
+BenchmarkComparison compare_benchmarks(const SceneBenchmarkReport& baseline,
+                                       const SceneBenchmarkReport& current,
+                                       const double threshold) {
+  BenchmarkComparison comparison;
+  if (baseline.pixel_width != current.pixel_width ||
+      baseline.pixel_height != current.pixel_height ||
+      baseline.frame_rate != current.frame_rate) {
+    comparison.render_settings_differ = true;
+    return comparison;
+  }
+  for (const auto& scene : current.scenes) {
+    const auto match = std::find_if(baseline.scenes.begin(), baseline.scenes.end(),
+                                    [&](const SceneBenchmarkResult& candidate) {
+                                      return candidate.scene_name == scene.scene_name;
+                                    });
+    if (match == baseline.scenes.end()) {
+      comparison.unmatched_scenes.push_back(scene.scene_name);
+      continue;
+    }
+    const auto regression = [&](const char* metric, const double before, const double after) {
+      return BenchmarkRegression{
+          .scene_name = scene.scene_name,
+          .metric = metric,
+          .baseline = before,
+          .current = after,
+          .change = before > 0.0 ? (after - before) / before : 0.0,
+      };
+    };
+    if (match->frames != scene.frames) {
+      comparison.regressions.push_back(regression(
+          "frames", static_cast<double>(match->frames), static_cast<double>(scene.frames)));
+      continue;
+    }
+    if (scene.median_wall_seconds > match->median_wall_seconds * (1.0 + threshold)) {
+      comparison.regressions.push_back(
+          regression("wall_seconds", match->median_wall_seconds, scene.median_wall_seconds));
+    }
+    // A baseline without an RSS measurement cannot be compared against.
+    if (match->peak_rss_bytes > 0 &&
+        static_cast<double>(scene.peak_rss_bytes) >
+            static_cast<double>(match->peak_rss_bytes) * (1.0 + threshold)) {
+      comparison.regressions.push_back(regression("peak_rss_bytes",
+                                                  static_cast<double>(match->peak_rss_bytes),
+                                                  static_cast<double>(scene.peak_rss_bytes)));
+    }
+  }
+  return comparison;
+}
+
+std::uint64_t peak_rss_bytes() {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters{};
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0) {
+    return 0;
+  }
+  return static_cast<std::uint64_t>(counters.PeakWorkingSetSize);
+#elif defined(__linux__)
+  // VmHWM follows reset_peak_rss(); getrusage() keeps the lifetime peak.
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind("VmHWM:", 0) == 0) {
+      std::uint64_t kilobytes = 0;
+      std::istringstream(line.substr(6)) >> kilobytes;
+      return kilobytes * 1024;
+    }
+  }
+  rusage usage{};
+  return getrusage(RUSAGE_SELF, &usage) == 0
+             ? static_cast<std::uint64_t>(usage.ru_maxrss) * 1024
+             : 0;
+#else
+  // macOS reports ru_maxrss in bytes.
+  rusage usage{};
+  return getrusage(RUSAGE_SELF, &usage) == 0 ? static_cast<std::uint64_t>(usage.ru_maxrss) : 0;
+#endif
+}
+
+bool reset_peak_rss() {
+#if defined(__linux__)
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.flush();
+  return clear_refs.good();
+#else
+  return false;
+#endif
+}
+
+}  // namespace manim_cpp::scene
@@ -1,10 +1,14 @@
 #include "manim_cpp/scene/scene_file_writer.hpp"
 
+#include <algorithm>
+#include <charconv>
 #include <cmath>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
 #include <sstream>
 #include <unordered_map>
+#include <utility>
 
 #include "manim_cpp/scene/media_format.hpp"
 
@@ -52,6 +56,42 @@ std::string escape_json(const std::string& value) {
   return escaped;
 }
 
+// Parses the JSON string starting at the quote at `*position` (as emitted by
+// escape_json) and leaves `*position` past the closing quote.
+bool parse_json_string(const std::string& text, std::size_t* position, std::string* output) {
+  std::size_t index = *position + 1;
+  output->clear();
+  while (index < text.size()) {
+    const char ch = text[index++];
+    if (ch == '"') {
+      *position = index;
+      return true;
+    }
+    if (ch != '\\') {
+      output->push_back(ch);
+      continue;
+    }
+    if (index >= text.size()) {
+      return false;
+    }
+    switch (const char escaped = text[index++]) {
+      case 'n':
+        output->push_back('\n');
+        break;
+      case 'r':
+        output->push_back('\r');
+        break;
+      case 't':
+        output->push_back('\t');
+        break;
+      default:
+        output->push_back(escaped);
+        break;
+    }
+  }
+  return false;
+}
+
 }  // namespace
 
 SceneFileWriter::SceneFileWriter(std::string scene_name)
@@ -65,8 +105,13 @@ void SceneFileWriter::begin_section(const std::string& name,
 }
 
 void SceneFileWriter::begin_animation(const bool write_frames) {
+  begin_animation(write_frames, std::string{});
+}
+
+void SceneFileWriter::begin_animation(const bool write_frames, std::string animation_hash) {
   animation_active_ = true;
   active_animation_writes_frames_ = write_frames;
+  active_animation_hash_ = std::move(animation_hash);
 }
 
 void SceneFileWriter::end_animation(const bool write_frames) {
@@ -81,11 +126,72 @@ void SceneFileWriter::end_animation(const bool write_frames) {
                                           !section_skips_animations;
   if (should_write_partial_movie) {
     ++rendered_animation_count_;
-    add_partial_movie_file(make_partial_movie_file_name(rendered_animation_count_));
+    if (active_animation_hash_.empty()) {
+      add_partial_movie_file(make_partial_movie_file_name(rendered_animation_count_));
+    } else {
+      const auto file_name = active_animation_hash_ + ".mp4";
+      if (is_partial_movie_cached(active_animation_hash_)) {
+        // Refresh the timestamp so cache pruning treats reused files as recent.
+        std::error_code error;
+        std::filesystem::last_write_time(partial_movie_dir_ / file_name,
+                                         std::filesystem::file_time_type::clock::now(), error);
+        ++cached_animation_count_;
+      } else if (std::find(uncached_partial_movie_files_.begin(),
+                           uncached_partial_movie_files_.end(),
+                           file_name) == uncached_partial_movie_files_.end()) {
+        uncached_partial_movie_files_.push_back(file_name);
+      }
+      add_partial_movie_file(file_name);
+    }
   }
 
   animation_active_ = false;
   active_animation_writes_frames_ = false;
+  active_animation_hash_.clear();
+}
+
+void SceneFileWriter::set_partial_movie_dir(std::filesystem::path partial_movie_dir) {
+  partial_movie_dir_ = std::move(partial_movie_dir);
+}
+
+bool SceneFileWriter::is_partial_movie_cached(const std::string& animation_hash) const {
+  if (partial_movie_dir_.empty() || animation_hash.empty()) {
+    return false;
+  }
+  std::error_code error;
+  return std::filesystem::is_regular_file(partial_movie_dir_ / (animation_hash + ".mp4"),
+                                          error);
+}
+
+std::size_t SceneFileWriter::flush_partial_movie_cache() const {
+  return prune_partial_movie_cache(0);
+}
+
+std::size_t SceneFileWriter::prune_partial_movie_cache(const std::size_t max_files) const {
+  std::error_code error;
+  if (partial_movie_dir_.empty() || !std::filesystem::is_directory(partial_movie_dir_, error)) {
+    return 0;
+  }
+
+  std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> files;
+  for (const auto& entry : std::filesystem::directory_iterator(partial_movie_dir_, error)) {
+    if (entry.is_regular_file(error) && entry.path().extension() == ".mp4") {
+      files.emplace_back(entry.last_write_time(error), entry.path());
+    }
+  }
+  if (files.size() <= max_files) {
+    return 0;
+  }
+
+  std::sort(files.begin(), files.end());
+  const std::size_t excess = files.size() - max_files;
+  std::size_t removed = 0;
+  for (std::size_t i = 0; i < excess; ++i) {
+    if (std::filesystem::remove(files[i].second, error)) {
+      ++removed;
+    }
+  }
+  return removed;
 }
 
 void SceneFileWriter::add_partial_movie_file(const std::string& path) {
@@ -196,6 +302,61 @@ bool SceneFileWriter::write_subcaptions_srt(const std::filesystem::path& output_
   return output.good();
 }
 
+void SceneFileWriter::enable_async_frame_writes(const AsyncFileWriterSettings& settings) {
+  async_frame_writer_.reset();
+  async_frame_writer_ = std::make_unique<AsyncFileWriter>(
+      settings, [this](const std::filesystem::path&, const bool ok) {
+        if (ok) {
+          written_frame_count_.fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+}
+
+bool SceneFileWriter::disable_async_frame_writes() {
+  if (async_frame_writer_ == nullptr) {
+    return true;
+  }
+  const bool flushed = async_frame_writer_->flush();
+  async_frame_writer_.reset();
+  return flushed;
+}
+
+bool SceneFileWriter::flush_frame_images() {
+  return async_frame_writer_ == nullptr || async_frame_writer_->flush();
+}
+
+std::string SceneFileWriter::frame_write_error() const {
+  return async_frame_writer_ == nullptr ? std::string{} : async_frame_writer_->error();
+}
+
+bool SceneFileWriter::write_frame_image(const std::filesystem::path& frame_path,
+                                        SharedBytes encoded_frame) {
+  if (async_frame_writer_ == nullptr) {
+    return encoded_frame != nullptr && write_frame_image(frame_path, std::span(*encoded_frame));
+  }
+  async_frame_writer_->submit(frame_path, std::move(encoded_frame));
+  return async_frame_writer_->error().empty();
+}
+
+bool SceneFileWriter::write_frame_image(const std::filesystem::path& frame_path,
+                                        const std::span<const std::uint8_t> encoded_frame) {
+  if (async_frame_writer_ != nullptr) {
+    return write_frame_image(frame_path, std::make_shared<const std::vector<std::uint8_t>>(
+                                             encoded_frame.begin(), encoded_frame.end()));
+  }
+  std::ofstream output(frame_path, std::ios::binary);
+  if (!output.is_open()) {
+    return false;
+  }
+  output.write(reinterpret_cast<const char*>(encoded_frame.data()),
+               static_cast<std::streamsize>(encoded_frame.size()));
+  if (!output.good()) {
+    return false;
+  }
+  written_frame_count_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
 bool SceneFileWriter::write_media_manifest(
     const std::filesystem::path& output_path) const {
   std::ofstream output(output_path);
@@ -294,4 +455,53 @@ std::string SceneFileWriter::make_partial_movie_file_name(
   return stream.str();
 }
 
+std::optional<std::size_t> SceneFileWriter::merge_media_manifest(
+    const std::filesystem::path& manifest_path) {
+  std::ifstream input(manifest_path);
+  if (!input.is_open()) {
+    return std::nullopt;
+  }
+  const std::string text((std::istreambuf_iterator<char>(input)),
+                         std::istreambuf_iterator<char>());
+
+  const std::string summary_key = "\"render_summary\":{";
+  const std::string frame_count_key = "\"frame_count\":";
+  const auto summary = text.find(summary_key);
+  if (summary == std::string::npos) {
+    return std::nullopt;
+  }
+  const auto frame_count_position = text.find(frame_count_key, summary);
+  if (frame_count_position == std::string::npos) {
+    return std::nullopt;
+  }
+  std::size_t frame_count = 0;
+  const char* first = text.data() + frame_count_position + frame_count_key.size();
+  const auto [last, parse_error] = std::from_chars(first, text.data() + text.size(), frame_count);
+  if (parse_error != std::errc{} || last == first) {
+    return std::nullopt;
+  }
+
+  const std::string files_key = "\"partial_movie_files\":[";
+  std::vector<std::string> partial_movie_files;
+  std::size_t position = 0;
+  while ((position = text.find(files_key, position)) != std::string::npos) {
+    position += files_key.size();
+    while (position < text.size() && text[position] != ']') {
+      if (text[position] != '"') {
+        ++position;
+        continue;
+      }
+      std::string file;
+      if (!parse_json_string(text, &position, &file)) {
+        return std::nullopt;
+      }
+      partial_movie_files.push_back(std::move(file));
+    }
+  }
+  for (const auto& file : partial_movie_files) {
+    add_partial_movie_file(file);
+  }
+  return frame_count;
+}
+
 }  // namespace manim_cpp::scene
@@ -0,0 +1,230 @@
+#include "manim_cpp/scene/scene_timeline.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "manim_cpp/mobject/mobject.hpp"
+
+namespace manim_cpp::scene {
+namespace {
+
+// Mobjects in the order build_draw_list() visits them, parents first.
+void flatten(const std::vector<std::shared_ptr<mobject::Mobject>>& mobjects,
+             std::vector<mobject::Mobject*>* output) {
+  for (const auto& mobject : mobjects) {
+    if (mobject != nullptr) {
+      output->push_back(mobject.get());
+      flatten(mobject->submobjects(), output);
+    }
+  }
+}
+
+std::vector<std::shared_ptr<mobject::Mobject>> copy_all(
+    const std::vector<std::shared_ptr<mobject::Mobject>>& mobjects) {
+  std::vector<std::shared_ptr<mobject::Mobject>> copies;
+  copies.reserve(mobjects.size());
+  for (const auto& mobject : mobjects) {
+    copies.push_back(mobject != nullptr ? mobject->copy() : nullptr);
+  }
+  return copies;
+}
+
+renderer::FrameHash draw_hash(const renderer::DrawList& draw_list) {
+  return renderer::hash_draw_state(draw_list, renderer::RasterSettings{});
+}
+
+}  // namespace
+
+SceneTimeline::SceneTimeline(const std::size_t keyframe_interval)
+    : keyframe_interval_(std::max<std::size_t>(keyframe_interval, 1)) {}
+
+SceneTimeline SceneTimeline::compile(Scene& scene, const std::size_t keyframe_interval) {
+  SceneTimeline timeline(keyframe_interval);
+  scene.set_timeline(&timeline);
+  try {
+    scene.run();
+  } catch (...) {
+    scene.set_timeline(nullptr);
+    throw;
+  }
+  scene.set_timeline(nullptr);
+  // run() samples its last frames after tear_down(), from the final state.
+  timeline.record_snapshot(scene.time_seconds(), scene.mobjects(), false);
+  timeline.finish(scene.time_seconds(), scene.frame_rate());
+  return timeline;
+}
+
+void SceneTimeline::begin_segment(const TimelineSegmentKind kind,
+                                  const double start_seconds,
+                                  const double duration_seconds,
+                                  const std::size_t steps,
+                                  std::string animation,
+                                  const bool cached) {
+  segments_.push_back({
+      .kind = kind,
+      .start_seconds = start_seconds,
+      .duration_seconds = duration_seconds,
+      .steps = steps,
+      .animation = std::move(animation),
+      .cached = cached,
+      .first_snapshot = snapshots_.size(),
+  });
+}
+
+void SceneTimeline::record_snapshot(
+    const double time_seconds,
+    const std::vector<std::shared_ptr<mobject::Mobject>>& mobjects,
+    const bool from_cached_segment) {
+  snapshots_.push_back({
+      .time_seconds = time_seconds,
+      .from_cached_segment = from_cached_segment,
+      .keyframe = keyframes_.empty() ? 0 : keyframes_.size() - 1,
+  });
+  changes_.emplace_back();
+  if (from_cached_segment) {
+    // The state jumps across cached segments, so replay restarts after them.
+    replay_.clear();
+    return;
+  }
+
+  std::vector<mobject::Mobject*> nodes;
+  flatten(mobjects, &nodes);
+  std::vector<MobjectState> states;
+  states.reserve(nodes.size());
+  for (const auto* node : nodes) {
+    states.push_back({.center = node->center(), .opacity = node->opacity()});
+  }
+  auto draw_list = renderer::build_draw_list(mobjects);
+  const auto live_hash = draw_hash(draw_list);
+
+  if (!replay_.empty() && ticks_since_keyframe_ + 1 < keyframe_interval_ &&
+      states.size() == replay_states_.size()) {
+    std::vector<StateChange> changes;
+    for (std::size_t node = 0; node < states.size(); ++node) {
+      if (states[node] != replay_states_[node]) {
+        changes.push_back({.mobject = node, .state = states[node]});
+        replay_nodes_[node]->move_to(states[node].center);
+        replay_nodes_[node]->set_opacity(states[node].opacity);
+      }
+    }
+    // Replay has to draw exactly what the scene does; anything else it
+    // cannot reproduce starts a keyframe.
+    const auto replay_hash =
+        changes.empty() ? last_draw_hash_ : draw_hash(renderer::build_draw_list(replay_));
+    if (replay_hash == live_hash) {
+      replay_states_ = std::move(states);
+      changes_.back() = std::move(changes);
+      last_draw_hash_ = live_hash;
+      ++ticks_since_keyframe_;
+      return;
+    }
+  }
+
+  snapshots_.back().keyframe = keyframes_.size();
+  Keyframe keyframe{
+      .snapshot = snapshots_.size() - 1, .mobjects = copy_all(mobjects), .draw_list = nullptr};
+  if (draw_hash(renderer::build_draw_list(keyframe.mobjects)) == live_hash) {
+    replay_ = copy_all(mobjects);
+    replay_nodes_.clear();
+    flatten(replay_, &replay_nodes_);
+    replay_states_ = std::move(states);
+  } else {
+    keyframe.draw_list = std::make_shared<const renderer::DrawList>(std::move(draw_list));
+    replay_.clear();
+  }
+  keyframes_.push_back(std::move(keyframe));
+  last_draw_hash_ = live_hash;
+  ticks_since_keyframe_ = 0;
+}
+
+void SceneTimeline::finish(const double duration_seconds, const double frame_rate) {
+  replay_.clear();
+  replay_nodes_.clear();
+  replay_states_.clear();
+  duration_seconds_ = duration_seconds;
+  frame_rate_ = frame_rate > 0.0 ? frame_rate : 60.0;
+  // Same sampling rule as Scene::emit_frames_until(): every frame whose
+  // midpoint falls inside the scene, and a single still frame otherwise.
+  frame_count_ = 0;
+  while ((static_cast<double>(frame_count_) + 0.5) / frame_rate_ <= duration_seconds_) {
+    ++frame_count_;
+  }
+  frame_count_ = std::max<std::size_t>(frame_count_, 1);
+}
+
+const TimelineSnapshot& SceneTimeline::snapshot_at(const double time_seconds) const {
+  // Ticks of zero length share a start time; the last one is what was live.
+  const auto it = std::upper_bound(
+      snapshots_.begin(), snapshots_.end(), time_seconds,
+      [](const double time, const TimelineSnapshot& entry) { return time < entry.time_seconds; });
+  if (it == snapshots_.begin()) {
+    return snapshots_.front();
+  }
+  return *std::prev(it);
+}
+
+const TimelineSegment* SceneTimeline::segment_at(const double time_seconds) const {
+  const auto it = std::upper_bound(
+      segments_.begin(), segments_.end(), time_seconds,
+      [](const double time, const TimelineSegment& entry) { return time < entry.start_seconds; });
+  if (it == segments_.begin()) {
+    return nullptr;
+  }
+  const auto& segment = *std::prev(it);
+  if (time_seconds >= segment.start_seconds + segment.duration_seconds) {
+    return nullptr;
+  }
+  return &segment;
+}
+
+renderer::DrawList SceneTimeline::draw_list(const std::size_t index) const {
+  const auto& snapshot = snapshots_.at(index);
+  if (snapshot.from_cached_segment) {
+    return {};
+  }
+  const auto& keyframe = keyframes_[snapshot.keyframe];
+  if (keyframe.draw_list != nullptr) {
+    return *keyframe.draw_list;
+  }
+  auto mobjects = copy_all(keyframe.mobjects);
+  std::vector<mobject::Mobject*> nodes;
+  flatten(mobjects, &nodes);
+  for (std::size_t tick = keyframe.snapshot + 1; tick <= index; ++tick) {
+    for (const auto& change : changes_[tick]) {
+      nodes[change.mobject]->move_to(change.state.center);
+      nodes[change.mobject]->set_opacity(change.state.opacity);
+    }
+  }
+  return renderer::build_draw_list(mobjects);
+}
+
+SceneFrame SceneTimeline::frame(const std::size_t index) const {
+  const auto frame_number = static_cast<double>(index > 0 ? index - 1 : 0);
+  const auto& snapshot = snapshot_at((frame_number + 0.5) / frame_rate_);
+  return {
+      .index = index,
+      .time_seconds = frame_number / frame_rate_,
+      .draw_list = draw_list(static_cast<std::size_t>(&snapshot - snapshots_.data())),
+      .from_cached_segment = snapshot.from_cached_segment,
+  };
+}
+
+std::vector<FrameRange> SceneTimeline::partition_frames(const std::size_t range_count) const {
+  std::vector<FrameRange> ranges;
+  if (frame_count_ == 0) {
+    return ranges;
+  }
+  const auto count = std::clamp<std::size_t>(range_count, 1, frame_count_);
+  const auto base = frame_count_ / count;
+  const auto remainder = frame_count_ % count;
+  std::size_t next = 1;
+  for (std::size_t range = 0; range < count; ++range) {
+    const auto size = base + (range < remainder ? 1 : 0);
+    ranges.push_back({.first_index = next, .last_index = next + size - 1});
+    next += size;
+  }
+  return ranges;
+}
+
+}  // namespace manim_cpp::scene
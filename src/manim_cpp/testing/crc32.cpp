@@ -0,0 +1,248 @@
+#include "manim_cpp/testing/crc32.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define MANIM_CPP_CRC32_PCLMUL 1
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define MANIM_CPP_CRC32_ARMV8 1
+#include <arm_acle.h>
+#if defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace manim_cpp::testing {
+namespace {
+
+constexpr std::uint32_t kPolynomial = 0xEDB88320U;
+
+// kTables[k][b] is the CRC of byte b followed by k zero bytes, which lets
+// slicing-by-8 look up eight input bytes independently per step.
+constexpr auto kTables = []() {
+  std::array<std::array<std::uint32_t, 256>, 8> tables{};
+  for (std::uint32_t byte = 0; byte < 256; ++byte) {
+    std::uint32_t crc = byte;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 1U) != 0U ? (crc >> 1U) ^ kPolynomial : crc >> 1U;
+    }
+    tables[0][byte] = crc;
+  }
+  for (std::size_t slice = 1; slice < tables.size(); ++slice) {
+    for (std::size_t byte = 0; byte < 256; ++byte) {
+      const std::uint32_t previous = tables[slice - 1][byte];
+      tables[slice][byte] = (previous >> 8U) ^ tables[0][previous & 0xFFU];
+    }
+  }
+  return tables;
+}();
+
+// a * b modulo the CRC polynomial, both in reflected bit order.
+std::uint32_t multiply_mod_crc(const std::uint32_t a, std::uint32_t b) {
+  std::uint32_t product = 0;
+  for (std::uint32_t mask = 0x80000000U; mask != 0; mask >>= 1U) {
+    if ((a & mask) != 0U) {
+      product ^= b;
+    }
+    b = (b & 1U) != 0U ? (b >> 1U) ^ kPolynomial : b >> 1U;
+  }
+  return product;
+}
+
+// Works on the inverted running state, like the hardware paths below.
+std::uint32_t slicing_by_8(std::uint32_t state, const std::uint8_t* data, std::size_t size) {
+  while (size >= 8) {
+    std::uint32_t low = 0;
+    std::uint32_t high = 0;
+    std::memcpy(&low, data, 4);
+    std::memcpy(&high, data + 4, 4);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    low = __builtin_bswap32(low);
+    high = __builtin_bswap32(high);
+#endif
+    low ^= state;
+    state = kTables[7][low & 0xFFU] ^ kTables[6][(low >> 8U) & 0xFFU] ^
+            kTables[5][(low >> 16U) & 0xFFU] ^ kTables[4][low >> 24U] ^
+            kTables[3][high & 0xFFU] ^ kTables[2][(high >> 8U) & 0xFFU] ^
+            kTables[1][(high >> 16U) & 0xFFU] ^ kTables[0][high >> 24U];
+    data += 8;
+    size -= 8;
+  }
+  while (size > 0) {
+    state = (state >> 8U) ^ kTables[0][(state ^ *data) & 0xFFU];
+    ++data;
+    --size;
+  }
+  return state;
+}
+
+#if defined(MANIM_CPP_CRC32_PCLMUL)
+
+__attribute__((target("pclmul,sse4.1"))) __m128i load_pclmul(const std::uint8_t* bytes) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+}
+
+// lane * x^k XORed into `next`, with k chosen by `constants`.
+__attribute__((target("pclmul,sse4.1"))) __m128i fold_lane(const __m128i lane,
+                                                           const __m128i next,
+                                                           const __m128i constants) {
+  const __m128i low = _mm_clmulepi64_si128(lane, constants, 0x00);
+  const __m128i high = _mm_clmulepi64_si128(lane, constants, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(high, low), next);
+}
+
+// Carry-less multiplication folding after Intel's "Fast CRC Computation for
+// Generic Polynomials Using PCLMULQDQ": four 128-bit lanes are folded 64
+// bytes at a time, reduced to one lane, then to 32 bits with a Barrett
+// reduction. Constants are x^k mod P for the reflected polynomial. `size` is
+// a multiple of 16, at least 64.
+__attribute__((target("pclmul,sse4.1"))) std::uint32_t fold_pclmul(const std::uint32_t state,
+                                                                   const std::uint8_t* data,
+                                                                   std::size_t size) {
+  const __m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+  const __m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+  const __m128i k5 = _mm_set_epi64x(0, 0x0163CD6124);
+  const __m128i polynomial = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+  const __m128i low_words = _mm_setr_epi32(-1, 0, -1, 0);
+
+  __m128i x1 = _mm_xor_si128(load_pclmul(data), _mm_cvtsi32_si128(static_cast<int>(state)));
+  __m128i x2 = load_pclmul(data + 16);
+  __m128i x3 = load_pclmul(data + 32);
+  __m128i x4 = load_pclmul(data + 48);
+  data += 64;
+  size -= 64;
+
+  while (size >= 64) {
+    x1 = fold_lane(x1, load_pclmul(data), k1k2);
+    x2 = fold_lane(x2, load_pclmul(data + 16), k1k2);
+    x3 = fold_lane(x3, load_pclmul(data + 32), k1k2);
+    x4 = fold_lane(x4, load_pclmul(data + 48), k1k2);
+    data += 64;
+    size -= 64;
+  }
+
+  x1 = fold_lane(x1, x2, k3k4);
+  x1 = fold_lane(x1, x3, k3k4);
+  x1 = fold_lane(x1, x4, k3k4);
+  while (size >= 16) {
+    x1 = fold_lane(x1, load_pclmul(data), k3k4);
+    data += 16;
+    size -= 16;
+  }
+
+  // 128 -> 64 bits.
+  x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, low_words), k5, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduction to 32 bits.
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, low_words), polynomial, 0x10);
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, low_words), polynomial, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+  return static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+bool cpu_has_pclmul() {
+  static const bool has_pclmul =
+      __builtin_cpu_supports("pclmul") != 0 && __builtin_cpu_supports("sse4.1") != 0;
+  return has_pclmul;
+}
+
+#elif defined(MANIM_CPP_CRC32_ARMV8)
+
+#if defined(__clang__)
+#define MANIM_CPP_CRC32_TARGET __attribute__((target("crc")))
+#else
+#define MANIM_CPP_CRC32_TARGET __attribute__((target("+crc")))
+#endif
+
+MANIM_CPP_CRC32_TARGET std::uint32_t crc_armv8(std::uint32_t state,
+                                               const std::uint8_t* data,
+                                               std::size_t size) {
+  while (size >= 8) {
+    std::uint64_t word = 0;
+    std::memcpy(&word, data, 8);
+    state = __crc32d(state, word);
+    data += 8;
+    size -= 8;
+  }
+  while (size > 0) {
+    state = __crc32b(state, *data);
+    ++data;
+    --size;
+  }
+  return state;
+}
+
+bool cpu_has_crc32() {
+#if defined(__APPLE__) || defined(__ARM_FEATURE_CRC32)
+  return true;
+#elif defined(__linux__) && defined(HWCAP_CRC32)
+  static const bool has_crc32 = (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+  return has_crc32;
+#else
+  return false;
+#endif
+}
+
+#endif
+
+}  // namespace
+
+std::uint32_t crc32_update_slicing_by_8(const std::uint32_t crc,
+                                        const std::span<const std::uint8_t> bytes) {
+  return ~slicing_by_8(~crc, bytes.data(), bytes.size());
+}
+
+std::uint32_t crc32_update(const std::uint32_t crc, const std::span<const std::uint8_t> bytes) {
+  std::uint32_t state = ~crc;
+  const std::uint8_t* data = bytes.data();
+  std::size_t size = bytes.size();
+#if defined(MANIM_CPP_CRC32_PCLMUL)
+  if (size >= 64 && cpu_has_pclmul()) {
+    const std::size_t folded = size & ~static_cast<std::size_t>(15);
+    state = fold_pclmul(state, data, folded);
+    data += folded;
+    size -= folded;
+  }
+#elif defined(MANIM_CPP_CRC32_ARMV8)
+  if (cpu_has_crc32()) {
+    return ~crc_armv8(state, data, size);
+  }
+#endif
+  return ~slicing_by_8(state, data, size);
+}
+
+// crc(A) is multiplied by x^(8 * length) by repeated squaring, as zlib does.
+std::uint32_t crc32_combine(const std::uint32_t crc_a,
+                            const std::uint32_t crc_b,
+                            std::uint64_t length_b) {
+  std::uint32_t power = 0x80000000U;   // x^0
+  std::uint32_t square = 0x00800000U;  // x^8, one zero byte
+  while (length_b != 0) {
+    if ((length_b & 1U) != 0U) {
+      power = multiply_mod_crc(power, square);
+    }
+    square = multiply_mod_crc(square, square);
+    length_b >>= 1U;
+  }
+  return multiply_mod_crc(power, crc_a) ^ crc_b;
+}
+
+const char* crc32_implementation_name() {
+#if defined(MANIM_CPP_CRC32_PCLMUL)
+  return cpu_has_pclmul() ? "pclmul" : "slicing-by-8";
+#elif defined(MANIM_CPP_CRC32_ARMV8)
+  return cpu_has_crc32() ? "armv8" : "slicing-by-8";
+#else
+  return "slicing-by-8";
+#endif
+}
+
+}  // namespace manim_cpp::testing
@@ -0,0 +1,362 @@
+#include "manim_cpp/testing/image_diff.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "manim_cpp/renderer/image_io.hpp"
+#include "manim_cpp/renderer/thread_pool.hpp"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define MANIM_CPP_IMAGE_DIFF_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace manim_cpp::testing {
+namespace {
+
+constexpr std::size_t kSsimBlock = 8;
+
+struct ErrorTotals {
+  std::array<std::uint8_t, 4> channel_max_error{};
+  std::uint64_t differing_pixels = 0;
+  std::uint64_t squared_error = 0;
+};
+
+bool comparable(const ImageView& expected, const ImageView& actual) {
+  const std::size_t bytes = expected.width * expected.height * expected.channels;
+  return expected.width == actual.width && expected.height == actual.height &&
+         expected.channels == actual.channels &&
+         (expected.channels == 3 || expected.channels == 4) && expected.pixels.size() >= bytes &&
+         actual.pixels.size() >= bytes;
+}
+
+// Accumulates whole pixels in [0, size) bytes into `totals`.
+void accumulate_scalar(const std::uint8_t* expected,
+                       const std::uint8_t* actual,
+                       const std::size_t size,
+                       const std::size_t channels,
+                       const std::array<std::uint8_t, 4>& tolerance,
+                       ErrorTotals* totals) {
+  for (std::size_t pixel = 0; pixel < size; pixel += channels) {
+    bool differs = false;
+    for (std::size_t channel = 0; channel < channels; ++channel) {
+      const auto error = static_cast<std::uint8_t>(
+          std::abs(expected[pixel + channel] - actual[pixel + channel]));
+      totals->channel_max_error[channel] = std::max(totals->channel_max_error[channel], error);
+      totals->squared_error += static_cast<std::uint64_t>(error) * error;
+      differs = differs || error > tolerance[channel];
+    }
+    totals->differing_pixels += differs ? 1 : 0;
+  }
+}
+
+std::uint64_t count_differing_pixels(const std::uint8_t* expected,
+                                     const std::uint8_t* actual,
+                                     const std::size_t size,
+                                     const std::size_t channels,
+                                     const std::array<std::uint8_t, 4>& tolerance) {
+  std::uint64_t count = 0;
+  for (std::size_t pixel = 0; pixel < size; pixel += channels) {
+    for (std::size_t channel = 0; channel < channels; ++channel) {
+      if (std::abs(expected[pixel + channel] - actual[pixel + channel]) > tolerance[channel]) {
+        ++count;
+        break;
+      }
+    }
+  }
+  return count;
+}
+
+#if defined(MANIM_CPP_IMAGE_DIFF_AVX2)
+
+// 96 bytes, a whole number of both RGB and RGBA pixels, per iteration.
+constexpr std::size_t kAvx2Block = 96;
+// Each iteration adds at most 6 * 2 * 255^2 to a 32-bit lane.
+constexpr std::size_t kAvx2FlushIterations = 4096;
+
+__attribute__((target("avx2"))) __m256i load_avx2(const std::uint8_t* bytes) {
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes));
+}
+
+__attribute__((target("avx2"))) __m256i absolute_difference(const __m256i a, const __m256i b) {
+  return _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+}
+
+// Squares of the 32 byte errors in `error`, summed pairwise into 8 lanes.
+__attribute__((target("avx2"))) __m256i squared_errors(const __m256i error) {
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i low = _mm256_unpacklo_epi8(error, zero);
+  const __m256i high = _mm256_unpackhi_epi8(error, zero);
+  return _mm256_add_epi32(_mm256_madd_epi16(low, low), _mm256_madd_epi16(high, high));
+}
+
+__attribute__((target("avx2"))) std::uint64_t horizontal_sum(const __m256i lanes) {
+  alignas(32) std::uint32_t values[8];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(values), lanes);
+  std::uint64_t sum = 0;
+  for (const auto value : values) {
+    sum += value;
+  }
+  return sum;
+}
+
+// Three vectors per iteration, so byte i of vector k always holds channel
+// (32k + i) % channels and one tolerance and max vector per k suffices. A
+// block only falls back to per-pixel counting when some byte is out of
+// tolerance, which keeps matching images on the fast path.
+__attribute__((target("avx2"))) std::size_t accumulate_avx2(const std::uint8_t* expected,
+                                                            const std::uint8_t* actual,
+                                                            const std::size_t size,
+                                                            const std::size_t channels,
+                                                            const std::array<std::uint8_t, 4>& tolerance,
+                                                            ErrorTotals* totals) {
+  alignas(32) std::uint8_t pattern[kAvx2Block];
+  for (std::size_t i = 0; i < kAvx2Block; ++i) {
+    pattern[i] = tolerance[i % channels];
+  }
+  __m256i tolerances[3];
+  __m256i maxima[3];
+  for (int k = 0; k < 3; ++k) {
+    tolerances[k] = load_avx2(pattern + 32 * k);
+    maxima[k] = _mm256_setzero_si256();
+  }
+
+  __m256i squares = _mm256_setzero_si256();
+  std::size_t iterations = 0;
+  std::size_t offset = 0;
+  for (; offset + kAvx2Block <= size; offset += kAvx2Block) {
+    __m256i over = _mm256_setzero_si256();
+    for (int k = 0; k < 3; ++k) {
+      const __m256i error = absolute_difference(load_avx2(expected + offset + 32 * k),
+                                                load_avx2(actual + offset + 32 * k));
+      maxima[k] = _mm256_max_epu8(maxima[k], error);
+      squares = _mm256_add_epi32(squares, squared_errors(error));
+      over = _mm256_or_si256(over, _mm256_subs_epu8(error, tolerances[k]));
+    }
+    if (_mm256_testz_si256(over, over) == 0) {
+      totals->differing_pixels +=
+          count_differing_pixels(expected + offset, actual + offset, kAvx2Block, channels, tolerance);
+    }
+    if (++iterations == kAvx2FlushIterations) {
+      totals->squared_error += horizontal_sum(squares);
+      squares = _mm256_setzero_si256();
+      iterations = 0;
+    }
+  }
+  totals->squared_error += horizontal_sum(squares);
+
+  for (int k = 0; k < 3; ++k) {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(pattern + 32 * k), maxima[k]);
+  }
+  for (std::size_t i = 0; i < kAvx2Block; ++i) {
+    auto& channel_max = totals->channel_max_error[i % channels];
+    channel_max = std::max(channel_max, pattern[i]);
+  }
+  return offset;
+}
+
+bool cpu_has_avx2() {
+  static const bool has_avx2 = __builtin_cpu_supports("avx2") != 0;
+  return has_avx2;
+}
+
+#endif
+
+int luma(const std::uint8_t* pixel) {
+  return (77 * pixel[0] + 150 * pixel[1] + 29 * pixel[2] + 128) >> 8;
+}
+
+// Mean SSIM of the luma over non-overlapping 8x8 blocks (one block for
+// images smaller than that), with the usual K1 = 0.01, K2 = 0.03 constants.
+// Sums are integers, so identical inputs give exactly 1.
+double mean_ssim(const ImageView& expected, const ImageView& actual) {
+  const std::size_t block_width = std::min(kSsimBlock, expected.width);
+  const std::size_t block_height = std::min(kSsimBlock, expected.height);
+  const double c1 = (0.01 * 255) * (0.01 * 255);
+  const double c2 = (0.03 * 255) * (0.03 * 255);
+  const std::size_t stride = expected.width * expected.channels;
+  double total = 0.0;
+  std::size_t blocks = 0;
+  for (std::size_t top = 0; top + block_height <= expected.height; top += block_height) {
+    for (std::size_t left = 0; left + block_width <= expected.width; left += block_width) {
+      std::int64_t sum_x = 0;
+      std::int64_t sum_y = 0;
+      std::int64_t sum_xx = 0;
+      std::int64_t sum_yy = 0;
+      std::int64_t sum_xy = 0;
+      for (std::size_t y = top; y < top + block_height; ++y) {
+        for (std::size_t x = left; x < left + block_width; ++x) {
+          const std::size_t offset = y * stride + x * expected.channels;
+          const std::int64_t a = luma(expected.pixels.data() + offset);
+          const std::int64_t b = luma(actual.pixels.data() + offset);
+          sum_x += a;
+          sum_y += b;
+          sum_xx += a * a;
+          sum_yy += b * b;
+          sum_xy += a * b;
+        }
+      }
+      const auto n = static_cast<double>(block_width * block_height);
+      const double mean_x = static_cast<double>(sum_x) / n;
+      const double mean_y = static_cast<double>(sum_y) / n;
+      const double variance_x = static_cast<double>(sum_xx) / n - mean_x * mean_x;
+      const double variance_y = static_cast<double>(sum_yy) / n - mean_y * mean_y;
+      const double covariance = static_cast<double>(sum_xy) / n - mean_x * mean_y;
+      total += ((2 * mean_x * mean_y + c1) * (2 * covariance + c2)) /
+               ((mean_x * mean_x + mean_y * mean_y + c1) * (variance_x + variance_y + c2));
+      ++blocks;
+    }
+  }
+  return blocks == 0 ? 1.0 : total / static_cast<double>(blocks);
+}
+
+ImageDiff diff(const ImageView& expected,
+               const ImageView& actual,
+               const ImageDiffSettings& settings,
+               const bool allow_simd) {
+  ImageDiff result;
+  if (!comparable(expected, actual)) {
+    return result;
+  }
+  result.comparable = true;
+
+  const std::size_t channels = expected.channels;
+  const std::size_t size = expected.width * expected.height * channels;
+  ErrorTotals totals;
+  std::size_t done = 0;
+#if defined(MANIM_CPP_IMAGE_DIFF_AVX2)
+  if (allow_simd && cpu_has_avx2()) {
+    done = accumulate_avx2(expected.pixels.data(), actual.pixels.data(), size, channels,
+                           settings.channel_tolerance, &totals);
+  }
+#else
+  static_cast<void>(allow_simd);
+#endif
+  accumulate_scalar(expected.pixels.data() + done, actual.pixels.data() + done, size - done,
+                    channels, settings.channel_tolerance, &totals);
+
+  result.channel_max_error = totals.channel_max_error;
+  result.max_error = *std::max_element(totals.channel_max_error.begin(),
+                                       totals.channel_max_error.end());
+  result.differing_pixels = totals.differing_pixels;
+  if (size != 0 && totals.squared_error != 0) {
+    result.mean_squared_error =
+        static_cast<double>(totals.squared_error) / static_cast<double>(size);
+    result.psnr = 10.0 * std::log10((255.0 * 255.0) / result.mean_squared_error);
+    if (settings.compute_ssim) {
+      result.ssim = mean_ssim(expected, actual);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+ImageDiff diff_images(const ImageView& expected,
+                      const ImageView& actual,
+                      const ImageDiffSettings& settings) {
+  return diff(expected, actual, settings, true);
+}
+
+ImageDiff diff_images_scalar(const ImageView& expected,
+                             const ImageView& actual,
+                             const ImageDiffSettings& settings) {
+  return diff(expected, actual, settings, false);
+}
+
+FrameSequenceDiff diff_frame_sequences(const std::span<const ImageView> expected,
+                                       const std::span<const ImageView> actual,
+                                       const ImageDiffSettings& settings) {
+  FrameSequenceDiff result;
+  const std::size_t frame_count = std::min(expected.size(), actual.size());
+  result.frames.resize(frame_count);
+  const auto diff_frame = [&](const std::size_t frame) {
+    result.frames[frame] = diff_images(expected[frame], actual[frame], settings);
+  };
+  const std::size_t worker_count =
+      settings.worker_count == 0 ? renderer::default_worker_count() : settings.worker_count;
+  if (worker_count <= 1 || frame_count <= 1) {
+    for (std::size_t frame = 0; frame < frame_count; ++frame) {
+      diff_frame(frame);
+    }
+  } else {
+    renderer::WorkStealingThreadPool pool(std::min(worker_count, frame_count));
+    pool.parallel_for(frame_count, diff_frame);
+  }
+
+  for (std::size_t frame = 0; frame < frame_count; ++frame) {
+    const auto& frame_diff = result.frames[frame];
+    if (!frame_diff.within_tolerance() && !result.first_diverging_frame.has_value()) {
+      result.first_diverging_frame = frame;
+    }
+    result.max_error = std::max(result.max_error, frame_diff.max_error);
+    result.min_psnr = std::min(result.min_psnr, frame_diff.psnr);
+    result.min_ssim = std::min(result.min_ssim, frame_diff.ssim);
+  }
+  if (!result.first_diverging_frame.has_value() && expected.size() != actual.size()) {
+    result.first_diverging_frame = frame_count;
+  }
+  return result;
+}
+
+renderer::FrameBuffer render_diff_heatmap(const ImageView& expected,
+                                          const ImageView& actual,
+                                          const ImageDiffSettings& settings) {
+  if (!comparable(expected, actual)) {
+    return {};
+  }
+  renderer::FrameBuffer heatmap(expected.width, expected.height);
+  const std::size_t channels = expected.channels;
+  const std::size_t pixel_count = expected.width * expected.height;
+  for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+    const std::uint8_t* a = expected.pixels.data() + pixel * channels;
+    const std::uint8_t* b = actual.pixels.data() + pixel * channels;
+    int max_error = 0;
+    bool differs = false;
+    for (std::size_t channel = 0; channel < channels; ++channel) {
+      const int error = std::abs(a[channel] - b[channel]);
+      max_error = std::max(max_error, error);
+      differs = differs || error > settings.channel_tolerance[channel];
+    }
+    std::uint8_t* target = heatmap.data() + pixel * renderer::FrameBuffer::kChannels;
+    if (differs) {
+      // 1..255 maps to dark red at the low end, red at half, yellow at 255.
+      target[0] = static_cast<std::uint8_t>(std::min(255, 128 + max_error));
+      target[1] = static_cast<std::uint8_t>(std::max(0, 2 * max_error - 255));
+      target[2] = 0;
+    } else {
+      const auto gray = static_cast<std::uint8_t>(luma(a) / 4);
+      target[0] = gray;
+      target[1] = gray;
+      target[2] = gray;
+    }
+    target[3] = 255;
+  }
+  return heatmap;
+}
+
+bool write_diff_heatmap(const std::filesystem::path& output_path,
+                        const ImageView& expected,
+                        const ImageView& actual,
+                        const ImageDiffSettings& settings) {
+  const auto heatmap = render_diff_heatmap(expected, actual, settings);
+  if (heatmap.empty()) {
+    return false;
+  }
+  if (output_path.has_parent_path()) {
+    std::error_code error;
+    std::filesystem::create_directories(output_path.parent_path(), error);
+  }
+  return renderer::write_png(output_path, heatmap);
+}
+
+const char* image_diff_kernel_name() {
+#if defined(MANIM_CPP_IMAGE_DIFF_AVX2)
+  return cpu_has_avx2() ? "avx2" : "scalar";
+#else
+  return "scalar";
+#endif
+}
+
+}  // namespace manim_cpp::testing
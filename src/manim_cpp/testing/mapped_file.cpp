@@ -0,0 +1,161 @@
+#include "manim_cpp/testing/mapped_file.hpp"
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace manim_cpp::testing {
+
+MappedFile::~MappedFile() { close(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+  if (this != &other) {
+    close();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    open_ = std::exchange(other.open_, false);
+#ifdef _WIN32
+    mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+    error_ = std::move(other.error_);
+  }
+  return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const std::filesystem::path& path) {
+  close();
+  error_.clear();
+  HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    error_ = "Failed to open file: " + path.string();
+    return false;
+  }
+  LARGE_INTEGER size{};
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    error_ = "Failed to read file size: " + path.string();
+    return false;
+  }
+  if (size.QuadPart == 0) {
+    CloseHandle(file);
+    open_ = true;
+    return true;
+  }
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    error_ = "Failed to map file: " + path.string();
+    return false;
+  }
+  void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (view == nullptr) {
+    CloseHandle(mapping);
+    error_ = "Failed to map file: " + path.string();
+    return false;
+  }
+  mapping_ = mapping;
+  data_ = static_cast<const std::uint8_t*>(view);
+  size_ = static_cast<std::size_t>(size.QuadPart);
+  open_ = true;
+  return true;
+}
+
+void MappedFile::close() {
+  if (data_ != nullptr) {
+    UnmapViewOfFile(data_);
+  }
+  if (mapping_ != nullptr) {
+    CloseHandle(static_cast<HANDLE>(mapping_));
+  }
+  data_ = nullptr;
+  mapping_ = nullptr;
+  size_ = 0;
+  open_ = false;
+}
+
+void MappedFile::release(const std::span<const std::uint8_t> range) const {
+  // Unmodified views are trimmed by VirtualUnlock when they are not locked.
+  if (!range.empty()) {
+    VirtualUnlock(const_cast<std::uint8_t*>(range.data()), range.size());
+  }
+}
+
+#else
+
+bool MappedFile::open(const std::filesystem::path& path) {
+  close();
+  error_.clear();
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    error_ = "Failed to open file: " + path.string() + ": " +
+             std::generic_category().message(errno);
+    return false;
+  }
+  struct stat status {};
+  if (fstat(fd, &status) != 0) {
+    error_ = "Failed to read file size: " + path.string() + ": " +
+             std::generic_category().message(errno);
+    ::close(fd);
+    return false;
+  }
+  const auto size = static_cast<std::size_t>(status.st_size);
+  if (size == 0) {
+    ::close(fd);
+    open_ = true;
+    return true;
+  }
+  void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  const int map_error = errno;
+  ::close(fd);
+  if (view == MAP_FAILED) {
+    error_ = "Failed to map file: " + path.string() + ": " +
+             std::generic_category().message(map_error);
+    return false;
+  }
+  data_ = static_cast<const std::uint8_t*>(view);
+  size_ = size;
+  open_ = true;
+  return true;
+}
+
+void MappedFile::close() {
+  if (data_ != nullptr) {
+    munmap(const_cast<std::uint8_t*>(data_), size_);
+  }
+  data_ = nullptr;
+  size_ = 0;
+  open_ = false;
+}
+
+void MappedFile::release(const std::span<const std::uint8_t> range) const {
+  if (range.empty() || data_ == nullptr) {
+    return;
+  }
+  // Only whole pages inside the range; the neighbours may still be in use.
+  const auto page = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+  const auto begin = (reinterpret_cast<std::uintptr_t>(range.data()) + page - 1) & ~(page - 1);
+  const auto end = (reinterpret_cast<std::uintptr_t>(range.data()) + range.size()) & ~(page - 1);
+  if (end > begin) {
+    // Clean file-backed pages are dropped and re-read from the file if
+    // touched again.
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED);
+  }
+}
+
+#endif
+
+}  // namespace manim_cpp::testing
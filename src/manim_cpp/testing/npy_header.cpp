@@ -0,0 +1,263 @@
+#include "manim_cpp/testing/npy_header.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <string_view>
+
+namespace manim_cpp::testing {
+namespace {
+
+constexpr std::array<std::uint8_t, 6> kNpyMagic = {0x93, 'N', 'U', 'M', 'P', 'Y'};
+
+// A cursor over the header dict, which is a Python literal such as
+// {'descr': '<f4', 'fortran_order': False, 'shape': (2, 3), }
+class DictScanner {
+ public:
+  explicit DictScanner(const std::string_view text) : text_(text) {}
+
+  void skip_space() {
+    while (position_ < text_.size() &&
+           (text_[position_] == ' ' || text_[position_] == '\t' || text_[position_] == '\n' ||
+            text_[position_] == '\r')) {
+      ++position_;
+    }
+  }
+
+  // Consumes `c` after any whitespace.
+  bool accept(const char c) {
+    skip_space();
+    if (position_ < text_.size() && text_[position_] == c) {
+      ++position_;
+      return true;
+    }
+    return false;
+  }
+
+  bool accept_word(const std::string_view word) {
+    skip_space();
+    if (text_.substr(position_, word.size()) != word) {
+      return false;
+    }
+    position_ += word.size();
+    return true;
+  }
+
+  // A single- or double-quoted string without escapes.
+  std::optional<std::string_view> quoted() {
+    skip_space();
+    if (position_ >= text_.size() || (text_[position_] != '\'' && text_[position_] != '"')) {
+      return std::nullopt;
+    }
+    const char quote = text_[position_];
+    const auto end = text_.find(quote, position_ + 1);
+    if (end == std::string_view::npos) {
+      return std::nullopt;
+    }
+    const auto value = text_.substr(position_ + 1, end - position_ - 1);
+    position_ = end + 1;
+    return value;
+  }
+
+  std::optional<std::uint64_t> integer() {
+    skip_space();
+    const std::size_t begin = position_;
+    std::uint64_t value = 0;
+    while (position_ < text_.size() && text_[position_] >= '0' && text_[position_] <= '9') {
+      const auto digit = static_cast<std::uint64_t>(text_[position_] - '0');
+      if (value > (std::numeric_limits<std::uint64_t>::max() - digit) / 10) {
+        return std::nullopt;
+      }
+      value = value * 10 + digit;
+      ++position_;
+    }
+    // Python 2 era headers may write long literals as "3L".
+    if (position_ < text_.size() && text_[position_] == 'L') {
+      ++position_;
+    }
+    if (position_ == begin) {
+      return std::nullopt;
+    }
+    return value;
+  }
+
+ private:
+  std::string_view text_;
+  std::size_t position_ = 0;
+};
+
+bool host_is_little_endian() {
+#if defined(__BYTE_ORDER__)
+  return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+#else
+  return true;
+#endif
+}
+
+std::optional<NpyDtype> parse_descr(std::string_view descr) {
+  char byte_order = '|';
+  if (!descr.empty() &&
+      (descr[0] == '<' || descr[0] == '>' || descr[0] == '|' || descr[0] == '=')) {
+    byte_order = descr[0];
+    descr.remove_prefix(1);
+  }
+  if (descr == "u1") {
+    return NpyDtype::kUint8;
+  }
+  // Multi-byte elements are read in place, so they must match the host.
+  const bool little_endian =
+      byte_order == '<' || (byte_order == '=' && host_is_little_endian());
+  if (!little_endian || !host_is_little_endian()) {
+    return std::nullopt;
+  }
+  if (descr == "f4") {
+    return NpyDtype::kFloat32;
+  }
+  if (descr == "f8") {
+    return NpyDtype::kFloat64;
+  }
+  return std::nullopt;
+}
+
+bool parse_shape(DictScanner* scanner, NpyHeader* header) {
+  if (!scanner->accept('(')) {
+    return false;
+  }
+  header->rank = 0;
+  while (!scanner->accept(')')) {
+    const auto dimension = scanner->integer();
+    if (!dimension.has_value() || header->rank == NpyHeader::kMaxRank) {
+      return false;
+    }
+    header->shape[header->rank++] = dimension.value();
+    // A one-element tuple keeps its trailing comma; others may too.
+    if (!scanner->accept(',')) {
+      if (!scanner->accept(')')) {
+        return false;
+      }
+      break;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+std::size_t npy_dtype_size(const NpyDtype dtype) {
+  switch (dtype) {
+    case NpyDtype::kUint8:
+      return 1;
+    case NpyDtype::kFloat32:
+      return 4;
+    case NpyDtype::kFloat64:
+      return 8;
+  }
+  return 1;
+}
+
+const char* npy_dtype_name(const NpyDtype dtype) {
+  switch (dtype) {
+    case NpyDtype::kUint8:
+      return "u1";
+    case NpyDtype::kFloat32:
+      return "f4";
+    case NpyDtype::kFloat64:
+      return "f8";
+  }
+  return "u1";
+}
+
+std::uint64_t NpyHeader::element_count() const {
+  std::uint64_t count = 1;
+  for (const auto dimension : dims()) {
+    count *= dimension;
+  }
+  return count;
+}
+
+std::optional<std::size_t> npy_header_size(const std::span<const std::uint8_t> prefix) {
+  if (prefix.size() < 10 || !std::equal(kNpyMagic.begin(), kNpyMagic.end(), prefix.begin())) {
+    return std::nullopt;
+  }
+  const std::uint8_t major_version = prefix[6];
+  if (major_version == 1) {
+    return 10 + (static_cast<std::size_t>(prefix[8]) | (static_cast<std::size_t>(prefix[9]) << 8U));
+  }
+  // Version 3 differs from 2 only in allowing UTF-8 in the dict.
+  if ((major_version == 2 || major_version == 3) && prefix.size() >= 12) {
+    return 12 + (static_cast<std::size_t>(prefix[8]) |
+                 (static_cast<std::size_t>(prefix[9]) << 8U) |
+                 (static_cast<std::size_t>(prefix[10]) << 16U) |
+                 (static_cast<std::size_t>(prefix[11]) << 24U));
+  }
+  return std::nullopt;
+}
+
+std::optional<NpyHeader> parse_npy_header(const std::span<const std::uint8_t> npy_bytes) {
+  const auto header_size = npy_header_size(npy_bytes);
+  if (!header_size.has_value() || header_size.value() > npy_bytes.size()) {
+    return std::nullopt;
+  }
+  const std::size_t dict_offset = npy_bytes[6] == 1 ? 10 : 12;
+  DictScanner scanner(std::string_view(reinterpret_cast<const char*>(npy_bytes.data()) +
+                                           dict_offset,
+                                       header_size.value() - dict_offset));
+
+  NpyHeader header;
+  header.data_offset = header_size.value();
+  bool has_descr = false;
+  bool has_order = false;
+  bool has_shape = false;
+  if (!scanner.accept('{')) {
+    return std::nullopt;
+  }
+  while (!scanner.accept('}')) {
+    const auto key = scanner.quoted();
+    if (!key.has_value() || !scanner.accept(':')) {
+      return std::nullopt;
+    }
+    if (key.value() == "descr") {
+      const auto descr = scanner.quoted();
+      const auto dtype = descr.has_value() ? parse_descr(descr.value()) : std::nullopt;
+      if (!dtype.has_value()) {
+        return std::nullopt;
+      }
+      header.dtype = dtype.value();
+      has_descr = true;
+    } else if (key.value() == "fortran_order") {
+      if (scanner.accept_word("True")) {
+        header.fortran_order = true;
+      } else if (!scanner.accept_word("False")) {
+        return std::nullopt;
+      }
+      has_order = true;
+    } else if (key.value() == "shape") {
+      if (!parse_shape(&scanner, &header)) {
+        return std::nullopt;
+      }
+      has_shape = true;
+    } else {
+      return std::nullopt;
+    }
+    if (!scanner.accept(',')) {
+      if (!scanner.accept('}')) {
+        return std::nullopt;
+      }
+      break;
+    }
+  }
+  if (!has_descr || !has_order || !has_shape) {
+    return std::nullopt;
+  }
+
+  // The data size has to be representable for the bounds checks callers do.
+  std::uint64_t limit = std::numeric_limits<std::uint64_t>::max() / npy_dtype_size(header.dtype);
+  for (const auto dimension : header.dims()) {
+    if (dimension != 0 && dimension > limit) {
+      return std::nullopt;
+    }
+    limit = dimension == 0 ? limit : limit / dimension;
+  }
+  return header;
+}
+
+}  // namespace manim_cpp::testing
@@ -1,38 +1,58 @@
 #include "manim_cpp/testing/npz_archive.hpp"
 
-#include <fstream>
-#include <iterator>
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
 #include <limits>
-#include <unordered_set>
 #include <utility>
 
+#include "manim_cpp/testing/crc32.hpp"
+
 namespace manim_cpp::testing {
 namespace {
 
 constexpr std::uint32_t kEndOfCentralDirectorySignature = 0x06054B50;
+constexpr std::uint32_t kZip64EndOfCentralDirectorySignature = 0x06064B50;
+constexpr std::uint32_t kZip64EndOfCentralDirectoryLocatorSignature = 0x07064B50;
 constexpr std::uint32_t kCentralDirectoryHeaderSignature = 0x02014B50;
 constexpr std::uint32_t kLocalFileHeaderSignature = 0x04034B50;
+constexpr std::uint16_t kZip64ExtraFieldId = 0x0001;
 constexpr std::size_t kEndOfCentralDirectoryMinSize = 22;
+constexpr std::size_t kZip64EndOfCentralDirectorySize = 56;
+constexpr std::size_t kZip64EndOfCentralDirectoryLocatorSize = 20;
 constexpr std::size_t kCentralDirectoryHeaderSize = 46;
+constexpr std::size_t kLocalFileHeaderSize = 30;
 constexpr std::size_t kMaxZipCommentSize = 65535;
-
-std::optional<std::vector<std::uint8_t>> read_bytes(
-    const std::filesystem::path& path) {
-  std::ifstream input(path, std::ios::binary);
-  if (!input.is_open()) {
-    return std::nullopt;
-  }
-  return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(input),
-                                   std::istreambuf_iterator<char>());
-}
-
-std::uint16_t read_u16(const std::vector<std::uint8_t>& bytes,
+// Classic fields holding these values defer to the Zip64 records.
+constexpr std::uint32_t kZip64SizeMarker = 0xFFFFFFFF;
+constexpr std::uint16_t kZip64CountMarker = 0xFFFF;
+constexpr std::uint16_t kCompressionStore = 0;
+constexpr std::uint16_t kCompressionDeflate = 8;
+constexpr std::uint16_t kVersionDefault = 20;
+constexpr std::uint16_t kVersionZip64 = 45;
+// Magic, version and header length plus a dict with room for 20-digit
+// dimensions, so the frame count can be patched without moving the data.
+constexpr std::size_t kFrameArrayHeaderSize = 192;
+constexpr std::size_t kDeflateWindowBytes = 32 * 1024;
+// A non-final stored block holding the deflated frame array's npy header,
+// so the header stays patchable: BFINAL 0 and BTYPE 00, then LEN and NLEN.
+constexpr std::array<std::uint8_t, 5> kStoredHeaderBlock = {
+    0x00, kFrameArrayHeaderSize & 0xFFU, kFrameArrayHeaderSize >> 8U,
+    static_cast<std::uint8_t>(~kFrameArrayHeaderSize & 0xFFU),
+    static_cast<std::uint8_t>((~kFrameArrayHeaderSize >> 8U) & 0xFFU)};
+// An empty final fixed-Huffman block, ending a stream of sync-flushed chunks.
+constexpr std::array<std::uint8_t, 2> kFinalDeflateBlock = {0x03, 0x00};
+// zlib counts in uInt, so oversized spans are fed through in pieces.
+constexpr std::size_t kMaxZlibSpan = std::size_t{1} << 30U;
+
+std::uint16_t read_u16(const std::span<const std::uint8_t> bytes,
                        const std::size_t offset) {
   return static_cast<std::uint16_t>(bytes[offset]) |
          (static_cast<std::uint16_t>(bytes[offset + 1]) << 8U);
 }
 
-std::uint32_t read_u32(const std::vector<std::uint8_t>& bytes,
+std::uint32_t read_u32(const std::span<const std::uint8_t> bytes,
                        const std::size_t offset) {
   return static_cast<std::uint32_t>(bytes[offset]) |
          (static_cast<std::uint32_t>(bytes[offset + 1]) << 8U) |
@@ -40,6 +60,12 @@ std::uint32_t read_u32(const std::vector<std::uint8_t>& bytes,
          (static_cast<std::uint32_t>(bytes[offset + 3]) << 24U);
 }
 
+std::uint64_t read_u64(const std::span<const std::uint8_t> bytes,
+                       const std::size_t offset) {
+  return static_cast<std::uint64_t>(read_u32(bytes, offset)) |
+         (static_cast<std::uint64_t>(read_u32(bytes, offset + 4)) << 32U);
+}
+
 void write_u16(std::ofstream* output, const std::uint16_t value) {
   output->put(static_cast<char>(value & 0xFFU));
   output->put(static_cast<char>((value >> 8U) & 0xFFU));
@@ -52,23 +78,20 @@ void write_u32(std::ofstream* output, const std::uint32_t value) {
   output->put(static_cast<char>((value >> 24U) & 0xFFU));
 }
 
-std::uint32_t crc32(const std::vector<std::uint8_t>& bytes) {
-  std::uint32_t crc = 0xFFFFFFFFU;
-  for (const auto byte : bytes) {
-    crc ^= static_cast<std::uint32_t>(byte);
-    for (int bit = 0; bit < 8; ++bit) {
-      if ((crc & 1U) != 0U) {
-        crc = (crc >> 1U) ^ 0xEDB88320U;
-      } else {
-        crc >>= 1U;
-      }
-    }
+void write_u64(std::ofstream* output, const std::uint64_t value) {
+  write_u32(output, static_cast<std::uint32_t>(value & 0xFFFFFFFFU));
+  write_u32(output, static_cast<std::uint32_t>(value >> 32U));
+}
+
+void write_bytes(std::ofstream* output, const std::span<const std::uint8_t> bytes) {
+  if (!bytes.empty()) {
+    output->write(reinterpret_cast<const char*>(bytes.data()),
+                  static_cast<std::streamsize>(bytes.size()));
   }
-  return ~crc;
 }
 
 std::optional<std::size_t> find_end_of_central_directory(
-    const std::vector<std::uint8_t>& bytes) {
+    const std::span<const std::uint8_t> bytes) {
   if (bytes.size() < kEndOfCentralDirectoryMinSize) {
     return std::nullopt;
   }
@@ -89,16 +112,42 @@ std::optional<std::size_t> find_end_of_central_directory(
   return std::nullopt;
 }
 
-}  // namespace
-
-std::optional<std::vector<NpzEntry>> read_npz_central_directory(
-    const std::filesystem::path& npz_path) {
-  const auto bytes_opt = read_bytes(npz_path);
-  if (!bytes_opt.has_value()) {
-    return std::nullopt;
+// Replaces the saturated fields of `entry` with their values from the Zip64
+// extended information extra field, which lists only those, in this order.
+bool apply_zip64_extra_field(const std::span<const std::uint8_t> extra,
+                             const bool size_saturated,
+                             const bool compressed_saturated,
+                             const bool offset_saturated,
+                             NpzEntry* entry) {
+  std::size_t cursor = 0;
+  while (cursor + 4 <= extra.size()) {
+    const std::uint16_t id = read_u16(extra, cursor);
+    const std::uint16_t length = read_u16(extra, cursor + 2);
+    if (cursor + 4 + length > extra.size()) {
+      return false;
+    }
+    if (id == kZip64ExtraFieldId) {
+      std::size_t field = cursor + 4;
+      const std::size_t end = field + length;
+      const auto next = [&](std::uint64_t* value) {
+        if (field + 8 > end) {
+          return false;
+        }
+        *value = read_u64(extra, field);
+        field += 8;
+        return true;
+      };
+      return (!size_saturated || next(&entry->uncompressed_size)) &&
+             (!compressed_saturated || next(&entry->compressed_size)) &&
+             (!offset_saturated || next(&entry->local_header_offset));
+    }
+    cursor += 4 + length;
   }
+  return false;
+}
 
-  const auto& bytes = bytes_opt.value();
+std::optional<std::vector<NpzEntry>> parse_central_directory(
+    const std::span<const std::uint8_t> bytes) {
   const auto eocd_offset_opt = find_end_of_central_directory(bytes);
   if (!eocd_offset_opt.has_value()) {
     return std::nullopt;
@@ -109,21 +158,43 @@ std::optional<std::vector<NpzEntry>> read_npz_central_directory(
     return std::nullopt;
   }
 
-  const std::uint16_t total_entries = read_u16(bytes, eocd_offset + 10);
-  const std::uint32_t central_dir_size = read_u32(bytes, eocd_offset + 12);
-  const std::uint32_t central_dir_offset = read_u32(bytes, eocd_offset + 16);
+  std::uint64_t total_entries = read_u16(bytes, eocd_offset + 10);
+  std::uint64_t central_dir_size = read_u32(bytes, eocd_offset + 12);
+  std::uint64_t central_dir_offset = read_u32(bytes, eocd_offset + 16);
+
+  if (total_entries == kZip64CountMarker || central_dir_size == kZip64SizeMarker ||
+      central_dir_offset == kZip64SizeMarker) {
+    // The Zip64 locator sits right before the classic record and points at
+    // the Zip64 end of central directory record.
+    if (eocd_offset < kZip64EndOfCentralDirectoryLocatorSize) {
+      return std::nullopt;
+    }
+    const std::size_t locator = eocd_offset - kZip64EndOfCentralDirectoryLocatorSize;
+    if (read_u32(bytes, locator) != kZip64EndOfCentralDirectoryLocatorSignature) {
+      return std::nullopt;
+    }
+    const std::uint64_t record = read_u64(bytes, locator + 8);
+    if (record > locator || locator - record < kZip64EndOfCentralDirectorySize ||
+        read_u32(bytes, static_cast<std::size_t>(record)) !=
+            kZip64EndOfCentralDirectorySignature) {
+      return std::nullopt;
+    }
+    total_entries = read_u64(bytes, static_cast<std::size_t>(record + 32));
+    central_dir_size = read_u64(bytes, static_cast<std::size_t>(record + 40));
+    central_dir_offset = read_u64(bytes, static_cast<std::size_t>(record + 48));
+  }
 
-  if (static_cast<std::uint64_t>(central_dir_offset) +
-          static_cast<std::uint64_t>(central_dir_size) >
-      bytes.size()) {
+  if (central_dir_offset > bytes.size() ||
+      central_dir_size > bytes.size() - central_dir_offset) {
     return std::nullopt;
   }
 
   std::vector<NpzEntry> entries;
-  entries.reserve(total_entries);
+  entries.reserve(static_cast<std::size_t>(
+      std::min<std::uint64_t>(total_entries, central_dir_size / kCentralDirectoryHeaderSize)));
 
-  std::size_t cursor = central_dir_offset;
-  for (std::uint16_t i = 0; i < total_entries; ++i) {
+  std::size_t cursor = static_cast<std::size_t>(central_dir_offset);
+  for (std::uint64_t i = 0; i < total_entries; ++i) {
     if (cursor + kCentralDirectoryHeaderSize > bytes.size()) {
       return std::nullopt;
     }
@@ -137,6 +208,7 @@ std::optional<std::vector<NpzEntry>> read_npz_central_directory(
     const std::uint16_t file_name_length = read_u16(bytes, cursor + 28);
     const std::uint16_t extra_field_length = read_u16(bytes, cursor + 30);
     const std::uint16_t file_comment_length = read_u16(bytes, cursor + 32);
+    const std::uint32_t local_header_offset = read_u32(bytes, cursor + 42);
 
     const std::size_t name_offset = cursor + kCentralDirectoryHeaderSize;
     const std::size_t next_cursor =
@@ -146,12 +218,22 @@ std::optional<std::vector<NpzEntry>> read_npz_central_directory(
     }
 
     NpzEntry entry;
-    entry.name = std::string(bytes.begin() + static_cast<std::ptrdiff_t>(name_offset),
-                             bytes.begin() +
-                                 static_cast<std::ptrdiff_t>(name_offset + file_name_length));
+    entry.name = std::string(reinterpret_cast<const char*>(bytes.data() + name_offset),
+                             file_name_length);
     entry.compression_method = compression_method;
+    entry.crc32 = read_u32(bytes, cursor + 16);
     entry.compressed_size = compressed_size;
     entry.uncompressed_size = uncompressed_size;
+    entry.local_header_offset = local_header_offset;
+    const bool size_saturated = uncompressed_size == kZip64SizeMarker;
+    const bool compressed_saturated = compressed_size == kZip64SizeMarker;
+    const bool offset_saturated = local_header_offset == kZip64SizeMarker;
+    if ((size_saturated || compressed_saturated || offset_saturated) &&
+        !apply_zip64_extra_field(bytes.subspan(name_offset + file_name_length, extra_field_length),
+                                 size_saturated, compressed_saturated, offset_saturated,
+                                 &entry)) {
+      return std::nullopt;
+    }
     entries.push_back(std::move(entry));
 
     cursor = next_cursor;
@@ -160,6 +242,668 @@ std::optional<std::vector<NpzEntry>> read_npz_central_directory(
   return entries;
 }
 
+std::string frame_array_header(const std::uint64_t frames,
+                               const std::size_t height,
+                               const std::size_t width,
+                               const std::size_t channels) {
+  std::string dict = "{'descr': '|u1', 'fortran_order': False, 'shape': (" +
+                     std::to_string(frames) + ", " + std::to_string(height) + ", " +
+                     std::to_string(width) + ", " + std::to_string(channels) + "), }";
+  const std::size_t dict_size = kFrameArrayHeaderSize - 10;
+  dict.resize(dict_size - 1, ' ');
+  dict.push_back('\n');
+  std::string header = "\x93NUMPY";
+  header.push_back('\x01');
+  header.push_back('\x00');
+  header.push_back(static_cast<char>(dict_size & 0xFFU));
+  header.push_back(static_cast<char>((dict_size >> 8U) & 0xFFU));
+  return header + dict;
+}
+
+std::span<const std::uint8_t> as_bytes(const std::string& text) {
+  return {reinterpret_cast<const std::uint8_t*>(text.data()), text.size()};
+}
+
+}  // namespace
+
+std::optional<std::vector<NpzEntry>> read_npz_central_directory(
+    const std::filesystem::path& npz_path) {
+  MappedFile file;
+  if (!file.open(npz_path)) {
+    return std::nullopt;
+  }
+  return parse_central_directory(file.bytes());
+}
+
+bool NpzArchive::open(const std::filesystem::path& npz_path) {
+  entries_.clear();
+  error_.clear();
+  if (!file_.open(npz_path)) {
+    error_ = file_.error();
+    return false;
+  }
+  auto entries = parse_central_directory(file_.bytes());
+  if (!entries.has_value()) {
+    file_.close();
+    error_ = "Invalid zip central directory: " + npz_path.string();
+    return false;
+  }
+  entries_ = std::move(entries.value());
+  return true;
+}
+
+const NpzEntry* NpzArchive::find_entry(const std::string_view name) const {
+  for (const auto& entry : entries_) {
+    if (entry.name == name) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+std::optional<std::span<const std::uint8_t>> NpzArchive::stored_entry_bytes(
+    const NpzEntry& entry) const {
+  if (entry.compression_method != kCompressionStore ||
+      entry.compressed_size != entry.uncompressed_size) {
+    return std::nullopt;
+  }
+  return entry_data(entry);
+}
+
+std::optional<std::span<const std::uint8_t>> NpzArchive::entry_data(const NpzEntry& entry) const {
+  const auto bytes = file_.bytes();
+  const std::uint64_t header = entry.local_header_offset;
+  if (header > bytes.size() || bytes.size() - header < kLocalFileHeaderSize ||
+      read_u32(bytes, static_cast<std::size_t>(header)) != kLocalFileHeaderSignature) {
+    return std::nullopt;
+  }
+  // The local name and extra field lengths may differ from the central
+  // directory's copy, so the data offset comes from the local header.
+  const std::uint64_t data_offset =
+      header + kLocalFileHeaderSize + read_u16(bytes, static_cast<std::size_t>(header + 26)) +
+      read_u16(bytes, static_cast<std::size_t>(header + 28));
+  if (data_offset > bytes.size() || entry.compressed_size > bytes.size() - data_offset) {
+    return std::nullopt;
+  }
+  return bytes.subspan(static_cast<std::size_t>(data_offset),
+                       static_cast<std::size_t>(entry.compressed_size));
+}
+
+struct NpzEntryReader::Inflater {
+  z_stream stream{};
+  bool initialized = false;
+
+  ~Inflater() {
+    if (initialized) {
+      inflateEnd(&stream);
+    }
+  }
+};
+
+NpzEntryReader::NpzEntryReader() = default;
+NpzEntryReader::~NpzEntryReader() = default;
+
+bool NpzEntryReader::open(const NpzArchive& archive, const NpzEntry& entry) {
+  inflater_.reset();
+  data_ = {};
+  data_position_ = 0;
+  position_ = 0;
+  size_ = 0;
+  crc32_ = 0;
+  error_.clear();
+  if (entry.compression_method != kCompressionStore &&
+      entry.compression_method != kCompressionDeflate) {
+    error_ = "Unsupported npz compression method " + std::to_string(entry.compression_method) +
+             ": " + entry.name;
+    return false;
+  }
+  if (entry.compression_method == kCompressionStore &&
+      entry.compressed_size != entry.uncompressed_size) {
+    error_ = "Stored npz entry sizes disagree: " + entry.name;
+    return false;
+  }
+  const auto data = archive.entry_data(entry);
+  if (!data.has_value()) {
+    error_ = "Invalid npz local header: " + entry.name;
+    return false;
+  }
+  data_ = data.value();
+  deflated_ = entry.compression_method == kCompressionDeflate;
+  size_ = entry.uncompressed_size;
+  expected_crc32_ = entry.crc32;
+  if (deflated_) {
+    inflater_ = std::make_unique<Inflater>();
+    if (inflateInit2(&inflater_->stream, -MAX_WBITS) != Z_OK) {
+      inflater_.reset();
+      error_ = "Failed to initialize inflate: " + entry.name;
+      return false;
+    }
+    inflater_->initialized = true;
+  }
+  return true;
+}
+
+std::size_t NpzEntryReader::read(const std::span<std::uint8_t> output) {
+  if (!error_.empty()) {
+    return 0;
+  }
+  const auto wanted = static_cast<std::size_t>(
+      std::min<std::uint64_t>(output.size(), remaining()));
+  std::size_t produced = 0;
+  if (!deflated_) {
+    std::copy_n(data_.begin() + static_cast<std::ptrdiff_t>(data_position_), wanted,
+                output.begin());
+    data_position_ += wanted;
+    produced = wanted;
+  } else {
+    z_stream& stream = inflater_->stream;
+    while (produced < wanted) {
+      const std::size_t input_size = std::min(data_.size() - data_position_, kMaxZlibSpan);
+      const std::size_t output_size = std::min(wanted - produced, kMaxZlibSpan);
+      stream.next_in = const_cast<Bytef*>(data_.data() + data_position_);
+      stream.avail_in = static_cast<uInt>(input_size);
+      stream.next_out = output.data() + produced;
+      stream.avail_out = static_cast<uInt>(output_size);
+      const int result = inflate(&stream, Z_NO_FLUSH);
+      data_position_ += input_size - stream.avail_in;
+      produced += output_size - stream.avail_out;
+      if (result == Z_STREAM_END) {
+        break;
+      }
+      if (result != Z_OK) {
+        error_ = "Corrupt deflate data in npz entry";
+        return 0;
+      }
+    }
+    if (produced < wanted) {
+      error_ = "Deflate data ends before the npz entry size";
+      return 0;
+    }
+  }
+  if (!finish_chunk(output.first(produced))) {
+    return 0;
+  }
+  return produced;
+}
+
+bool NpzEntryReader::skip(std::uint64_t size) {
+  if (size > remaining()) {
+    error_ = "Skip past the end of an npz entry";
+    return false;
+  }
+  if (!deflated_) {
+    // Stored bytes need no decoding, but the CRC still covers them.
+    const auto skipped = data_.subspan(data_position_, static_cast<std::size_t>(size));
+    data_position_ += skipped.size();
+    return finish_chunk(skipped);
+  }
+  std::array<std::uint8_t, 64 * 1024> scratch{};
+  while (size > 0) {
+    const auto chunk = static_cast<std::size_t>(std::min<std::uint64_t>(size, scratch.size()));
+    if (read(std::span(scratch).first(chunk)) != chunk) {
+      return false;
+    }
+    size -= chunk;
+  }
+  return true;
+}
+
+bool NpzEntryReader::finish_chunk(const std::span<const std::uint8_t> bytes) {
+  crc32_ = crc32_update(crc32_, bytes);
+  position_ += bytes.size();
+  if (position_ == size_ && crc32_ != expected_crc32_) {
+    error_ = "CRC mismatch in npz entry";
+    return false;
+  }
+  return true;
+}
+
+NpzWriter::~NpzWriter() {
+  if (is_open()) {
+    close();
+  }
+}
+
+bool NpzWriter::open(const std::filesystem::path& npz_path, const NpzWriterSettings settings) {
+  if (is_open()) {
+    close();
+  }
+  entries_.clear();
+  names_.clear();
+  frame_array_.reset();
+  frame_count_ = 0;
+  error_.clear();
+  path_ = npz_path;
+  settings_ = settings;
+  settings_.compression_level = std::clamp(settings_.compression_level, 0, 9);
+  settings_.chunk_bytes = std::clamp<std::size_t>(settings_.chunk_bytes, 64 * 1024, kMaxZlibSpan);
+  if (settings_.worker_count == 0) {
+    settings_.worker_count = renderer::default_worker_count();
+  }
+  if (pool_ != nullptr && pool_->worker_count() != settings_.worker_count) {
+    pool_.reset();
+  }
+  if (npz_path.has_parent_path()) {
+    std::error_code error;
+    std::filesystem::create_directories(npz_path.parent_path(), error);
+  }
+  output_.open(npz_path, std::ios::binary | std::ios::trunc);
+  if (!output_.is_open()) {
+    return fail("Failed to open npz archive for writing: " + npz_path.string());
+  }
+  return true;
+}
+
+bool NpzWriter::fail(std::string message) {
+  if (error_.empty()) {
+    error_ = std::move(message);
+  }
+  return false;
+}
+
+bool NpzWriter::start_entry(const WrittenEntry& entry, const bool streamed) {
+  if (!is_open()) {
+    return fail("npz archive is not open");
+  }
+  if (!error_.empty()) {
+    return false;
+  }
+  if (!finish_frame_array()) {
+    return false;
+  }
+  const std::string& name = entry.name;
+  if (name.empty() || name.size() > std::numeric_limits<std::uint16_t>::max()) {
+    return fail("Invalid npz entry name: " + name);
+  }
+  if (!names_.insert(name).second) {
+    return fail("Duplicate npz entry name: " + name);
+  }
+
+  const auto local_header_offset = static_cast<std::uint64_t>(output_.tellp());
+  // A streamed entry's final size is unknown, so it always reserves the
+  // Zip64 sizes; they are patched by finish_frame_array().
+  const bool zip64 = streamed || settings_.force_zip64 ||
+                     entry.uncompressed_size >= kZip64SizeMarker ||
+                     entry.compressed_size >= kZip64SizeMarker;
+  write_u32(&output_, kLocalFileHeaderSignature);
+  write_u16(&output_, zip64 ? kVersionZip64 : kVersionDefault);  // version needed to extract
+  write_u16(&output_, 0);  // general purpose bit flag
+  write_u16(&output_, entry.compression_method);
+  write_u16(&output_, 0);  // last mod file time
+  write_u16(&output_, 0);  // last mod file date
+  write_u32(&output_, entry.crc32);
+  write_u32(&output_, zip64 ? kZip64SizeMarker : static_cast<std::uint32_t>(entry.compressed_size));
+  write_u32(&output_,
+            zip64 ? kZip64SizeMarker : static_cast<std::uint32_t>(entry.uncompressed_size));
+  write_u16(&output_, static_cast<std::uint16_t>(name.size()));
+  write_u16(&output_, zip64 ? 20 : 0);  // extra field length
+  output_.write(name.data(), static_cast<std::streamsize>(name.size()));
+  if (zip64) {
+    write_u16(&output_, kZip64ExtraFieldId);
+    write_u16(&output_, 16);
+    write_u64(&output_, entry.uncompressed_size);
+    write_u64(&output_, entry.compressed_size);
+  }
+  if (!output_.good()) {
+    return fail("Failed to write npz entry header: " + name);
+  }
+
+  entries_.push_back(entry);
+  entries_.back().local_header_offset = local_header_offset;
+  return true;
+}
+
+bool NpzWriter::deflate_chunks(const std::span<const std::uint8_t> input, std::uint32_t* crc32) {
+  const std::size_t chunk_bytes = settings_.chunk_bytes;
+  const std::size_t chunk_count = (input.size() + chunk_bytes - 1) / chunk_bytes;
+  chunks_.resize(chunk_count);
+  const auto compress = [&](const std::size_t index) {
+    auto& chunk = chunks_[index];
+    chunk.ok = false;
+    const std::size_t begin = index * chunk_bytes;
+    const auto piece = input.subspan(begin, std::min(chunk_bytes, input.size() - begin));
+    chunk.crc32 = crc32_update(0, piece);
+
+    z_stream stream{};
+    if (deflateInit2(&stream, settings_.compression_level, Z_DEFLATED, -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      return;
+    }
+    // Priming with the preceding window keeps matches across chunk seams.
+    const std::span<const std::uint8_t> dictionary =
+        begin == 0 ? std::span<const std::uint8_t>(window_)
+                   : input.subspan(begin - std::min(begin, kDeflateWindowBytes),
+                                   std::min(begin, kDeflateWindowBytes));
+    if (!dictionary.empty()) {
+      deflateSetDictionary(&stream, dictionary.data(), static_cast<uInt>(dictionary.size()));
+    }
+    // A sync flush appends at most an empty stored block beyond the bound.
+    chunk.output.resize(deflateBound(&stream, static_cast<uLong>(piece.size())) + 16);
+    stream.next_in = const_cast<Bytef*>(piece.data());
+    stream.avail_in = static_cast<uInt>(piece.size());
+    stream.next_out = chunk.output.data();
+    stream.avail_out = static_cast<uInt>(chunk.output.size());
+    chunk.ok = deflate(&stream, Z_SYNC_FLUSH) == Z_OK && stream.avail_in == 0;
+    chunk.output.resize(stream.total_out);
+    deflateEnd(&stream);
+  };
+  if (settings_.worker_count <= 1 || chunk_count <= 1) {
+    for (std::size_t index = 0; index < chunk_count; ++index) {
+      compress(index);
+    }
+  } else {
+    if (pool_ == nullptr) {
+      pool_ = std::make_unique<renderer::WorkStealingThreadPool>(settings_.worker_count);
+    }
+    pool_->parallel_for(chunk_count, compress);
+  }
+
+  std::uint32_t crc = 0;
+  for (std::size_t index = 0; index < chunk_count; ++index) {
+    if (!chunks_[index].ok) {
+      return fail("Failed to deflate npz entry data: " + path_.string());
+    }
+    const std::size_t begin = index * chunk_bytes;
+    crc = crc32_combine(crc, chunks_[index].crc32, std::min(chunk_bytes, input.size() - begin));
+  }
+  *crc32 = crc;
+
+  if (input.size() >= kDeflateWindowBytes) {
+    window_.assign(input.end() - static_cast<std::ptrdiff_t>(kDeflateWindowBytes), input.end());
+  } else {
+    window_.insert(window_.end(), input.begin(), input.end());
+    if (window_.size() > kDeflateWindowBytes) {
+      window_.erase(window_.begin(),
+                    window_.end() - static_cast<std::ptrdiff_t>(kDeflateWindowBytes));
+    }
+  }
+  return true;
+}
+
+bool NpzWriter::write_chunks(std::uint64_t* written) {
+  for (const auto& chunk : chunks_) {
+    write_bytes(&output_, chunk.output);
+    *written += chunk.output.size();
+  }
+  chunks_.clear();
+  if (!output_.good()) {
+    return fail("Failed to write npz entry data: " + path_.string());
+  }
+  return true;
+}
+
+bool NpzWriter::add_entry(const std::string& name, const std::span<const std::uint8_t> bytes) {
+  if (settings_.compression_level == 0) {
+    if (!start_entry(WrittenEntry{.name = name,
+                                  .compression_method = kCompressionStore,
+                                  .crc32 = crc32_update(0, bytes),
+                                  .compressed_size = bytes.size(),
+                                  .uncompressed_size = bytes.size()},
+                     false)) {
+      return false;
+    }
+    write_bytes(&output_, bytes);
+    if (!output_.good()) {
+      return fail("Failed to write npz entry: " + name);
+    }
+    return true;
+  }
+
+  // Deflated before the header goes out, which needs the compressed size.
+  if (!is_open()) {
+    return fail("npz archive is not open");
+  }
+  window_.clear();
+  std::uint32_t crc = 0;
+  if (!error_.empty() || !finish_frame_array() || !deflate_chunks(bytes, &crc)) {
+    return false;
+  }
+  std::uint64_t compressed_size = kFinalDeflateBlock.size();
+  for (const auto& chunk : chunks_) {
+    compressed_size += chunk.output.size();
+  }
+  if (!start_entry(WrittenEntry{.name = name,
+                                .compression_method = kCompressionDeflate,
+                                .crc32 = crc,
+                                .compressed_size = compressed_size,
+                                .uncompressed_size = bytes.size()},
+                   false)) {
+    chunks_.clear();
+    return false;
+  }
+  std::uint64_t written = 0;
+  if (!write_chunks(&written)) {
+    return false;
+  }
+  write_bytes(&output_, kFinalDeflateBlock);
+  if (!output_.good()) {
+    return fail("Failed to write npz entry: " + name);
+  }
+  return true;
+}
+
+bool NpzWriter::begin_frame_array(const std::string& name,
+                                  const std::size_t height,
+                                  const std::size_t width,
+                                  const std::size_t channels) {
+  if (height == 0 || width == 0 || channels == 0) {
+    return fail("Invalid frame array shape for npz entry: " + name);
+  }
+  const bool deflated = settings_.compression_level != 0;
+  if (!start_entry(WrittenEntry{.name = name,
+                                .compression_method =
+                                    deflated ? kCompressionDeflate : kCompressionStore},
+                   true)) {
+    return false;
+  }
+  if (deflated) {
+    write_bytes(&output_, kStoredHeaderBlock);
+  }
+  frame_count_ = 0;
+  pending_.clear();
+  window_.clear();
+  frame_array_ = FrameArray{
+      .entry_index = entries_.size() - 1,
+      .header_offset = static_cast<std::uint64_t>(output_.tellp()),
+      .height = height,
+      .width = width,
+      .channels = channels,
+      .compressed_size = deflated ? kStoredHeaderBlock.size() + kFrameArrayHeaderSize : 0,
+  };
+  // Placeholder with a frame count of zero; rewritten on finish.
+  write_bytes(&output_, as_bytes(frame_array_header(0, height, width, channels)));
+  if (!output_.good()) {
+    return fail("Failed to write npy header: " + name);
+  }
+  return true;
+}
+
+bool NpzWriter::append_frame(const std::span<const std::uint8_t> frame) {
+  if (!frame_array_.has_value()) {
+    return fail("append_frame() called without begin_frame_array()");
+  }
+  if (!error_.empty()) {
+    return false;
+  }
+  auto& array = frame_array_.value();
+  if (frame.size() != array.height * array.width * array.channels) {
+    return fail("Frame size does not match the npz frame array shape");
+  }
+  ++frame_count_;
+  if (settings_.compression_level != 0) {
+    // Batched so each deflate pass has a chunk for every worker.
+    pending_.insert(pending_.end(), frame.begin(), frame.end());
+    if (pending_.size() >= settings_.chunk_bytes * settings_.worker_count) {
+      return flush_pending_frames();
+    }
+    return true;
+  }
+  write_bytes(&output_, frame);
+  if (!output_.good()) {
+    return fail("Failed to append frame to npz archive: " + path_.string());
+  }
+  array.data_crc32 = crc32_update(array.data_crc32, frame);
+  array.data_size += frame.size();
+  array.compressed_size += frame.size();
+  return true;
+}
+
+bool NpzWriter::flush_pending_frames() {
+  auto& array = frame_array_.value();
+  std::uint32_t crc = 0;
+  if (!deflate_chunks(pending_, &crc) || !write_chunks(&array.compressed_size)) {
+    return false;
+  }
+  array.data_crc32 = crc32_combine(array.data_crc32, crc, pending_.size());
+  array.data_size += pending_.size();
+  pending_.clear();
+  return true;
+}
+
+bool NpzWriter::finish_frame_array() {
+  if (!frame_array_.has_value()) {
+    return true;
+  }
+  if (entries_[frame_array_->entry_index].compression_method == kCompressionDeflate) {
+    if (!flush_pending_frames()) {
+      frame_array_.reset();
+      return false;
+    }
+    write_bytes(&output_, kFinalDeflateBlock);
+    frame_array_->compressed_size += kFinalDeflateBlock.size();
+  }
+  const FrameArray array = frame_array_.value();
+  frame_array_.reset();
+  auto& entry = entries_[array.entry_index];
+
+  const auto header = frame_array_header(frame_count_, array.height, array.width, array.channels);
+  if (header.size() != kFrameArrayHeaderSize) {
+    return fail("npy header overflow for npz entry: " + entry.name);
+  }
+  entry.uncompressed_size = header.size() + array.data_size;
+  entry.compressed_size = array.compressed_size;
+  if (entry.compression_method == kCompressionStore) {
+    entry.compressed_size += header.size();
+  }
+  entry.crc32 = crc32_combine(crc32_update(0, as_bytes(header)), array.data_crc32,
+                              array.data_size);
+
+  const auto end = output_.tellp();
+  output_.seekp(static_cast<std::streamoff>(array.header_offset));
+  output_.write(header.data(), static_cast<std::streamsize>(header.size()));
+  output_.seekp(static_cast<std::streamoff>(entry.local_header_offset + 14));
+  write_u32(&output_, entry.crc32);
+  // The Zip64 sizes follow the name and the extra field's id and length.
+  output_.seekp(
+      static_cast<std::streamoff>(entry.local_header_offset + kLocalFileHeaderSize +
+                                  entry.name.size() + 4));
+  write_u64(&output_, entry.uncompressed_size);
+  write_u64(&output_, entry.compressed_size);
+  output_.seekp(end);
+  if (!output_.good()) {
+    return fail("Failed to finish npz frame array: " + entry.name);
+  }
+  return true;
+}
+
+bool NpzWriter::close() {
+  if (!is_open()) {
+    return error_.empty();
+  }
+  if (!error_.empty() || !finish_frame_array()) {
+    output_.close();
+    return false;
+  }
+
+  const auto central_directory_offset = static_cast<std::uint64_t>(output_.tellp());
+  for (const auto& entry : entries_) {
+    const bool size_saturated = settings_.force_zip64 ||
+                                entry.uncompressed_size >= kZip64SizeMarker ||
+                                entry.compressed_size >= kZip64SizeMarker;
+    const bool offset_saturated =
+        settings_.force_zip64 || entry.local_header_offset >= kZip64SizeMarker;
+    const std::uint16_t extra_length =
+        static_cast<std::uint16_t>((size_saturated ? 16 : 0) + (offset_saturated ? 8 : 0));
+    const std::uint16_t version =
+        extra_length != 0 ? kVersionZip64 : kVersionDefault;
+    write_u32(&output_, kCentralDirectoryHeaderSignature);
+    write_u16(&output_, version);  // version made by
+    write_u16(&output_, version);  // version needed to extract
+    write_u16(&output_, 0);   // general purpose bit flag
+    write_u16(&output_, entry.compression_method);
+    write_u16(&output_, 0);   // last mod file time
+    write_u16(&output_, 0);   // last mod file date
+    write_u32(&output_, entry.crc32);
+    write_u32(&output_, size_saturated ? kZip64SizeMarker
+                                       : static_cast<std::uint32_t>(entry.compressed_size));
+    write_u32(&output_, size_saturated ? kZip64SizeMarker
+                                       : static_cast<std::uint32_t>(entry.uncompressed_size));
+    write_u16(&output_, static_cast<std::uint16_t>(entry.name.size()));
+    write_u16(&output_, extra_length == 0 ? 0 : static_cast<std::uint16_t>(extra_length + 4));
+    write_u16(&output_, 0);  // file comment length
+    write_u16(&output_, 0);  // disk number start
+    write_u16(&output_, 0);  // internal file attributes
+    write_u32(&output_, 0);  // external file attributes
+    write_u32(&output_, offset_saturated ? kZip64SizeMarker
+                                         : static_cast<std::uint32_t>(entry.local_header_offset));
+    output_.write(entry.name.data(), static_cast<std::streamsize>(entry.name.size()));
+    if (extra_length != 0) {
+      write_u16(&output_, kZip64ExtraFieldId);
+      write_u16(&output_, extra_length);
+      if (size_saturated) {
+        write_u64(&output_, entry.uncompressed_size);
+        write_u64(&output_, entry.compressed_size);
+      }
+      if (offset_saturated) {
+        write_u64(&output_, entry.local_header_offset);
+      }
+    }
+  }
+
+  const auto zip64_record_offset = static_cast<std::uint64_t>(output_.tellp());
+  const std::uint64_t central_directory_size = zip64_record_offset - central_directory_offset;
+  const std::uint64_t entry_count = entries_.size();
+  const bool zip64 = settings_.force_zip64 || entry_count >= kZip64CountMarker ||
+                     central_directory_size >= kZip64SizeMarker ||
+                     central_directory_offset >= kZip64SizeMarker;
+  if (zip64) {
+    write_u32(&output_, kZip64EndOfCentralDirectorySignature);
+    write_u64(&output_, kZip64EndOfCentralDirectorySize - 12);  // size of remaining record
+    write_u16(&output_, kVersionZip64);  // version made by
+    write_u16(&output_, kVersionZip64);  // version needed to extract
+    write_u32(&output_, 0);  // number of this disk
+    write_u32(&output_, 0);  // disk where central directory starts
+    write_u64(&output_, entry_count);
+    write_u64(&output_, entry_count);
+    write_u64(&output_, central_directory_size);
+    write_u64(&output_, central_directory_offset);
+
+    write_u32(&output_, kZip64EndOfCentralDirectoryLocatorSignature);
+    write_u32(&output_, 0);  // disk with the Zip64 record
+    write_u64(&output_, zip64_record_offset);
+    write_u32(&output_, 1);  // total number of disks
+  }
+
+  const auto classic_count =
+      zip64 ? kZip64CountMarker : static_cast<std::uint16_t>(entry_count);
+  write_u32(&output_, kEndOfCentralDirectorySignature);
+  write_u16(&output_, 0);  // number of this disk
+  write_u16(&output_, 0);  // disk where central directory starts
+  write_u16(&output_, classic_count);
+  write_u16(&output_, classic_count);
+  write_u32(&output_, zip64 ? kZip64SizeMarker : static_cast<std::uint32_t>(central_directory_size));
+  write_u32(&output_,
+            zip64 ? kZip64SizeMarker : static_cast<std::uint32_t>(central_directory_offset));
+  write_u16(&output_, 0);  // .ZIP file comment length
+
+  const bool ok = output_.good();
+  output_.close();
+  if (!ok) {
+    return fail("Failed to write npz central directory: " + path_.string());
+  }
+  return true;
+}
+
 bool has_npy_entry(const std::vector<NpzEntry>& entries) {
   for (const auto& entry : entries) {
     if (entry.name.ends_with(".npy")) {
@@ -171,118 +915,38 @@ bool has_npy_entry(const std::vector<NpzEntry>& entries) {
 
 bool write_npz_store_archive(const std::filesystem::path& npz_path,
                              const std::vector<NpzWriteEntry>& entries) {
+  return write_npz_archive(npz_path, entries, {});
+}
+
+bool write_npz_archive(const std::filesystem::path& npz_path,
+                       const std::vector<NpzWriteEntry>& entries,
+                       const NpzWriterSettings& settings) {
   if (entries.empty()) {
     return false;
   }
 
+  // Validated up front so an invalid list leaves no file behind.
   std::unordered_set<std::string> unique_names;
   for (const auto& entry : entries) {
     if (entry.name.empty()) {
       return false;
     }
-    if (entry.bytes.size() >
-        static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max())) {
-      return false;
-    }
     if (!unique_names.insert(entry.name).second) {
       return false;
     }
   }
 
-  if (npz_path.has_parent_path()) {
-    std::filesystem::create_directories(npz_path.parent_path());
-  }
-  std::ofstream output(npz_path, std::ios::binary);
-  if (!output.is_open()) {
+  NpzWriter writer;
+  if (!writer.open(npz_path, settings)) {
     return false;
   }
-
-  struct CentralDirectoryWriteEntry {
-    std::string name;
-    std::uint32_t crc32 = 0;
-    std::uint32_t size = 0;
-    std::uint32_t local_header_offset = 0;
-  };
-  std::vector<CentralDirectoryWriteEntry> central_entries;
-  central_entries.reserve(entries.size());
-
   for (const auto& entry : entries) {
-    const auto local_header_offset = static_cast<std::uint32_t>(output.tellp());
-    const auto entry_size = static_cast<std::uint32_t>(entry.bytes.size());
-    const auto entry_name_size = static_cast<std::uint16_t>(entry.name.size());
-    const auto entry_crc32 = crc32(entry.bytes);
-
-    write_u32(&output, kLocalFileHeaderSignature);
-    write_u16(&output, 20);  // version needed to extract
-    write_u16(&output, 0);   // general purpose bit flag
-    write_u16(&output, 0);   // compression method: store
-    write_u16(&output, 0);   // last mod file time
-    write_u16(&output, 0);   // last mod file date
-    write_u32(&output, entry_crc32);
-    write_u32(&output, entry_size);
-    write_u32(&output, entry_size);
-    write_u16(&output, entry_name_size);
-    write_u16(&output, 0);  // extra field length
-    output.write(entry.name.data(),
-                 static_cast<std::streamsize>(entry.name.size()));
-    if (!entry.bytes.empty()) {
-      output.write(reinterpret_cast<const char*>(entry.bytes.data()),
-                   static_cast<std::streamsize>(entry.bytes.size()));
-    }
-
-    if (!output.good()) {
+    if (!writer.add_entry(entry.name, entry.bytes)) {
+      writer.close();
       return false;
     }
-
-    central_entries.push_back(CentralDirectoryWriteEntry{
-        .name = entry.name,
-        .crc32 = entry_crc32,
-        .size = entry_size,
-        .local_header_offset = local_header_offset,
-    });
-  }
-
-  const auto central_directory_offset = static_cast<std::uint32_t>(output.tellp());
-  for (const auto& entry : central_entries) {
-    write_u32(&output, kCentralDirectoryHeaderSignature);
-    write_u16(&output, 20);  // version made by
-    write_u16(&output, 20);  // version needed to extract
-    write_u16(&output, 0);   // general purpose bit flag
-    write_u16(&output, 0);   // compression method: store
-    write_u16(&output, 0);   // last mod file time
-    write_u16(&output, 0);   // last mod file date
-    write_u32(&output, entry.crc32);
-    write_u32(&output, entry.size);
-    write_u32(&output, entry.size);
-    write_u16(&output, static_cast<std::uint16_t>(entry.name.size()));
-    write_u16(&output, 0);  // extra field length
-    write_u16(&output, 0);  // file comment length
-    write_u16(&output, 0);  // disk number start
-    write_u16(&output, 0);  // internal file attributes
-    write_u32(&output, 0);  // external file attributes
-    write_u32(&output, entry.local_header_offset);
-    output.write(entry.name.data(),
-                 static_cast<std::streamsize>(entry.name.size()));
-  }
-
-  if (!output.good()) {
-    return false;
   }
-
-  const auto central_directory_size = static_cast<std::uint32_t>(
-      static_cast<std::uint32_t>(output.tellp()) - central_directory_offset);
-  const auto entry_count = static_cast<std::uint16_t>(central_entries.size());
-
-  write_u32(&output, kEndOfCentralDirectorySignature);
-  write_u16(&output, 0);  // number of this disk
-  write_u16(&output, 0);  // disk where central directory starts
-  write_u16(&output, entry_count);
-  write_u16(&output, entry_count);
-  write_u32(&output, central_directory_size);
-  write_u32(&output, central_directory_offset);
-  write_u16(&output, 0);  // .ZIP file comment length
-
-  return output.good();
+  return writer.close();
 }
 
 }  // namespace manim_cpp::testing
@@ -0,0 +1,150 @@
+#include "manim_cpp/testing/png_decoder.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+#include "manim_cpp/renderer/pixel_convert.hpp"
+#include "manim_cpp/testing/crc32.hpp"
+#include "manim_cpp/testing/mapped_file.hpp"
+
+namespace manim_cpp::testing {
+namespace {
+
+constexpr std::array<std::uint8_t, 8> kPngSignature = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+constexpr std::uint8_t kColorTypeRgb = 2;
+constexpr std::uint8_t kColorTypeRgba = 6;
+
+std::uint32_t read_u32_be(const std::uint8_t* bytes) {
+  return (static_cast<std::uint32_t>(bytes[0]) << 24U) |
+         (static_cast<std::uint32_t>(bytes[1]) << 16U) |
+         (static_cast<std::uint32_t>(bytes[2]) << 8U) | static_cast<std::uint32_t>(bytes[3]);
+}
+
+int paeth_predictor(const int a, const int b, const int c) {
+  const int pa = std::abs(b - c);
+  const int pb = std::abs(a - c);
+  const int pc = std::abs(a + b - 2 * c);
+  if (pa <= pb && pa <= pc) {
+    return a;
+  }
+  return pb <= pc ? b : c;
+}
+
+// Reverses the per-row filters in place; `lines` holds the filter byte and
+// `stride` bytes per row.
+bool unfilter(std::vector<std::uint8_t>* lines,
+              const std::size_t height,
+              const std::size_t stride,
+              const std::size_t bytes_per_pixel) {
+  const std::size_t line_bytes = stride + 1;
+  for (std::size_t y = 0; y < height; ++y) {
+    std::uint8_t* line = lines->data() + y * line_bytes;
+    const std::uint8_t* previous = y > 0 ? line - line_bytes : nullptr;
+    const std::uint8_t filter = line[0];
+    std::uint8_t* row = line + 1;
+    for (std::size_t x = 0; x < stride; ++x) {
+      const int a = x >= bytes_per_pixel ? row[x - bytes_per_pixel] : 0;
+      const int b = previous != nullptr ? previous[1 + x] : 0;
+      const int c = previous != nullptr && x >= bytes_per_pixel ? previous[1 + x - bytes_per_pixel]
+                                                                 : 0;
+      int predictor = 0;
+      switch (filter) {
+        case 0:
+          break;
+        case 1:
+          predictor = a;
+          break;
+        case 2:
+          predictor = b;
+          break;
+        case 3:
+          predictor = (a + b) >> 1;
+          break;
+        case 4:
+          predictor = paeth_predictor(a, b, c);
+          break;
+        default:
+          return false;
+      }
+      row[x] = static_cast<std::uint8_t>(row[x] + predictor);
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool decode_png(const std::span<const std::uint8_t> png, renderer::FrameBuffer* frame) {
+  if (png.size() < kPngSignature.size() ||
+      !std::equal(kPngSignature.begin(), kPngSignature.end(), png.begin())) {
+    return false;
+  }
+  std::size_t width = 0;
+  std::size_t height = 0;
+  std::uint8_t color_type = 0;
+  std::vector<std::uint8_t> idat;
+  bool ended = false;
+  for (std::size_t offset = kPngSignature.size(); !ended && offset + 12 <= png.size();) {
+    const std::size_t length = read_u32_be(png.data() + offset);
+    if (length > png.size() - offset - 12) {
+      return false;
+    }
+    const auto type_and_payload = png.subspan(offset + 4, length + 4);
+    const std::uint8_t* payload = type_and_payload.data() + 4;
+    if (crc32_update(0, type_and_payload) != read_u32_be(payload + length)) {
+      return false;
+    }
+    const std::string_view type(reinterpret_cast<const char*>(type_and_payload.data()), 4);
+    if (type == "IHDR") {
+      if (length < 13 || payload[8] != 8 || payload[10] != 0 || payload[11] != 0 ||
+          payload[12] != 0) {
+        return false;
+      }
+      width = read_u32_be(payload);
+      height = read_u32_be(payload + 4);
+      color_type = payload[9];
+    } else if (type == "IDAT") {
+      idat.insert(idat.end(), payload, payload + length);
+    } else if (type == "IEND") {
+      ended = true;
+    }
+    offset += length + 12;
+  }
+  if (!ended || width == 0 || height == 0 ||
+      (color_type != kColorTypeRgb && color_type != kColorTypeRgba)) {
+    return false;
+  }
+
+  const std::size_t bytes_per_pixel = color_type == kColorTypeRgba ? 4 : 3;
+  const std::size_t stride = width * bytes_per_pixel;
+  std::vector<std::uint8_t> lines((stride + 1) * height);
+  uLongf lines_size = static_cast<uLongf>(lines.size());
+  if (uncompress(lines.data(), &lines_size, idat.data(), static_cast<uLong>(idat.size())) !=
+          Z_OK ||
+      lines_size != lines.size() || !unfilter(&lines, height, stride, bytes_per_pixel)) {
+    return false;
+  }
+
+  frame->resize(width, height);
+  for (std::size_t y = 0; y < height; ++y) {
+    const std::uint8_t* row = lines.data() + y * (stride + 1) + 1;
+    if (bytes_per_pixel == 4) {
+      std::copy_n(row, stride, frame->row(y));
+    } else {
+      renderer::rgb_to_rgba(row, width, frame->row(y));
+    }
+  }
+  return true;
+}
+
+bool read_png(const std::filesystem::path& path, renderer::FrameBuffer* frame) {
+  MappedFile file;
+  return file.open(path) && decode_png(file.bytes(), frame);
+}
+
+}  // namespace manim_cpp::testing
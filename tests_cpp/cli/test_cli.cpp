@@ -12,6 +12,7 @@
 #include "manim_cpp/cli/cli.hpp"
 #include "manim_cpp/scene/registry.hpp"
 #include "manim_cpp/scene/scene.hpp"
+#include "manim_cpp/scene/scene_benchmark.hpp"
 
 namespace {
 
@@ -169,7 +170,7 @@ TEST(Cli, RenderHelpIncludesCoreOptions) {
 
   EXPECT_EQ(exit_code, 0);
   EXPECT_NE(out_capture.str().find("--renderer <cairo|opengl>"), std::string::npos);
-  EXPECT_NE(out_capture.str().find("--format <png|gif|mp4|webm|mov>"),
+  EXPECT_NE(out_capture.str().find("--format <png|gif|mp4|webm|mov|y4m>"),
             std::string::npos);
   EXPECT_NE(out_capture.str().find("--scene <SceneName>"), std::string::npos);
   EXPECT_NE(out_capture.str().find("--watch"), std::string::npos);
@@ -468,6 +469,242 @@ TEST(Cli, RenderSceneWritesDeterministicFrameImagesForOpenGLRenderer) {
   std::filesystem::remove_all(temp_root);
 }
 
+TEST(Cli, RenderSceneReusesHashedPartialMoviesOnRerender) {
+  const auto temp_root =
+      std::filesystem::temp_directory_path() / "manim_cpp_cli_render_partial_cache";
+  std::filesystem::remove_all(temp_root);
+  std::filesystem::create_directories(temp_root);
+
+  std::ofstream cfg(temp_root / "manim.cfg");
+  cfg << "[CLI]\n";
+  cfg << "media_dir = ./media\n";
+  cfg << "video_dir = {media_dir}/videos/{module_name}/{quality}\n";
+  cfg << "images_dir = {media_dir}/images/{module_name}\n";
+  cfg << "partial_movie_dir = {video_dir}/partial_movie_files/{scene_name}\n";
+  cfg << "pixel_width = 640\n";
+  cfg << "pixel_height = 360\n";
+  cfg << "frame_rate = 4\n";
+  cfg.close();
+
+  std::ofstream input_scene(temp_root / "demo_scene.cpp");
+  input_scene << "// placeholder\n";
+  input_scene.close();
+
+  const std::array<const char*, 5> args = {
+      "manim-cpp", "render", "demo_scene.cpp", "--scene", "CliRenderTimedScene"};
+  auto render_once = [&]() {
+    ScopedCurrentPath scoped_path(temp_root);
+    std::ostringstream out_capture;
+    std::streambuf* old_cout = std::cout.rdbuf(out_capture.rdbuf());
+    const int exit_code = manim_cpp::cli::run_cli(static_cast<int>(args.size()), args.data());
+    std::cout.rdbuf(old_cout);
+    EXPECT_EQ(exit_code, 0);
+    return out_capture.str();
+  };
+
+  EXPECT_NE(render_once().find("cached_animations=0"), std::string::npos);
+  const auto partial_root = temp_root / "media" / "videos" / "demo_scene" / "360p4" /
+                            "partial_movie_files" / "CliRenderTimedScene";
+  std::size_t partial_count = 0;
+  for (const auto& entry : std::filesystem::directory_iterator(partial_root)) {
+    EXPECT_EQ(entry.path().extension(), std::filesystem::path(".mp4"));
+    EXPECT_EQ(entry.path().stem().string().size(), static_cast<size_t>(32));
+    ++partial_count;
+  }
+  EXPECT_EQ(partial_count, static_cast<size_t>(1));
+
+  EXPECT_NE(render_once().find("cached_animations=1"), std::string::npos);
+
+  std::filesystem::remove_all(temp_root);
+}
+
+TEST(Cli, RenderSceneWithWorkersMatchesSingleProcessOutput) {
+  const auto temp_root =
+      std::filesystem::temp_directory_path() / "manim_cpp_cli_render_workers";
+  std::filesystem::remove_all(temp_root);
+  std::filesystem::create_directories(temp_root);
+
+  std::ofstream cfg(temp_root / "manim.cfg");
+  cfg << "[CLI]\n";
+  cfg << "media_dir = ./media\n";
+  cfg << "video_dir = {media_dir}/videos/{module_name}/{quality}\n";
+  cfg << "images_dir = {media_dir}/images/{module_name}\n";
+  cfg << "partial_movie_dir = {video_dir}/partial_movie_files/{scene_name}\n";
+  cfg << "pixel_width = 64\n";
+  cfg << "pixel_height = 36\n";
+  cfg << "frame_rate = 8\n";
+  cfg << "disable_caching = True\n";
+  cfg.close();
+
+  std::ofstream input_scene(temp_root / "demo_scene.cpp");
+  input_scene << "// placeholder\n";
+  input_scene.close();
+
+  const auto images_root = temp_root / "media" / "images" / "demo_scene";
+  const auto video_root = temp_root / "media" / "videos" / "demo_scene" / "36p8";
+  auto render = [&](const char* workers) {
+    ScopedCurrentPath scoped_path(temp_root);
+    const std::array<const char*, 7> args = {"manim-cpp", "render", "demo_scene.cpp",
+                                             "--scene", "CliRenderTimedScene",
+                                             "--workers", workers};
+    std::ostringstream out_capture;
+    std::streambuf* old_cout = std::cout.rdbuf(out_capture.rdbuf());
+    const int exit_code = manim_cpp::cli::run_cli(static_cast<int>(args.size()), args.data());
+    std::cout.rdbuf(old_cout);
+    EXPECT_EQ(exit_code, 0);
+    return out_capture.str();
+  };
+
+  const auto single_output = render("1");
+  EXPECT_NE(single_output.find("Pipeline stage=encode frames=4"), std::string::npos);
+  std::vector<std::string> single_frames;
+  for (int index = 1; index <= 4; ++index) {
+    single_frames.push_back(
+        read_file(images_root / ("CliRenderTimedScene_00000" + std::to_string(index) + ".png")));
+  }
+  const auto single_media = read_file(video_root / "CliRenderTimedScene.mp4");
+  std::filesystem::remove_all(images_root);
+
+  const auto farm_output = render("3");
+  EXPECT_NE(farm_output.find(" frames=4 "), std::string::npos);
+  EXPECT_NE(farm_output.find("Render worker frames=1-2 frame_count=2"), std::string::npos);
+  EXPECT_NE(farm_output.find("Render worker frames=4-4 frame_count=1"), std::string::npos);
+  for (int index = 1; index <= 4; ++index) {
+    EXPECT_EQ(
+        read_file(images_root / ("CliRenderTimedScene_00000" + std::to_string(index) + ".png")),
+        single_frames[static_cast<std::size_t>(index - 1)]);
+  }
+  EXPECT_EQ(read_file(video_root / "CliRenderTimedScene.mp4"), single_media);
+  const auto manifest = read_file(video_root / "CliRenderTimedScene.json");
+  EXPECT_NE(manifest.find("CliRenderTimedScene_frames_000001_000002.mp4"), std::string::npos);
+  EXPECT_NE(manifest.find("\"frame_count\":4"), std::string::npos);
+
+  std::filesystem::remove_all(temp_root);
+}
+
+TEST(Cli, RenderRejectsInvalidWorkerCounts) {
+  for (const char* workers : {"0", "-2", "many"}) {
+    const std::array<const char*, 5> args = {"manim-cpp", "render", "demo_scene.cpp",
+                                             "--workers", workers};
+    std::ostringstream err_capture;
+    std::streambuf* old_cerr = std::cerr.rdbuf(err_capture.rdbuf());
+    EXPECT_EQ(manim_cpp::cli::run_cli(static_cast<int>(args.size()), args.data()), 2);
+    std::cerr.rdbuf(old_cerr);
+    EXPECT_NE(err_capture.str().find("Invalid value for --workers"), std::string::npos);
+  }
+}
+
+TEST(Cli, RenderRejectsWorkersWithoutOutputPaths) {
+  const auto temp_root =
+      std::filesystem::temp_directory_path() / "manim_cpp_cli_render_workers_no_output";
+  std::filesystem::remove_all(temp_root);
+  std::filesystem::create_directories(temp_root);
+  std::ofstream cfg(temp_root / "manim.cfg");
+  cfg << "[CLI]\n";
+  cfg << "pixel_width = 64\n";
+  cfg << "pixel_height = 36\n";
+  cfg.close();
+
+  {
+    ScopedCurrentPath scoped_path(temp_root);
+    const std::array<const char*, 7> args = {"manim-cpp", "render", "demo_scene.cpp",
+                                             "--scene", "CliRenderTimedScene",
+                                             "--workers", "2"};
+    std::ostringstream err_capture;
+    std::streambuf* old_cerr = std::cerr.rdbuf(err_capture.rdbuf());
+    EXPECT_EQ(manim_cpp::cli::run_cli(static_cast<int>(args.size()), args.data()), 2);
+    std::cerr.rdbuf(old_cerr);
+    EXPECT_NE(err_capture.str().find("--workers needs images_dir"), std::string::npos)
+        << err_capture.str();
+  }
+
+  std::filesystem::remove_all(temp_root);
+}
+
+TEST(Cli, RenderSceneStreamsY4mVideo) {
+  const auto temp_root = std::filesystem::temp_directory_path() / "manim_cpp_cli_render_y4m";
+  std::filesystem::remove_all(temp_root);
+  std::filesystem::create_directories(temp_root);
+
+  std::ofstream cfg(temp_root / "manim.cfg");
+  cfg << "[CLI]\n";
+  cfg << "media_dir = ./media\n";
+  cfg << "video_dir = {media_dir}/videos/{module_name}/{quality}\n";
+  cfg << "images_dir = {media_dir}/images/{module_name}\n";
+  cfg << "partial_movie_dir = {video_dir}/partial_movie_files/{scene_name}\n";
+  cfg << "pixel_width = 64\n";
+  cfg << "pixel_height = 36\n";
+  cfg << "frame_rate = 8\n";
+  cfg.close();
+
+  std::ofstream input_scene(temp_root / "demo_scene.cpp");
+  input_scene << "// placeholder\n";
+  input_scene.close();
+
+  const std::string header =
+      "YUV4MPEG2 W64 H36 F8:1 Ip A1:1 C420jpeg XYSCSS=420JPEG XCOLORRANGE=LIMITED\n";
+  const std::size_t frame_record_size = 6 + 64 * 36 + 2 * 32 * 18;
+  ScopedCurrentPath scoped_path(temp_root);
+
+  {
+    const std::array<const char*, 7> args = {"manim-cpp", "render", "demo_scene.cpp",
+                                             "--scene", "CliRenderTimedScene",
+                                             "--format", "y4m"};
+    std::ostringstream out_capture;
+    std::streambuf* old_cout = std::cout.rdbuf(out_capture.rdbuf());
+    const int exit_code = manim_cpp::cli::run_cli(static_cast<int>(args.size()), args.data());
+    std::cout.rdbuf(old_cout);
+    EXPECT_EQ(exit_code, 0);
+    EXPECT_NE(out_capture.str().find("codec_hint=video/yuv4mpeg2"), std::string::npos);
+    EXPECT_NE(out_capture.str().find("Pipeline stage=encode frames=4"), std::string::npos);
+  }
+  const auto video = read_file(temp_root / "media" / "videos" / "demo_scene" / "36p8" /
+                               "CliRenderTimedScene.y4m");
+  ASSERT_EQ(video.size(), header.size() + 4 * frame_record_size);
+  EXPECT_EQ(video.substr(0, header.size()), header);
+  EXPECT_EQ(video.substr(header.size(), 6), "FRAME\n");
+  // The stream replaces the PNG frames.
+  EXPECT_FALSE(std::filesystem::exists(temp_root / "media" / "images" / "demo_scene" /
+                                       "CliRenderTimedScene_000001.png"));
+
+  {
+    const std::array<const char*, 9> args = {"manim-cpp", "render", "demo_scene.cpp",
+                                             "--scene", "CliRenderTimedScene",
+                                             "--format", "y4m", "--output_file", "-"};
+    std::ostringstream out_capture;
+    std::ostringstream err_capture;
+    std::streambuf* old_cout = std::cout.rdbuf(out_capture.rdbuf());
+    std::streambuf* old_cerr = std::cerr.rdbuf(err_capture.rdbuf());
+    const int exit_code = manim_cpp::cli::run_cli(static_cast<int>(args.size()), args.data());
+    std::cout.rdbuf(old_cout);
+    std::cerr.rdbuf(old_cerr);
+    EXPECT_EQ(exit_code, 0);
+    EXPECT_EQ(out_capture.str(), video);
+    EXPECT_NE(err_capture.str().find("Rendered registered scene: CliRenderTimedScene"),
+              std::string::npos);
+  }
+
+  std::filesystem::remove_all(temp_root);
+}
+
+TEST(Cli, RenderRejectsUnsupportedY4mOptions) {
+  const std::array<std::vector<const char*>, 2> cases = {{
+      {"manim-cpp", "render", "demo_scene.cpp", "--output_file", "out.y4m"},
+      {"manim-cpp", "render", "demo_scene.cpp", "--format", "y4m", "--workers", "2"},
+  }};
+  const std::array<const char*, 2> messages = {"--output_file requires --format y4m",
+                                               "--workers is not supported with --format y4m"};
+  for (std::size_t index = 0; index < cases.size(); ++index) {
+    std::ostringstream err_capture;
+    std::streambuf* old_cerr = std::cerr.rdbuf(err_capture.rdbuf());
+    EXPECT_EQ(manim_cpp::cli::run_cli(static_cast<int>(cases[index].size()),
+                                      cases[index].data()),
+              2);
+    std::cerr.rdbuf(old_cerr);
+    EXPECT_NE(err_capture.str().find(messages[index]), std::string::npos);
+  }
+}
+
 TEST(Cli, RenderSceneManifestIncludesElapsedSectionTimeline) {
   const auto temp_root =
       std::filesystem::temp_directory_path() / "manim_cpp_cli_render_manifest_timeline";
@@ -843,7 +1080,7 @@ TEST(Cli, CheckhealthJsonModeIsAccepted) {
   EXPECT_EQ(exit_code, 0);
   EXPECT_NE(out_capture.str().find("\"renderers\":[\"cairo\",\"opengl\"]"),
             std::string::npos);
-  EXPECT_NE(out_capture.str().find("\"formats\":[\"png\",\"gif\",\"mp4\",\"webm\",\"mov\"]"),
+  EXPECT_NE(out_capture.str().find("\"formats\":[\"png\",\"gif\",\"mp4\",\"webm\",\"mov\",\"y4m\"]"),
             std::string::npos);
   EXPECT_NE(out_capture.str().find("\"npz_writer\":true"), std::string::npos);
   EXPECT_NE(out_capture.str().find("\"compiler\":\""), std::string::npos);
@@ -874,7 +1111,7 @@ TEST(Cli, CheckhealthTextModeReportsRenderersAndFormats) {
 
   EXPECT_EQ(exit_code, 0);
   EXPECT_NE(out_capture.str().find("renderers: cairo, opengl"), std::string::npos);
-  EXPECT_NE(out_capture.str().find("formats: png, gif, mp4, webm, mov"),
+  EXPECT_NE(out_capture.str().find("formats: png, gif, mp4, webm, mov, y4m"),
             std::string::npos);
   EXPECT_NE(out_capture.str().find("npz_writer: available"), std::string::npos);
   EXPECT_NE(out_capture.str().find("compiler: "), std::string::npos);
@@ -998,3 +1235,49 @@ TEST(Cli, PluginsPathRespectsEnvironmentOverride) {
   EXPECT_EQ(exit_code, 0);
   EXPECT_NE(out_capture.str().find(plugin_root.string()), std::string::npos);
 }
+
+TEST(Cli, BenchWritesReportAndFailsOnBaselineRegression) {
+  const auto temp_root = std::filesystem::temp_directory_path() / "manim_cpp_cli_bench";
+  std::filesystem::remove_all(temp_root);
+  std::filesystem::create_directories(temp_root);
+  const auto report_path = (temp_root / "report.json").string();
+  const std::array<const char*, 11> args = {
+      "manim-cpp", "bench", "CliRenderTimedScene", "--runs", "2", "--resolution", "32,18",
+      "--fps", "10", "--output", report_path.c_str()};
+
+  std::ostringstream out_capture;
+  std::streambuf* old_cout = std::cout.rdbuf(out_capture.rdbuf());
+  const int exit_code = manim_cpp::cli::run_cli(static_cast<int>(args.size()), args.data());
+  std::cout.rdbuf(old_cout);
+
+  ASSERT_EQ(exit_code, 0);
+  EXPECT_NE(out_capture.str().find("Benchmarked CliRenderTimedScene: runs=2 frames=5"),
+            std::string::npos);
+  EXPECT_NE(out_capture.str().find("stage rasterize"), std::string::npos);
+  auto report = manim_cpp::scene::read_benchmark_report(report_path);
+  ASSERT_TRUE(report.has_value());
+  ASSERT_EQ(report->scenes.size(), 1U);
+  EXPECT_EQ(report->pixel_width, 32U);
+
+  // A baseline ten times faster than any real run must fail the gate.
+  report->scenes[0].median_wall_seconds /= 10.0;
+  const auto baseline_path = (temp_root / "baseline.json").string();
+  ASSERT_TRUE(manim_cpp::scene::write_benchmark_report(baseline_path, report.value()));
+  const std::array<const char*, 11> gated_args = {
+      "manim-cpp", "bench", "CliRenderTimedScene", "--runs", "1", "--resolution", "32,18",
+      "--fps", "10", "--baseline", baseline_path.c_str()};
+  std::ostringstream gated_capture;
+  old_cout = std::cout.rdbuf(gated_capture.rdbuf());
+  const int gated_exit_code =
+      manim_cpp::cli::run_cli(static_cast<int>(gated_args.size()), gated_args.data());
+  std::cout.rdbuf(old_cout);
+
+  EXPECT_EQ(gated_exit_code, 1);
+  EXPECT_NE(gated_capture.str().find("Regression CliRenderTimedScene wall_seconds"),
+            std::string::npos);
+
+  const std::array<const char*, 3> missing_args = {"manim-cpp", "bench", "MissingScene"};
+  EXPECT_EQ(manim_cpp::cli::run_cli(static_cast<int>(missing_args.size()), missing_args.data()),
+            2);
+  std::filesystem::remove_all(temp_root);
+}
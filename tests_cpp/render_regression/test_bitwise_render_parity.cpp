@@ -2,18 +2,21 @@
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
-#include <iomanip>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "manim_cpp/cli/cli.hpp"
 #include "manim_cpp/renderer/cairo_renderer.hpp"
+#include "manim_cpp/renderer/hash.hpp"
 #include "manim_cpp/renderer/opengl_renderer.hpp"
 #include "manim_cpp/scene/registry.hpp"
 #include "manim_cpp/scene/scene.hpp"
+#include "manim_cpp/testing/image_diff.hpp"
+#include "manim_cpp/testing/png_decoder.hpp"
 
 namespace {
 
@@ -63,25 +66,10 @@ std::string platform_id() {
 #endif
 }
 
-std::string fnv1a_64_hex(const std::filesystem::path& path) {
-  std::ifstream input(path, std::ios::binary);
-  if (!input.is_open()) {
-    return {};
-  }
-
-  constexpr std::uint64_t kOffsetBasis = 14695981039346656037ull;
-  constexpr std::uint64_t kPrime = 1099511628211ull;
-  std::uint64_t hash = kOffsetBasis;
-
-  char ch = 0;
-  while (input.get(ch)) {
-    hash ^= static_cast<std::uint8_t>(ch);
-    hash *= kPrime;
-  }
-
-  std::ostringstream stream;
-  stream << std::hex << std::setfill('0') << std::setw(16) << hash;
-  return stream.str();
+// 128-bit XXH3 of the whole file, as `xxhsum -H2` prints it.
+std::string file_hash_hex(const std::filesystem::path& path) {
+  const auto hash = manim_cpp::renderer::hash_file(path);
+  return hash.has_value() ? hash->to_hex() : std::string();
 }
 
 std::unordered_map<std::string, std::string> load_baseline_map(
@@ -118,8 +106,9 @@ std::string dump_map(const std::unordered_map<std::string, std::string>& values)
   return stream.str();
 }
 
-void run_bitwise_parity_case(const std::filesystem::path& repo_root,
-                             const std::string& renderer_name) {
+// Renders CliRenderBitwiseScene through the CLI into a fresh temp directory
+// and returns that directory.
+std::filesystem::path render_bitwise_scene(const std::string& renderer_name) {
   const auto temp_root = std::filesystem::temp_directory_path() /
                          ("manim_cpp_bitwise_render_" + renderer_name);
   std::filesystem::remove_all(temp_root);
@@ -152,9 +141,26 @@ void run_bitwise_parity_case(const std::filesystem::path& repo_root,
         args_storage[3].c_str(), args_storage[4].c_str(), args_storage[5].c_str(),
         args_storage[6].c_str(),
     };
-    ASSERT_EQ(manim_cpp::cli::run_cli(static_cast<int>(args.size()), args.data()), 0);
+    EXPECT_EQ(manim_cpp::cli::run_cli(static_cast<int>(args.size()), args.data()), 0);
+  }
+  return temp_root;
+}
+
+std::vector<std::string> frame_file_names(const std::string& renderer_name) {
+  if (renderer_name == "cairo") {
+    manim_cpp::renderer::CairoRenderer renderer;
+    return {renderer.frame_file_name("CliRenderBitwiseScene", 1),
+            renderer.frame_file_name("CliRenderBitwiseScene", 2)};
   }
+  manim_cpp::renderer::OpenGLRenderer renderer;
+  return {renderer.frame_file_name("CliRenderBitwiseScene", 1),
+          renderer.frame_file_name("CliRenderBitwiseScene", 2)};
+}
 
+void run_bitwise_parity_case(const std::filesystem::path& repo_root,
+                             const std::string& renderer_name) {
+  const auto temp_root = render_bitwise_scene(renderer_name);
+  const auto input_name = "bitwise_scene_" + renderer_name + ".cpp";
   const std::string module_name =
       std::filesystem::path(input_name).stem().string();
   const auto images_root = temp_root / "media" / "images" / module_name;
@@ -162,17 +168,9 @@ void run_bitwise_parity_case(const std::filesystem::path& repo_root,
   const auto media_path = video_root / "CliRenderBitwiseScene.mp4";
   ASSERT_TRUE(std::filesystem::exists(media_path));
 
-  std::string frame1_name;
-  std::string frame2_name;
-  if (renderer_name == "cairo") {
-    manim_cpp::renderer::CairoRenderer renderer;
-    frame1_name = renderer.frame_file_name("CliRenderBitwiseScene", 1);
-    frame2_name = renderer.frame_file_name("CliRenderBitwiseScene", 2);
-  } else {
-    manim_cpp::renderer::OpenGLRenderer renderer;
-    frame1_name = renderer.frame_file_name("CliRenderBitwiseScene", 1);
-    frame2_name = renderer.frame_file_name("CliRenderBitwiseScene", 2);
-  }
+  const auto frame_names = frame_file_names(renderer_name);
+  const std::string& frame1_name = frame_names[0];
+  const std::string& frame2_name = frame_names[1];
 
   const auto frame1_path = images_root / frame1_name;
   const auto frame2_path = images_root / frame2_name;
@@ -180,9 +178,9 @@ void run_bitwise_parity_case(const std::filesystem::path& repo_root,
   ASSERT_TRUE(std::filesystem::exists(frame2_path));
 
   std::unordered_map<std::string, std::string> actual = {
-      {frame1_name, fnv1a_64_hex(frame1_path)},
-      {frame2_name, fnv1a_64_hex(frame2_path)},
-      {media_path.filename().string(), fnv1a_64_hex(media_path)},
+      {frame1_name, file_hash_hex(frame1_path)},
+      {frame2_name, file_hash_hex(frame2_path)},
+      {media_path.filename().string(), file_hash_hex(media_path)},
   };
 
   const auto baseline_path = repo_root / "tests_cpp" / "render_regression" /
@@ -215,3 +213,46 @@ TEST(RenderBitwiseParity, CairoAndOpenGLMatchPlatformBaselines) {
   run_bitwise_parity_case(repo_root, "cairo");
   run_bitwise_parity_case(repo_root, "opengl");
 }
+
+// Frames are compared decoded, so encoder changes that keep the pixels do
+// not fail this, and a renderer drifting apart reports where and by how much.
+TEST(RenderBitwiseParity, CairoAndOpenGLFramesAgreeWithinTolerance) {
+  std::vector<manim_cpp::renderer::FrameBuffer> cairo_frames;
+  std::vector<manim_cpp::renderer::FrameBuffer> opengl_frames;
+  std::vector<std::filesystem::path> temp_roots;
+  for (const std::string renderer_name : {"cairo", "opengl"}) {
+    const auto temp_root = render_bitwise_scene(renderer_name);
+    temp_roots.push_back(temp_root);
+    auto& frames = renderer_name == "cairo" ? cairo_frames : opengl_frames;
+    for (const auto& name : frame_file_names(renderer_name)) {
+      const auto path =
+          temp_root / "media" / "images" / ("bitwise_scene_" + renderer_name) / name;
+      ASSERT_TRUE(manim_cpp::testing::read_png(path, &frames.emplace_back())) << path;
+    }
+  }
+
+  std::vector<manim_cpp::testing::ImageView> expected;
+  std::vector<manim_cpp::testing::ImageView> actual;
+  for (std::size_t frame = 0; frame < cairo_frames.size(); ++frame) {
+    expected.push_back(manim_cpp::testing::ImageView::of(cairo_frames[frame]));
+    actual.push_back(manim_cpp::testing::ImageView::of(opengl_frames[frame]));
+  }
+  manim_cpp::testing::ImageDiffSettings settings;
+  settings.channel_tolerance = {2, 2, 2, 0};
+  const auto result = manim_cpp::testing::diff_frame_sequences(expected, actual, settings);
+  if (result.first_diverging_frame.has_value()) {
+    const std::size_t frame = result.first_diverging_frame.value();
+    const auto heatmap = std::filesystem::temp_directory_path() /
+                         "manim_cpp_render_parity_heatmap.png";
+    if (frame < expected.size()) {
+      manim_cpp::testing::write_diff_heatmap(heatmap, expected[frame], actual[frame], settings);
+    }
+    ADD_FAILURE() << "Frame " << frame << " diverges: max error "
+                  << static_cast<int>(result.max_error) << ", PSNR " << result.min_psnr
+                  << " dB, SSIM " << result.min_ssim << "; heatmap: " << heatmap;
+  }
+
+  for (const auto& temp_root : temp_roots) {
+    std::filesystem::remove_all(temp_root);
+  }
+}
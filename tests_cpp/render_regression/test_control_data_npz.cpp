@@ -1,8 +1,12 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
+#include <zlib.h>
 
 #include "manim_cpp/testing/npz_archive.hpp"
 
@@ -139,3 +143,257 @@ TEST(NpzArchive, RejectsDuplicateOrEmptyEntryNamesWhenWriting) {
 
   std::filesystem::remove_all(temp_root);
 }
+
+TEST(NpzArchive, ReadsStoredEntriesInPlaceFromMapping) {
+  const auto temp_root = std::filesystem::temp_directory_path() / "manim_cpp_npz_mapped";
+  std::filesystem::remove_all(temp_root);
+  std::filesystem::create_directories(temp_root);
+
+  const auto output_path = temp_root / "sample.npz";
+  std::vector<std::uint8_t> frames(70000);
+  for (std::size_t index = 0; index < frames.size(); ++index) {
+    frames[index] = static_cast<std::uint8_t>(index * 7);
+  }
+  ASSERT_TRUE(manim_cpp::testing::write_npz_store_archive(
+      output_path, {{.name = "alpha.npy", .bytes = {0x01, 0x02}},
+                    {.name = "frame_data.npy", .bytes = frames}}));
+
+  manim_cpp::testing::NpzArchive archive;
+  ASSERT_TRUE(archive.open(output_path)) << archive.error();
+  ASSERT_EQ(archive.entries().size(), static_cast<std::size_t>(2));
+  EXPECT_EQ(archive.find_entry("missing.npy"), nullptr);
+  const auto* entry = archive.find_entry("frame_data.npy");
+  ASSERT_NE(entry, nullptr);
+
+  const auto bytes = archive.stored_entry_bytes(*entry);
+  ASSERT_TRUE(bytes.has_value());
+  ASSERT_EQ(bytes->size(), frames.size());
+  EXPECT_TRUE(std::equal(bytes->begin(), bytes->end(), frames.begin()));
+  EXPECT_GE(bytes->data(), archive.file().bytes().data());
+  EXPECT_LE(bytes->data() + bytes->size(),
+            archive.file().bytes().data() + archive.file().bytes().size());
+
+  // Released pages read back from the file.
+  archive.file().release(*bytes);
+  EXPECT_TRUE(std::equal(bytes->begin(), bytes->end(), frames.begin()));
+
+  EXPECT_FALSE(archive.open(temp_root / "missing.npz"));
+  EXPECT_FALSE(archive.error().empty());
+  EXPECT_TRUE(archive.entries().empty());
+
+  std::filesystem::remove_all(temp_root);
+}
+
+TEST(NpzArchive, LeavesDeflatedControlDataEntriesToTheCaller) {
+  const auto repo_root = find_repo_root();
+  ASSERT_FALSE(repo_root.empty());
+
+  manim_cpp::testing::NpzArchive archive;
+  ASSERT_TRUE(archive.open(repo_root / "tests" / "test_graphical_units" / "control_data" /
+                           "tables" / "IntegerTable.npz"))
+      << archive.error();
+  const auto* entry = archive.find_entry("frame_data.npy");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->compression_method, static_cast<std::uint16_t>(8));
+  EXPECT_FALSE(archive.stored_entry_bytes(*entry).has_value());
+}
+
+TEST(NpzWriter, StreamsFrameArrayAndPatchesShapeAndCrc) {
+  const auto temp_root = std::filesystem::temp_directory_path() / "manim_cpp_npz_stream";
+  std::filesystem::remove_all(temp_root);
+  const auto output_path = temp_root / "frames.npz";
+
+  std::vector<std::vector<std::uint8_t>> frames;
+  {
+    manim_cpp::testing::NpzWriter writer;
+    ASSERT_TRUE(writer.open(output_path)) << writer.error();
+    const std::vector<std::uint8_t> meta = {0x01, 0x02, 0x03};
+    ASSERT_TRUE(writer.add_entry("meta.npy", meta));
+    ASSERT_TRUE(writer.begin_frame_array("frame_data.npy", 3, 5, 4));
+    for (int frame = 0; frame < 4; ++frame) {
+      frames.emplace_back(3 * 5 * 4, static_cast<std::uint8_t>(frame * 40 + 1));
+      ASSERT_TRUE(writer.append_frame(frames.back())) << writer.error();
+    }
+    EXPECT_EQ(writer.frame_count(), static_cast<std::uint64_t>(4));
+    ASSERT_TRUE(writer.close()) << writer.error();
+  }
+
+  manim_cpp::testing::NpzArchive archive;
+  ASSERT_TRUE(archive.open(output_path)) << archive.error();
+  const auto* entry = archive.find_entry("frame_data.npy");
+  ASSERT_NE(entry, nullptr);
+  const auto bytes = archive.stored_entry_bytes(*entry);
+  ASSERT_TRUE(bytes.has_value());
+  ASSERT_EQ(bytes->size(), static_cast<std::size_t>(192 + 4 * 60));
+  EXPECT_EQ(entry->crc32,
+            static_cast<std::uint32_t>(crc32(0, bytes->data(), static_cast<uInt>(bytes->size()))));
+
+  const std::string header(reinterpret_cast<const char*>(bytes->data()), 192);
+  EXPECT_EQ(header.substr(1, 5), "NUMPY");
+  EXPECT_NE(header.find("'shape': (4, 3, 5, 4)"), std::string::npos) << header;
+  EXPECT_EQ(header.back(), '\n');
+  for (std::size_t frame = 0; frame < frames.size(); ++frame) {
+    EXPECT_TRUE(std::equal(frames[frame].begin(), frames[frame].end(),
+                           bytes->begin() + 192 + static_cast<std::ptrdiff_t>(frame * 60)));
+  }
+
+  const auto* meta = archive.find_entry("meta.npy");
+  ASSERT_NE(meta, nullptr);
+  EXPECT_EQ(meta->uncompressed_size, static_cast<std::uint64_t>(3));
+
+  std::filesystem::remove_all(temp_root);
+}
+
+TEST(NpzWriter, ReadsBackForcedZip64Records) {
+  const auto temp_root = std::filesystem::temp_directory_path() / "manim_cpp_npz_zip64";
+  std::filesystem::remove_all(temp_root);
+  const auto output_path = temp_root / "zip64.npz";
+
+  const std::vector<std::uint8_t> alpha(1000, 0x5A);
+  const std::vector<std::uint8_t> frame(2 * 2 * 3, 0x11);
+  manim_cpp::testing::NpzWriter writer;
+  ASSERT_TRUE(writer.open(output_path, {.force_zip64 = true}));
+  ASSERT_TRUE(writer.add_entry("alpha.npy", alpha));
+  ASSERT_TRUE(writer.begin_frame_array("frame_data.npy", 2, 2, 3));
+  ASSERT_TRUE(writer.append_frame(frame));
+  ASSERT_TRUE(writer.close()) << writer.error();
+
+  manim_cpp::testing::NpzArchive archive;
+  ASSERT_TRUE(archive.open(output_path)) << archive.error();
+  ASSERT_EQ(archive.entries().size(), static_cast<std::size_t>(2));
+  const auto& first = archive.entries().at(0);
+  EXPECT_EQ(first.name, "alpha.npy");
+  EXPECT_EQ(first.uncompressed_size, static_cast<std::uint64_t>(1000));
+  EXPECT_EQ(first.compressed_size, static_cast<std::uint64_t>(1000));
+  EXPECT_EQ(first.local_header_offset, static_cast<std::uint64_t>(0));
+  const auto first_bytes = archive.stored_entry_bytes(first);
+  ASSERT_TRUE(first_bytes.has_value());
+  EXPECT_TRUE(std::equal(alpha.begin(), alpha.end(), first_bytes->begin()));
+
+  const auto& second = archive.entries().at(1);
+  EXPECT_EQ(second.uncompressed_size, static_cast<std::uint64_t>(192 + 12));
+  EXPECT_GT(second.local_header_offset, static_cast<std::uint64_t>(1000));
+  EXPECT_TRUE(archive.stored_entry_bytes(second).has_value());
+
+  std::filesystem::remove_all(temp_root);
+}
+
+TEST(NpzWriter, RejectsMisuse) {
+  const auto temp_root = std::filesystem::temp_directory_path() / "manim_cpp_npz_misuse";
+  std::filesystem::remove_all(temp_root);
+
+  manim_cpp::testing::NpzWriter writer;
+  const std::vector<std::uint8_t> bytes = {0x01};
+  EXPECT_FALSE(writer.add_entry("closed.npy", bytes));
+
+  ASSERT_TRUE(writer.open(temp_root / "misuse.npz"));
+  EXPECT_FALSE(writer.append_frame(bytes));
+  EXPECT_FALSE(writer.error().empty());
+
+  ASSERT_TRUE(writer.open(temp_root / "shape.npz"));
+  ASSERT_TRUE(writer.begin_frame_array("frame_data.npy", 2, 2, 4));
+  EXPECT_FALSE(writer.append_frame(bytes));
+  EXPECT_FALSE(writer.close());
+
+  ASSERT_TRUE(writer.open(temp_root / "duplicate.npz"));
+  ASSERT_TRUE(writer.add_entry("a.npy", bytes));
+  EXPECT_FALSE(writer.add_entry("a.npy", bytes));
+  EXPECT_NE(writer.error().find("Duplicate"), std::string::npos);
+
+  std::filesystem::remove_all(temp_root);
+}
+
+TEST(NpzEntryReader, InflatesDeflatedControlDataEntries) {
+  const auto repo_root = find_repo_root();
+  ASSERT_FALSE(repo_root.empty());
+
+  manim_cpp::testing::NpzArchive archive;
+  ASSERT_TRUE(archive.open(repo_root / "tests" / "test_graphical_units" / "control_data" /
+                           "tables" / "IntegerTable.npz"))
+      << archive.error();
+  const auto* entry = archive.find_entry("frame_data.npy");
+  ASSERT_NE(entry, nullptr);
+
+  manim_cpp::testing::NpzEntryReader reader;
+  ASSERT_TRUE(reader.open(archive, *entry)) << reader.error();
+  EXPECT_EQ(reader.remaining(), entry->uncompressed_size);
+  std::vector<std::uint8_t> header(10);
+  ASSERT_EQ(reader.read(header), header.size());
+  EXPECT_EQ(std::string(header.begin() + 1, header.begin() + 6), "NUMPY");
+  // Skipping the rest still runs every byte through the CRC check.
+  ASSERT_TRUE(reader.skip(reader.remaining())) << reader.error();
+  EXPECT_EQ(reader.remaining(), static_cast<std::uint64_t>(0));
+  EXPECT_TRUE(reader.error().empty());
+}
+
+TEST(NpzWriter, DeflatesEntriesAndFrameArraysInParallelChunks) {
+  const auto temp_root = std::filesystem::temp_directory_path() / "manim_cpp_npz_deflate";
+  std::filesystem::remove_all(temp_root);
+  const auto output_path = temp_root / "deflated.npz";
+
+  // Smooth gradients, so there is something to compress, spanning several
+  // chunks per flush and several flushes per frame array.
+  std::vector<std::uint8_t> table(300 * 1024);
+  for (std::size_t i = 0; i < table.size(); ++i) {
+    table[i] = static_cast<std::uint8_t>((i / 7) ^ (i >> 12));
+  }
+  std::vector<std::vector<std::uint8_t>> frames;
+  manim_cpp::testing::NpzWriter writer;
+  ASSERT_TRUE(writer.open(output_path,
+                          {.compression_level = 6, .chunk_bytes = 64 * 1024, .worker_count = 3}));
+  ASSERT_TRUE(writer.add_entry("table.npy", table)) << writer.error();
+  ASSERT_TRUE(writer.begin_frame_array("frame_data.npy", 64, 64, 4));
+  for (int frame = 0; frame < 40; ++frame) {
+    auto& pixels = frames.emplace_back(64 * 64 * 4);
+    for (std::size_t i = 0; i < pixels.size(); ++i) {
+      pixels[i] = static_cast<std::uint8_t>(i / 256 + static_cast<std::size_t>(frame) * 3);
+    }
+    ASSERT_TRUE(writer.append_frame(pixels)) << writer.error();
+  }
+  ASSERT_TRUE(writer.close()) << writer.error();
+
+  manim_cpp::testing::NpzArchive archive;
+  ASSERT_TRUE(archive.open(output_path)) << archive.error();
+  ASSERT_EQ(archive.entries().size(), static_cast<std::size_t>(2));
+  for (const auto& entry : archive.entries()) {
+    EXPECT_EQ(entry.compression_method, static_cast<std::uint16_t>(8));
+    EXPECT_LT(entry.compressed_size * 4, entry.uncompressed_size) << entry.name;
+
+    // zlib agrees the chunks form a single valid raw deflate stream.
+    const auto data = archive.entry_data(entry);
+    ASSERT_TRUE(data.has_value());
+    std::vector<std::uint8_t> inflated(entry.uncompressed_size);
+    z_stream stream{};
+    ASSERT_EQ(inflateInit2(&stream, -MAX_WBITS), Z_OK);
+    stream.next_in = const_cast<Bytef*>(data->data());
+    stream.avail_in = static_cast<uInt>(data->size());
+    stream.next_out = inflated.data();
+    stream.avail_out = static_cast<uInt>(inflated.size());
+    EXPECT_EQ(inflate(&stream, Z_FINISH), Z_STREAM_END) << entry.name;
+    EXPECT_EQ(stream.avail_in, 0U);
+    EXPECT_EQ(stream.avail_out, 0U);
+    inflateEnd(&stream);
+    EXPECT_EQ(entry.crc32, static_cast<std::uint32_t>(
+                               crc32(0, inflated.data(), static_cast<uInt>(inflated.size()))));
+  }
+
+  manim_cpp::testing::NpzEntryReader reader;
+  ASSERT_TRUE(reader.open(archive, *archive.find_entry("table.npy")));
+  std::vector<std::uint8_t> read_back(table.size());
+  ASSERT_EQ(reader.read(read_back), table.size()) << reader.error();
+  EXPECT_EQ(read_back, table);
+
+  ASSERT_TRUE(reader.open(archive, *archive.find_entry("frame_data.npy")));
+  std::vector<std::uint8_t> header(192);
+  ASSERT_EQ(reader.read(header), header.size());
+  EXPECT_NE(std::string(header.begin(), header.end()).find("'shape': (40, 64, 64, 4)"),
+            std::string::npos);
+  std::vector<std::uint8_t> frame(64 * 64 * 4);
+  ASSERT_TRUE(reader.skip(frame.size() * 25));
+  ASSERT_EQ(reader.read(frame), frame.size());
+  EXPECT_EQ(frame, frames[25]);
+  ASSERT_TRUE(reader.skip(reader.remaining()));
+  EXPECT_TRUE(reader.error().empty());
+
+  std::filesystem::remove_all(temp_root);
+}
@@ -0,0 +1,183 @@
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/scene/async_file_writer.hpp"
+
+namespace {
+
+using manim_cpp::scene::AsyncFileWriter;
+using manim_cpp::scene::AsyncFileWriterSettings;
+using manim_cpp::scene::AsyncIoBackend;
+using manim_cpp::scene::FsyncPolicy;
+using manim_cpp::scene::SharedBytes;
+
+std::vector<std::uint8_t> read_bytes(const std::filesystem::path& path) {
+  std::ifstream input(path, std::ios::binary);
+  return std::vector<std::uint8_t>((std::istreambuf_iterator<char>(input)),
+                                   std::istreambuf_iterator<char>());
+}
+
+SharedBytes make_bytes(const std::size_t size, const std::uint8_t seed) {
+  auto bytes = std::make_shared<std::vector<std::uint8_t>>(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    (*bytes)[index] = static_cast<std::uint8_t>(seed + index * 31);
+  }
+  return bytes;
+}
+
+std::filesystem::path fresh_directory(const std::string& name) {
+  const auto directory = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+  return directory;
+}
+
+void expect_writes_files(const AsyncFileWriterSettings& settings, const std::string& name) {
+  const auto directory = fresh_directory(name);
+  std::atomic<std::size_t> callbacks{0};
+  std::vector<SharedBytes> payloads;
+  {
+    AsyncFileWriter writer(settings, [&](const std::filesystem::path&, const bool ok) {
+      if (ok) {
+        callbacks.fetch_add(1);
+      }
+    });
+    for (std::size_t index = 0; index < 40; ++index) {
+      // Spans several write() calls for the larger files.
+      payloads.push_back(make_bytes(1 + index * 4099, static_cast<std::uint8_t>(index)));
+      writer.submit(directory / ("file_" + std::to_string(index) + ".bin"), payloads.back());
+    }
+    ASSERT_TRUE(writer.flush()) << writer.error();
+    EXPECT_EQ(writer.completed_count(), payloads.size());
+    EXPECT_TRUE(writer.error().empty());
+  }
+  EXPECT_EQ(callbacks.load(), payloads.size());
+  for (std::size_t index = 0; index < payloads.size(); ++index) {
+    EXPECT_EQ(read_bytes(directory / ("file_" + std::to_string(index) + ".bin")),
+              *payloads[index])
+        << index;
+  }
+  std::filesystem::remove_all(directory);
+}
+
+}  // namespace
+
+TEST(AsyncFileWriter, ParsesPolicyAndBackendNames) {
+  EXPECT_EQ(manim_cpp::scene::parse_fsync_policy("never"), FsyncPolicy::kNever);
+  EXPECT_EQ(manim_cpp::scene::parse_fsync_policy("per_file"), FsyncPolicy::kPerFile);
+  EXPECT_EQ(manim_cpp::scene::parse_fsync_policy("on_flush"), FsyncPolicy::kOnFlush);
+  EXPECT_FALSE(manim_cpp::scene::parse_fsync_policy("always").has_value());
+  EXPECT_EQ(manim_cpp::scene::to_string(FsyncPolicy::kPerFile), "per_file");
+
+  EXPECT_EQ(manim_cpp::scene::parse_async_io_backend("auto"), AsyncIoBackend::kAuto);
+  EXPECT_EQ(manim_cpp::scene::parse_async_io_backend("io_uring"), AsyncIoBackend::kIoUring);
+  EXPECT_EQ(manim_cpp::scene::parse_async_io_backend("threads"), AsyncIoBackend::kThreads);
+  EXPECT_FALSE(manim_cpp::scene::parse_async_io_backend("aio").has_value());
+  EXPECT_EQ(manim_cpp::scene::to_string(AsyncIoBackend::kThreads), "threads");
+}
+
+TEST(AsyncFileWriter, ThreadBackendWritesEveryFile) {
+  AsyncFileWriter writer({.backend = AsyncIoBackend::kThreads});
+  EXPECT_STREQ(writer.backend_name(), "threads");
+  expect_writes_files({.backend = AsyncIoBackend::kThreads}, "manim_cpp_async_threads");
+}
+
+TEST(AsyncFileWriter, AutoBackendWritesEveryFile) {
+  const AsyncFileWriter writer;
+  const std::string backend = writer.backend_name();
+  EXPECT_TRUE(backend == "io_uring" || backend == "threads") << backend;
+  expect_writes_files({}, "manim_cpp_async_auto");
+}
+
+TEST(AsyncFileWriter, SingleSlotQueueStillWritesEveryFile) {
+  expect_writes_files({.queue_depth = 1, .thread_count = 1}, "manim_cpp_async_depth_one");
+  expect_writes_files({.queue_depth = 1, .backend = AsyncIoBackend::kThreads},
+                      "manim_cpp_async_depth_one_threads");
+}
+
+TEST(AsyncFileWriter, AppliesFsyncPolicies) {
+  expect_writes_files({.queue_depth = 4, .fsync_policy = FsyncPolicy::kPerFile},
+                      "manim_cpp_async_fsync_per_file");
+  expect_writes_files({.fsync_policy = FsyncPolicy::kOnFlush, .backend = AsyncIoBackend::kThreads},
+                      "manim_cpp_async_fsync_on_flush");
+}
+
+TEST(AsyncFileWriter, ReplacesExistingFiles) {
+  const auto directory = fresh_directory("manim_cpp_async_replace");
+  const auto path = directory / "frame.png";
+  {
+    std::ofstream output(path, std::ios::binary);
+    output << std::string(10000, 'x');
+  }
+  AsyncFileWriter writer;
+  const auto bytes = make_bytes(16, 3);
+  writer.submit(path, bytes);
+  ASSERT_TRUE(writer.flush()) << writer.error();
+  EXPECT_EQ(read_bytes(path), *bytes);
+  std::filesystem::remove_all(directory);
+}
+
+TEST(AsyncFileWriter, ReportsFailedWrites) {
+  const auto directory = fresh_directory("manim_cpp_async_missing");
+  const auto missing = directory / "does_not_exist" / "frame.png";
+  for (const auto backend : {AsyncIoBackend::kAuto, AsyncIoBackend::kThreads}) {
+    std::atomic<std::size_t> failures{0};
+    AsyncFileWriter writer({.backend = backend},
+                           [&](const std::filesystem::path& path, const bool ok) {
+                             if (!ok && path == missing) {
+                               failures.fetch_add(1);
+                             }
+                           });
+    writer.submit(directory / "ok.png", make_bytes(8, 1));
+    writer.submit(missing, make_bytes(8, 2));
+    EXPECT_FALSE(writer.flush());
+    EXPECT_NE(writer.error().find(missing.string()), std::string::npos) << writer.error();
+    EXPECT_EQ(failures.load(), 1u);
+    EXPECT_EQ(writer.completed_count(), 2u);
+    EXPECT_TRUE(std::filesystem::exists(directory / "ok.png"));
+  }
+  std::filesystem::remove_all(directory);
+}
+
+TEST(AsyncFileWriter, ReportsWhyAnExplicitIoUringBackendFellBack) {
+  const AsyncFileWriter requested({.backend = AsyncIoBackend::kIoUring});
+  if (std::string(requested.backend_name()) == "io_uring") {
+    EXPECT_TRUE(requested.backend_fallback_reason().empty());
+  } else {
+    EXPECT_FALSE(requested.backend_fallback_reason().empty());
+  }
+  const AsyncFileWriter automatic;
+  EXPECT_TRUE(automatic.backend_fallback_reason().empty());
+  const AsyncFileWriter threads({.backend = AsyncIoBackend::kThreads});
+  EXPECT_TRUE(threads.backend_fallback_reason().empty());
+}
+
+TEST(AsyncFileWriter, QueueDeeperThanTheRingStillWritesEveryFile) {
+  // io_uring rings stop at 4096 entries; the rest waits in the queue.
+  expect_writes_files({.queue_depth = 5000}, "manim_cpp_async_deep_queue");
+}
+
+TEST(AsyncFileWriter, FailedIoUringRingHandsRemainingFilesToBlockingWrites) {
+  // The first io_uring_enter submits its entries and then reports EIO, so
+  // the kernel owns operations the writer has to wait out before falling back.
+  const AsyncFileWriterSettings settings{.queue_depth = 8, .fail_io_uring_enter_at = 1};
+  expect_writes_files(settings, "manim_cpp_async_failed_ring");
+
+  AsyncFileWriter writer(settings);
+  if (std::string(writer.backend_name()) == "io_uring") {
+    const auto directory = fresh_directory("manim_cpp_async_failed_ring_backend");
+    writer.submit(directory / "frame.png", make_bytes(64, 3));
+    EXPECT_TRUE(writer.flush()) << writer.error();
+    EXPECT_STREQ(writer.backend_name(), "threads");
+    EXPECT_EQ(read_bytes(directory / "frame.png"), *make_bytes(64, 3));
+    std::filesystem::remove_all(directory);
+  }
+}
@@ -0,0 +1,68 @@
+#include <zlib.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/testing/crc32.hpp"
+
+namespace {
+
+std::vector<std::uint8_t> random_bytes(const std::size_t size, const unsigned seed) {
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::vector<std::uint8_t> bytes(size);
+  for (auto& value : bytes) {
+    value = static_cast<std::uint8_t>(byte(generator));
+  }
+  return bytes;
+}
+
+std::uint32_t zlib_crc32(const std::span<const std::uint8_t> bytes) {
+  return static_cast<std::uint32_t>(
+      crc32(0, bytes.data(), static_cast<uInt>(bytes.size())));
+}
+
+}  // namespace
+
+TEST(Crc32, MatchesTheCheckValue) {
+  const std::string check = "123456789";
+  const std::span<const std::uint8_t> bytes(reinterpret_cast<const std::uint8_t*>(check.data()),
+                                            check.size());
+  EXPECT_EQ(manim_cpp::testing::crc32_update(0, bytes), 0xCBF43926U);
+  EXPECT_EQ(manim_cpp::testing::crc32_update_slicing_by_8(0, bytes), 0xCBF43926U);
+  EXPECT_EQ(manim_cpp::testing::crc32_update(0, {}), 0U);
+}
+
+TEST(Crc32, MatchesZlibAcrossLengthsAndAlignments) {
+  const auto bytes = random_bytes(4096 + 16, 3);
+  for (std::size_t offset = 0; offset < 16; offset += 3) {
+    for (std::size_t size = 0; size <= 300; ++size) {
+      const auto slice = std::span(bytes).subspan(offset, size);
+      ASSERT_EQ(manim_cpp::testing::crc32_update(0, slice), zlib_crc32(slice))
+          << offset << " " << size;
+      ASSERT_EQ(manim_cpp::testing::crc32_update_slicing_by_8(0, slice), zlib_crc32(slice))
+          << offset << " " << size;
+    }
+  }
+  const auto slice = std::span(bytes).subspan(5, 4096);
+  EXPECT_EQ(manim_cpp::testing::crc32_update(0, slice), zlib_crc32(slice));
+}
+
+TEST(Crc32, ChainsAndCombinesStreamedPieces) {
+  const auto bytes = random_bytes(10000, 5);
+  const auto whole = zlib_crc32(bytes);
+  const auto head = std::span(bytes).first(3333);
+  const auto tail = std::span(bytes).subspan(3333);
+
+  EXPECT_EQ(manim_cpp::testing::crc32_update(manim_cpp::testing::crc32_update(0, head), tail),
+            whole);
+  EXPECT_EQ(manim_cpp::testing::crc32_combine(zlib_crc32(head), zlib_crc32(tail), tail.size()),
+            whole);
+  EXPECT_EQ(manim_cpp::testing::crc32_combine(whole, 0, 0), whole);
+}
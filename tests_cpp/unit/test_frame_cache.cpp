@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/renderer/cairo_renderer.hpp"
+#include "manim_cpp/renderer/draw_list.hpp"
+#include "manim_cpp/renderer/frame_cache.hpp"
+
+namespace {
+
+manim_cpp::renderer::RasterSettings small_settings() {
+  return manim_cpp::renderer::RasterSettings{
+      .pixel_width = 64,
+      .pixel_height = 32,
+      .frame_height = 8.0,
+      .tile_size = 16,
+  };
+}
+
+}  // namespace
+
+TEST(FrameCache, DrawStateHashTracksGeometryOpacityAndCamera) {
+  auto circle = std::make_shared<manim_cpp::mobject::Circle>(1.0);
+  const auto settings = small_settings();
+  const auto base = manim_cpp::renderer::hash_draw_state(
+      manim_cpp::renderer::build_draw_list({circle}), settings);
+  EXPECT_EQ(base, manim_cpp::renderer::hash_draw_state(
+                      manim_cpp::renderer::build_draw_list({circle}), settings));
+  EXPECT_EQ(base.to_hex().size(), 32U);
+
+  circle->shift({0.25, 0.0, 0.0});
+  const auto moved = manim_cpp::renderer::hash_draw_state(
+      manim_cpp::renderer::build_draw_list({circle}), settings);
+  EXPECT_NE(moved, base);
+
+  circle->set_opacity(0.5);
+  const auto faded = manim_cpp::renderer::hash_draw_state(
+      manim_cpp::renderer::build_draw_list({circle}), settings);
+  EXPECT_NE(faded, moved);
+
+  auto zoomed_settings = settings;
+  zoomed_settings.frame_height = 4.0;
+  EXPECT_NE(manim_cpp::renderer::hash_draw_state(
+                manim_cpp::renderer::build_draw_list({circle}), zoomed_settings),
+            faded);
+
+  auto retiled_settings = settings;
+  retiled_settings.tile_size = 32;
+  EXPECT_EQ(manim_cpp::renderer::hash_draw_state(
+                manim_cpp::renderer::build_draw_list({circle}), retiled_settings),
+            faded);
+}
+
+TEST(FrameCache, StreamingHasherIsIndependentOfChunking) {
+  manim_cpp::renderer::FrameHasher whole;
+  whole.update("abcdefghijklmnopqrstuvwxyz", 26);
+
+  manim_cpp::renderer::FrameHasher pieces;
+  pieces.update("abc", 3);
+  pieces.update("defghijklm", 10);
+  pieces.update("nopqrstuvwxyz", 13);
+  EXPECT_EQ(whole.finish(), pieces.finish());
+
+  EXPECT_NE(manim_cpp::renderer::hash_frame_signature("frame-a"),
+            manim_cpp::renderer::hash_frame_signature("frame-b"));
+}
+
+TEST(FrameCache, EvictsLeastRecentlyUsedFramesWithinByteBudget) {
+  const std::size_t frame_cost =
+      (8 * 8 * manim_cpp::renderer::FrameBuffer::kChannels) +
+      manim_cpp::renderer::FrameCache::kEntryOverheadBytes;
+  manim_cpp::renderer::FrameCache cache(frame_cost * 2);
+
+  const manim_cpp::renderer::FrameHash a{.high = 1, .low = 1};
+  const manim_cpp::renderer::FrameHash b{.high = 2, .low = 2};
+  const manim_cpp::renderer::FrameHash c{.high = 3, .low = 3};
+  EXPECT_TRUE(cache.insert(a, std::make_shared<manim_cpp::renderer::FrameBuffer>(8, 8)));
+  EXPECT_TRUE(cache.insert(b, std::make_shared<manim_cpp::renderer::FrameBuffer>(8, 8)));
+  ASSERT_NE(cache.find(a), nullptr);
+
+  EXPECT_TRUE(cache.insert(c, std::make_shared<manim_cpp::renderer::FrameBuffer>(8, 8)));
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_TRUE(cache.contains(a));
+  EXPECT_FALSE(cache.contains(b));
+  EXPECT_TRUE(cache.contains(c));
+  EXPECT_EQ(cache.evictions(), 1U);
+  EXPECT_LE(cache.used_bytes(), cache.max_bytes());
+
+  EXPECT_FALSE(cache.insert(b, std::make_shared<manim_cpp::renderer::FrameBuffer>(64, 64)));
+  EXPECT_EQ(cache.find(b), nullptr);
+  EXPECT_EQ(cache.hits(), 1U);
+  EXPECT_EQ(cache.misses(), 1U);
+
+  // An oversize frame also drops the stale one cached under its hash.
+  EXPECT_FALSE(cache.insert(a, std::make_shared<manim_cpp::renderer::FrameBuffer>(64, 64)));
+  EXPECT_FALSE(cache.contains(a));
+  EXPECT_EQ(cache.used_bytes(), frame_cost);
+
+  cache.set_max_bytes(frame_cost);
+  EXPECT_EQ(cache.size(), 1U);
+  EXPECT_TRUE(cache.contains(c));
+}
+
+TEST(FrameCache, SignatureOnlyEntriesAreNotFrameHits) {
+  manim_cpp::renderer::FrameCache cache;
+  const manim_cpp::renderer::FrameHash hash{.high = 4, .low = 4};
+
+  EXPECT_FALSE(cache.remember(hash));
+  EXPECT_TRUE(cache.remember(hash));
+  EXPECT_EQ(cache.find(hash), nullptr);
+  EXPECT_EQ(cache.hits(), 1U);
+  EXPECT_EQ(cache.misses(), 2U);
+
+  manim_cpp::renderer::CairoRenderer renderer;
+  const auto square = std::make_shared<manim_cpp::mobject::Square>(2.0);
+  const auto draw_list = manim_cpp::renderer::build_draw_list({square});
+  const auto frame_hash = manim_cpp::renderer::hash_draw_state(draw_list, small_settings());
+  EXPECT_TRUE(renderer.should_render_for_hash(frame_hash));
+  const auto rendered = renderer.render_frame(draw_list, small_settings(), frame_hash);
+  ASSERT_NE(rendered, nullptr);
+  EXPECT_FALSE(rendered->empty());
+  EXPECT_EQ(renderer.frame_cache().hits(), 0U);
+
+  // A repeated draw state shares the cached pixels.
+  EXPECT_EQ(renderer.render_frame(draw_list, small_settings(), frame_hash), rendered);
+  EXPECT_EQ(renderer.frame_cache().hits(), 1U);
+}
+
+TEST(FrameCache, CairoRendererReusesFramesForRepeatedDrawState) {
+  manim_cpp::renderer::CairoRenderer renderer;
+  auto square = std::make_shared<manim_cpp::mobject::Square>(2.0);
+
+  manim_cpp::renderer::FrameBuffer first;
+  const auto first_hash = renderer.render_frame({square}, small_settings(), &first);
+  manim_cpp::renderer::FrameBuffer second;
+  const auto second_hash = renderer.render_frame({square}, small_settings(), &second);
+
+  EXPECT_EQ(first_hash, second_hash);
+  EXPECT_EQ(renderer.frame_cache().hits(), 1U);
+  ASSERT_EQ(first.byte_size(), second.byte_size());
+  EXPECT_TRUE(std::equal(first.data(), first.data() + first.byte_size(), second.data()));
+
+  square->shift({1.0, 0.0, 0.0});
+  manim_cpp::renderer::FrameBuffer third;
+  EXPECT_NE(renderer.render_frame({square}, small_settings(), &third), first_hash);
+  EXPECT_EQ(renderer.frame_cache().hits(), 1U);
+  EXPECT_EQ(renderer.frame_cache().size(), 2U);
+
+  renderer.set_frame_cache_max_bytes(0);
+  EXPECT_EQ(renderer.frame_cache().size(), 0U);
+}
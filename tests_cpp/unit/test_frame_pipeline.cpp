@@ -0,0 +1,223 @@
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/animation/basic_animations.hpp"
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/renderer/cairo_renderer.hpp"
+#include "manim_cpp/renderer/spsc_queue.hpp"
+#include "manim_cpp/scene/frame_pipeline.hpp"
+#include "manim_cpp/scene/scene.hpp"
+#include "manim_cpp/scene/scene_file_writer.hpp"
+
+namespace {
+
+class PipelineScene : public manim_cpp::scene::Scene {
+ public:
+  std::string scene_name() const override { return "PipelineScene"; }
+  void construct() override {
+    auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+    add(square);
+    manim_cpp::animation::MoveToAnimation move(square, {2.0, 0.0, 0.0});
+    play(move, 4);
+    wait(0.5);
+  }
+};
+
+class ThrowingScene : public manim_cpp::scene::Scene {
+ public:
+  void construct() override {
+    wait(0.5);
+    throw std::runtime_error("construct failed");
+  }
+};
+
+std::filesystem::path make_temp_dir(const std::string& name) {
+  const auto path = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(path);
+  std::filesystem::create_directories(path);
+  return path;
+}
+
+manim_cpp::scene::FramePipelineSettings small_settings(std::filesystem::path images_dir) {
+  return {
+      .raster_settings = {.pixel_width = 32, .pixel_height = 18},
+      .queue_capacity = 2,
+      .images_dir = std::move(images_dir),
+      .frame_file_name = nullptr,
+  };
+}
+
+}  // namespace
+
+TEST(BoundedSpscQueue, PreservesOrderAndRejectsPushWhenFull) {
+  manim_cpp::renderer::BoundedSpscQueue<int> queue(2);
+  int value = 1;
+  EXPECT_TRUE(queue.try_push(value));
+  value = 2;
+  EXPECT_TRUE(queue.try_push(value));
+  value = 3;
+  EXPECT_FALSE(queue.try_push(value));
+  EXPECT_EQ(queue.size(), static_cast<std::size_t>(2));
+
+  int output = 0;
+  ASSERT_TRUE(queue.try_pop(&output));
+  EXPECT_EQ(output, 1);
+  EXPECT_TRUE(queue.try_push(value));
+  ASSERT_TRUE(queue.try_pop(&output));
+  EXPECT_EQ(output, 2);
+  ASSERT_TRUE(queue.try_pop(&output));
+  EXPECT_EQ(output, 3);
+  EXPECT_FALSE(queue.try_pop(&output));
+}
+
+TEST(BoundedSpscQueue, TransfersEveryItemBetweenThreads) {
+  constexpr int kItems = 20000;
+  manim_cpp::renderer::BoundedSpscQueue<int> queue(8);
+  std::thread producer([&]() {
+    for (int i = 0; i < kItems; ++i) {
+      int value = i;
+      while (!queue.try_push(value)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  long long sum = 0;
+  int expected = 0;
+  while (expected < kItems) {
+    int value = 0;
+    if (!queue.try_pop(&value)) {
+      std::this_thread::yield();
+      continue;
+    }
+    EXPECT_EQ(value, expected);
+    sum += value;
+    ++expected;
+  }
+  producer.join();
+  EXPECT_EQ(sum, static_cast<long long>(kItems) * (kItems - 1) / 2);
+}
+
+TEST(FramePipeline, WritesEveryEmittedFrameThroughTheFileWriter) {
+  const auto images_dir = make_temp_dir("manim_cpp_frame_pipeline_frames");
+  PipelineScene scene;
+  scene.set_render_settings({.pixel_width = 32, .pixel_height = 18}, 8.0);
+  manim_cpp::scene::SceneFileWriter writer(scene.scene_name());
+
+  manim_cpp::scene::FramePipeline pipeline(small_settings(images_dir));
+  ASSERT_TRUE(pipeline.run(scene, writer)) << pipeline.error();
+
+  // 1.25s of animation plus 0.5s of wait at 8 fps.
+  EXPECT_EQ(scene.emitted_frame_count(), static_cast<std::size_t>(14));
+  EXPECT_EQ(writer.written_frame_count(), static_cast<std::size_t>(14));
+  EXPECT_TRUE(std::filesystem::exists(images_dir / "PipelineScene_000001.png"));
+  EXPECT_TRUE(std::filesystem::exists(images_dir / "PipelineScene_000014.png"));
+
+  const auto& stats = pipeline.stats();
+  EXPECT_STREQ(stats.stages[0].name, "evaluate");
+  EXPECT_STREQ(stats.stages[2].name, "encode");
+  for (const auto& stage : stats.stages) {
+    EXPECT_EQ(stage.frames, static_cast<std::size_t>(14));
+  }
+  EXPECT_LE(stats.stages[0].max_queue_depth, static_cast<std::size_t>(2));
+  EXPECT_LE(stats.stages[1].max_queue_depth, static_cast<std::size_t>(2));
+  EXPECT_GT(stats.wall_seconds, 0.0);
+  for (std::size_t stage = 0; stage < stats.stages.size(); ++stage) {
+    EXPECT_GE(stats.occupancy(stage), 0.0);
+    EXPECT_LE(stats.occupancy(stage), 1.0);
+  }
+
+  std::filesystem::remove_all(images_dir);
+}
+
+TEST(FramePipeline, EvaluatesWithoutWritingWhenNoImageDirectoryIsSet) {
+  PipelineScene scene;
+  scene.set_render_settings({.pixel_width = 32, .pixel_height = 18}, 8.0);
+  manim_cpp::scene::SceneFileWriter writer(scene.scene_name());
+
+  manim_cpp::scene::FramePipeline pipeline(small_settings({}));
+  ASSERT_TRUE(pipeline.run(scene, writer));
+  EXPECT_EQ(pipeline.stats().stages[0].frames, static_cast<std::size_t>(14));
+  EXPECT_EQ(pipeline.stats().stages[1].frames, static_cast<std::size_t>(0));
+  EXPECT_EQ(writer.written_frame_count(), static_cast<std::size_t>(0));
+}
+
+TEST(FramePipeline, ReportsWriteFailuresAndStopsTheScene) {
+  PipelineScene scene;
+  scene.set_render_settings({.pixel_width = 32, .pixel_height = 18}, 8.0);
+  manim_cpp::scene::SceneFileWriter writer(scene.scene_name());
+
+  const auto missing_dir =
+      std::filesystem::temp_directory_path() / "manim_cpp_frame_pipeline_missing" / "nested";
+  std::filesystem::remove_all(missing_dir.parent_path());
+  manim_cpp::scene::FramePipeline pipeline(small_settings(missing_dir));
+  EXPECT_FALSE(pipeline.run(scene, writer));
+  EXPECT_NE(pipeline.error().find("Failed to write frame image file"), std::string::npos);
+  EXPECT_EQ(writer.written_frame_count(), static_cast<std::size_t>(0));
+}
+
+TEST(FramePipeline, RethrowsSceneExceptionsAfterStoppingStages) {
+  const auto images_dir = make_temp_dir("manim_cpp_frame_pipeline_throw");
+  ThrowingScene scene;
+  scene.set_render_settings({.pixel_width = 32, .pixel_height = 18}, 4.0);
+  manim_cpp::scene::SceneFileWriter writer(scene.scene_name());
+
+  manim_cpp::scene::FramePipeline pipeline(small_settings(images_dir));
+  EXPECT_THROW(pipeline.run(scene, writer), std::runtime_error);
+  std::filesystem::remove_all(images_dir);
+}
+
+TEST(FramePipeline, RejectsVideoStreamsWhileSegmentsAreCached) {
+  const auto partial_dir = make_temp_dir("manim_cpp_frame_pipeline_video_cache");
+  PipelineScene scene;
+  scene.set_render_settings({.pixel_width = 32, .pixel_height = 18}, 8.0);
+  manim_cpp::scene::SceneFileWriter writer(scene.scene_name());
+  writer.set_partial_movie_dir(partial_dir);
+  scene.set_file_writer(&writer);
+
+  manim_cpp::renderer::Y4mWriter video;
+  auto settings = small_settings({});
+  settings.video_sink = &video;
+  manim_cpp::scene::FramePipeline pipeline(settings);
+  EXPECT_FALSE(pipeline.run(scene, writer));
+  EXPECT_NE(pipeline.error().find("caching must be disabled"), std::string::npos);
+  EXPECT_EQ(pipeline.stats().stages[0].frames, static_cast<std::size_t>(0));
+  std::filesystem::remove_all(partial_dir);
+}
+
+TEST(FramePipeline, RewritesFramesOfCachedSegments) {
+  const auto partial_dir = make_temp_dir("manim_cpp_frame_pipeline_partials");
+  const auto images_dir = make_temp_dir("manim_cpp_frame_pipeline_cached_frames");
+  auto render = [&]() {
+    PipelineScene scene;
+    scene.set_render_settings({.pixel_width = 32, .pixel_height = 18}, 8.0);
+    manim_cpp::scene::SceneFileWriter writer(scene.scene_name());
+    writer.set_partial_movie_dir(partial_dir);
+    scene.set_file_writer(&writer);
+    manim_cpp::scene::FramePipeline pipeline(small_settings(images_dir));
+    EXPECT_TRUE(pipeline.run(scene, writer)) << pipeline.error();
+    for (const auto& file : writer.uncached_partial_movie_files()) {
+      std::ofstream(partial_dir / file) << "partial";
+    }
+    return writer.cached_animation_count();
+  };
+
+  EXPECT_EQ(render(), static_cast<std::size_t>(0));
+  std::filesystem::remove_all(images_dir);
+  std::filesystem::create_directories(images_dir);
+  // Both segments hit the cache, and every frame is written again.
+  EXPECT_EQ(render(), static_cast<std::size_t>(2));
+  for (std::size_t index = 1; index <= 14; ++index) {
+    EXPECT_TRUE(std::filesystem::exists(
+        images_dir / manim_cpp::renderer::CairoRenderer().frame_file_name("PipelineScene", index)))
+        << index;
+  }
+  std::filesystem::remove_all(partial_dir);
+  std::filesystem::remove_all(images_dir);
+}
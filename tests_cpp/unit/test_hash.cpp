@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/hash.hpp"
+
+namespace {
+
+std::span<const std::uint8_t> as_bytes(const std::string_view text) {
+  return {reinterpret_cast<const std::uint8_t*>(text.data()), text.size()};
+}
+
+// Byte i is i * 13 + 7, truncated.
+std::vector<std::uint8_t> pattern_bytes(const std::size_t size) {
+  std::vector<std::uint8_t> bytes(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    bytes[i] = static_cast<std::uint8_t>(i * 13 + 7);
+  }
+  return bytes;
+}
+
+std::vector<std::uint8_t> random_bytes(const std::size_t size, const unsigned seed) {
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::vector<std::uint8_t> bytes(size);
+  for (auto& value : bytes) {
+    value = static_cast<std::uint8_t>(byte(generator));
+  }
+  return bytes;
+}
+
+}  // namespace
+
+// Reference values from xxHash 0.8 (XXH3_64bits_withSeed / XXH3_128bits_withSeed),
+// produced with the python-xxhash 4.0.1 bindings: xxh3_64_intdigest(data, seed)
+// and xxh3_128_hexdigest(data, seed) over the same inputs.
+TEST(Hash, MatchesXxh3ReferenceVectors) {
+  using manim_cpp::renderer::hash128;
+  using manim_cpp::renderer::hash64;
+
+  EXPECT_EQ(hash64({}), 0x2D06800538D394C2ULL);
+  EXPECT_EQ(hash128({}).to_hex(), "99aa06d3014798d86001c324468d497f");
+  EXPECT_EQ(hash64(as_bytes("abc")), 0x78AF5F94892F3950ULL);
+  EXPECT_EQ(hash128(as_bytes("abc")).to_hex(), "06b05ab6733a618578af5f94892f3950");
+  const auto fox = as_bytes("The quick brown fox jumps over the lazy dog");
+  EXPECT_EQ(hash64(fox), 0xCE7D19A5418FB365ULL);
+  EXPECT_EQ(hash128(fox).to_hex(), "ddd650205ca3e7fa24a1cc2e3a8a7651");
+
+  const auto mid = pattern_bytes(200);
+  EXPECT_EQ(hash64(mid), 0xBD41B4CF61669465ULL);
+  EXPECT_EQ(hash128(mid).to_hex(), "6ab7775b60d9fce1a1afadc73eafed60");
+  EXPECT_EQ(hash64(mid, 0x5EED), 0xB9C998B6D39A3A34ULL);
+  EXPECT_EQ(hash128(mid, 0x5EED).to_hex(), "90f0fb7448c657e6ace0c7c54263e6e9");
+
+  const auto long_input = pattern_bytes(2048);
+  EXPECT_EQ(hash64(long_input), 0x9387EC354D8B5873ULL);
+  EXPECT_EQ(hash128(long_input).to_hex(), "328ec16af2703fd69387ec354d8b5873");
+  EXPECT_EQ(hash64(long_input, 0x5EED), 0x60D24FDD3559319FULL);
+  EXPECT_EQ(hash128(long_input, 0x5EED).to_hex(), "e9bc429cda889fc760d24fdd3559319f");
+}
+
+TEST(Hash, VectorKernelMatchesScalarAcrossSizes) {
+  const auto bytes = random_bytes(9000, 11);
+  for (std::size_t size = 0; size <= 1100; ++size) {
+    const auto slice = std::span<const std::uint8_t>(bytes).first(size);
+    ASSERT_EQ(manim_cpp::renderer::hash128(slice), manim_cpp::renderer::hash128_scalar(slice))
+        << size;
+  }
+  for (const std::size_t size : {4095U, 4096U, 4097U, 9000U}) {
+    const auto slice = std::span<const std::uint8_t>(bytes).first(size);
+    EXPECT_EQ(manim_cpp::renderer::hash128(slice, 99),
+              manim_cpp::renderer::hash128_scalar(slice, 99))
+        << size;
+  }
+  const std::string_view kernel = manim_cpp::renderer::hash_kernel_name();
+  EXPECT_TRUE(kernel == "avx2" || kernel == "scalar");
+}
+
+TEST(Hash, StreamingHasherMatchesOneShotForAnySplit) {
+  const auto bytes = random_bytes(5000, 17);
+  for (const std::size_t size : {0U, 16U, 240U, 241U, 256U, 257U, 1024U, 1025U, 5000U}) {
+    const auto slice = std::span<const std::uint8_t>(bytes).first(size);
+    const auto expected = manim_cpp::renderer::hash128(slice);
+    for (const std::size_t piece : {1U, 7U, 64U, 255U, 300U, 4096U}) {
+      manim_cpp::renderer::FrameHasher hasher;
+      for (std::size_t offset = 0; offset < size; offset += piece) {
+        hasher.update(slice.data() + offset, std::min(piece, size - offset));
+      }
+      ASSERT_EQ(hasher.finish(), expected) << size << " in pieces of " << piece;
+    }
+  }
+}
+
+TEST(Hash, HashesFrameBuffersByShapeAndPixels) {
+  manim_cpp::renderer::FrameBuffer wide(8, 2);
+  manim_cpp::renderer::FrameBuffer tall(2, 8);
+  EXPECT_NE(manim_cpp::renderer::hash_frame_buffer(wide),
+            manim_cpp::renderer::hash_frame_buffer(tall));
+
+  manim_cpp::renderer::FrameBuffer copy(8, 2);
+  EXPECT_EQ(manim_cpp::renderer::hash_frame_buffer(wide),
+            manim_cpp::renderer::hash_frame_buffer(copy));
+  copy.data()[5] = 1;
+  EXPECT_NE(manim_cpp::renderer::hash_frame_buffer(wide),
+            manim_cpp::renderer::hash_frame_buffer(copy));
+}
+
+TEST(Hash, HashesWholeFilesInChunks) {
+  const auto path = std::filesystem::temp_directory_path() / "manim_cpp_test_hash_file.bin";
+  // Spans one full read chunk and part of a second.
+  const auto bytes = random_bytes(100000, 23);
+  {
+    std::ofstream output(path, std::ios::binary);
+    output.write(reinterpret_cast<const char*>(bytes.data()),
+                 static_cast<std::streamsize>(bytes.size()));
+  }
+  const auto hash = manim_cpp::renderer::hash_file(path);
+  ASSERT_TRUE(hash.has_value());
+  EXPECT_EQ(hash.value(), manim_cpp::renderer::hash128(bytes));
+  std::filesystem::remove(path);
+
+  EXPECT_FALSE(manim_cpp::renderer::hash_file(path).has_value());
+}
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/testing/image_diff.hpp"
+#include "manim_cpp/testing/png_decoder.hpp"
+
+namespace {
+
+using manim_cpp::testing::diff_images;
+using manim_cpp::testing::diff_images_scalar;
+using manim_cpp::testing::ImageDiffSettings;
+using manim_cpp::testing::ImageView;
+
+std::vector<std::uint8_t> gradient(const std::size_t width,
+                                   const std::size_t height,
+                                   const std::size_t channels) {
+  std::vector<std::uint8_t> pixels(width * height * channels);
+  for (std::size_t i = 0; i < pixels.size(); ++i) {
+    pixels[i] = static_cast<std::uint8_t>((i * 7) / channels + i % channels * 40);
+  }
+  return pixels;
+}
+
+ImageView view(const std::vector<std::uint8_t>& pixels,
+               const std::size_t width,
+               const std::size_t height,
+               const std::size_t channels) {
+  return {.pixels = pixels, .width = width, .height = height, .channels = channels};
+}
+
+}  // namespace
+
+TEST(ImageDiff, IdenticalImagesMatchExactly) {
+  const auto pixels = gradient(37, 11, 4);
+  const auto diff = diff_images(view(pixels, 37, 11, 4), view(pixels, 37, 11, 4));
+  EXPECT_TRUE(diff.comparable);
+  EXPECT_TRUE(diff.within_tolerance());
+  EXPECT_EQ(diff.max_error, 0);
+  EXPECT_EQ(diff.mean_squared_error, 0.0);
+  EXPECT_TRUE(std::isinf(diff.psnr));
+  EXPECT_EQ(diff.ssim, 1.0);
+}
+
+TEST(ImageDiff, AppliesPerChannelToleranceAndReportsMetrics) {
+  const auto expected = gradient(64, 32, 4);
+  auto actual = expected;
+  // Every green byte off by 3, and one red byte off by 40.
+  for (std::size_t i = 1; i < actual.size(); i += 4) {
+    actual[i] = static_cast<std::uint8_t>(expected[i] >= 3 ? expected[i] - 3 : expected[i] + 3);
+  }
+  actual[4 * 100] = static_cast<std::uint8_t>(expected[4 * 100] >= 40 ? expected[4 * 100] - 40
+                                                                      : expected[4 * 100] + 40);
+
+  ImageDiffSettings settings;
+  settings.channel_tolerance = {0, 3, 0, 0};
+  const auto diff = diff_images(view(expected, 64, 32, 4), view(actual, 64, 32, 4), settings);
+  ASSERT_TRUE(diff.comparable);
+  EXPECT_EQ(diff.differing_pixels, 1U);
+  EXPECT_EQ(diff.channel_max_error[0], 40);
+  EXPECT_EQ(diff.channel_max_error[1], 3);
+  EXPECT_EQ(diff.channel_max_error[2], 0);
+  EXPECT_EQ(diff.max_error, 40);
+  const double mse = (64.0 * 32.0 * 9.0 + 1600.0) / (64.0 * 32.0 * 4.0);
+  EXPECT_DOUBLE_EQ(diff.mean_squared_error, mse);
+  EXPECT_DOUBLE_EQ(diff.psnr, 10.0 * std::log10(255.0 * 255.0 / mse));
+  EXPECT_LT(diff.ssim, 1.0);
+  EXPECT_GT(diff.ssim, 0.9);
+
+  settings.channel_tolerance = {0, 2, 0, 0};
+  EXPECT_EQ(diff_images(view(expected, 64, 32, 4), view(actual, 64, 32, 4), settings)
+                .differing_pixels,
+            64U * 32U);
+}
+
+TEST(ImageDiff, SimdKernelMatchesScalarReference) {
+  std::mt19937 generator(11);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::uniform_int_distribution<int> noise(-6, 6);
+  for (const std::size_t channels : {3U, 4U}) {
+    for (const std::size_t width : {1U, 31U, 97U}) {
+      const std::size_t height = 13;
+      std::vector<std::uint8_t> expected(width * height * channels);
+      for (auto& value : expected) {
+        value = static_cast<std::uint8_t>(byte(generator));
+      }
+      auto actual = expected;
+      for (auto& value : actual) {
+        value = static_cast<std::uint8_t>(std::clamp(value + noise(generator), 0, 255));
+      }
+      ImageDiffSettings settings;
+      settings.channel_tolerance = {2, 4, 1, 5};
+      const auto simd = diff_images(view(expected, width, height, channels),
+                                    view(actual, width, height, channels), settings);
+      const auto scalar = diff_images_scalar(view(expected, width, height, channels),
+                                             view(actual, width, height, channels), settings);
+      EXPECT_EQ(simd.channel_max_error, scalar.channel_max_error) << channels << " " << width;
+      EXPECT_EQ(simd.differing_pixels, scalar.differing_pixels) << channels << " " << width;
+      EXPECT_EQ(simd.mean_squared_error, scalar.mean_squared_error) << channels << " " << width;
+      EXPECT_EQ(simd.ssim, scalar.ssim);
+    }
+  }
+  const std::string kernel = manim_cpp::testing::image_diff_kernel_name();
+  EXPECT_TRUE(kernel == "avx2" || kernel == "scalar") << kernel;
+}
+
+TEST(ImageDiff, RejectsMismatchedShapes) {
+  const auto a = gradient(8, 8, 4);
+  const auto b = gradient(8, 8, 3);
+  EXPECT_FALSE(diff_images(view(a, 8, 8, 4), view(b, 8, 8, 3)).comparable);
+  EXPECT_FALSE(diff_images(view(a, 8, 8, 4), view(a, 4, 16, 4)).within_tolerance());
+  EXPECT_FALSE(diff_images(view(b, 8, 8, 3), view(b, 8, 9, 3)).comparable);
+}
+
+TEST(ImageDiff, ReportsFirstDivergingFrameAcrossWorkers) {
+  std::vector<std::vector<std::uint8_t>> frames;
+  for (int frame = 0; frame < 6; ++frame) {
+    frames.push_back(gradient(24, 16, 4));
+  }
+  auto changed = frames;
+  changed[3][17] = static_cast<std::uint8_t>(changed[3][17] + 9);
+  changed[5][40] = static_cast<std::uint8_t>(changed[5][40] + 1);
+
+  std::vector<ImageView> expected;
+  std::vector<ImageView> actual;
+  for (std::size_t frame = 0; frame < frames.size(); ++frame) {
+    expected.push_back(view(frames[frame], 24, 16, 4));
+    actual.push_back(view(changed[frame], 24, 16, 4));
+  }
+  ImageDiffSettings settings;
+  settings.worker_count = 3;
+  const auto result = manim_cpp::testing::diff_frame_sequences(expected, actual, settings);
+  ASSERT_EQ(result.frames.size(), frames.size());
+  ASSERT_TRUE(result.first_diverging_frame.has_value());
+  EXPECT_EQ(result.first_diverging_frame.value(), 3U);
+  EXPECT_EQ(result.max_error, 9);
+  EXPECT_TRUE(result.frames[4].within_tolerance());
+  EXPECT_LT(result.min_psnr, result.frames[5].psnr);
+
+  actual.pop_back();
+  settings.channel_tolerance = {9, 9, 9, 9};
+  const auto shorter = manim_cpp::testing::diff_frame_sequences(expected, actual, settings);
+  ASSERT_TRUE(shorter.first_diverging_frame.has_value());
+  EXPECT_EQ(shorter.first_diverging_frame.value(), 5U);
+}
+
+TEST(ImageDiff, WritesHeatmapHighlightingPixelsOutsideTolerance) {
+  manim_cpp::renderer::FrameBuffer expected(4, 2);
+  expected.clear({.r = 200, .g = 200, .b = 200, .a = 255});
+  manim_cpp::renderer::FrameBuffer actual = expected;
+  actual.data()[0] = 199;        // within tolerance
+  actual.data()[4 * 5 + 1] = 0;  // pixel 5: maximum error
+
+  ImageDiffSettings settings;
+  settings.channel_tolerance = {1, 1, 1, 1};
+  const auto temp_root = std::filesystem::temp_directory_path() / "manim_cpp_image_diff";
+  std::filesystem::remove_all(temp_root);
+  const auto path = temp_root / "heatmap.png";
+  ASSERT_TRUE(manim_cpp::testing::write_diff_heatmap(path, ImageView::of(expected),
+                                                     ImageView::of(actual), settings));
+
+  manim_cpp::renderer::FrameBuffer heatmap;
+  ASSERT_TRUE(manim_cpp::testing::read_png(path, &heatmap));
+  ASSERT_EQ(heatmap.width(), 4U);
+  ASSERT_EQ(heatmap.height(), 2U);
+  EXPECT_EQ(heatmap.pixel(1, 1), (manim_cpp::renderer::Rgba8{.r = 255, .g = 145, .b = 0}));
+  EXPECT_EQ(heatmap.pixel(0, 0), (manim_cpp::renderer::Rgba8{.r = 50, .g = 50, .b = 50}));
+  EXPECT_EQ(heatmap.pixel(3, 0), (manim_cpp::renderer::Rgba8{.r = 50, .g = 50, .b = 50}));
+
+  std::filesystem::remove_all(temp_root);
+}
@@ -22,6 +22,10 @@ TEST(MediaFormat, ParsesKnownFormatsCaseInsensitively) {
   const auto mov = manim_cpp::scene::parse_media_format("mov");
   ASSERT_TRUE(mov.has_value());
   EXPECT_EQ(mov.value(), manim_cpp::scene::MediaFormat::kMov);
+
+  const auto y4m = manim_cpp::scene::parse_media_format("Y4M");
+  ASSERT_TRUE(y4m.has_value());
+  EXPECT_EQ(y4m.value(), manim_cpp::scene::MediaFormat::kY4m);
 }
 
 TEST(MediaFormat, ConvertsFormatsToDeterministicLowercaseStrings) {
@@ -35,6 +39,8 @@ TEST(MediaFormat, ConvertsFormatsToDeterministicLowercaseStrings) {
             std::string("webm"));
   EXPECT_EQ(manim_cpp::scene::to_string(manim_cpp::scene::MediaFormat::kMov),
             std::string("mov"));
+  EXPECT_EQ(manim_cpp::scene::to_string(manim_cpp::scene::MediaFormat::kY4m),
+            std::string("y4m"));
 }
 
 TEST(MediaFormat, ReportsCodecHintsForKnownFormats) {
@@ -53,6 +59,9 @@ TEST(MediaFormat, ReportsCodecHintsForKnownFormats) {
   EXPECT_EQ(manim_cpp::scene::codec_hint_for_format(
                 manim_cpp::scene::MediaFormat::kMov),
             std::string("prores+pcm"));
+  EXPECT_EQ(manim_cpp::scene::codec_hint_for_format(
+                manim_cpp::scene::MediaFormat::kY4m),
+            std::string("video/yuv4mpeg2"));
 }
 
 TEST(MediaFormat, RejectsUnknownFormats) {
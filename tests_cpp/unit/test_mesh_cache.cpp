@@ -0,0 +1,151 @@
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/renderer/draw_list.hpp"
+#include "manim_cpp/renderer/mesh_cache.hpp"
+
+namespace {
+
+using manim_cpp::math::Vec2;
+
+manim_cpp::renderer::MeshKey ellipse_key(const double radius) {
+  return manim_cpp::renderer::MeshKey{.shape = manim_cpp::renderer::MeshShape::kEllipse,
+                                      .parameters = {radius, radius},
+                                      .segments = 4};
+}
+
+std::vector<std::vector<Vec2>> square_rings(const double half) {
+  return {{{-half, -half}, {half, -half}, {half, half}, {-half, half}}};
+}
+
+}  // namespace
+
+TEST(MeshCache, SharesMeshesPerKeyAndCountsLookups) {
+  manim_cpp::renderer::MeshCache cache;
+  std::size_t builds = 0;
+  const auto build = [&] {
+    ++builds;
+    return square_rings(1.0);
+  };
+
+  const auto first = cache.find_or_build(ellipse_key(1.0), build);
+  const auto second = cache.find_or_build(ellipse_key(1.0), build);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(builds, 1U);
+
+  auto finer = ellipse_key(1.0);
+  finer.segments = 8;
+  EXPECT_NE(cache.find_or_build(finer, build), first);
+  EXPECT_EQ(builds, 2U);
+
+  const auto stats = cache.stats();
+  EXPECT_EQ(stats.hits, 1U);
+  EXPECT_EQ(stats.misses, 2U);
+  EXPECT_EQ(stats.entries, 2U);
+  EXPECT_NEAR(stats.hit_rate(), 1.0 / 3.0, 1e-12);
+
+  cache.clear();
+  EXPECT_EQ(cache.stats().entries, 0U);
+  EXPECT_EQ(cache.stats().hit_rate(), 0.0);
+}
+
+TEST(MeshCache, EvictsLeastRecentlyUsedMeshes) {
+  manim_cpp::renderer::MeshCache cache(2);
+  const auto build = [] { return square_rings(1.0); };
+  const auto one = cache.find_or_build(ellipse_key(1.0), build);
+  cache.find_or_build(ellipse_key(2.0), build);
+  cache.find_or_build(ellipse_key(1.0), build);
+  cache.find_or_build(ellipse_key(3.0), build);
+
+  EXPECT_EQ(cache.stats().evictions, 1U);
+  EXPECT_EQ(cache.stats().entries, 2U);
+  // 1.0 was used more recently than 2.0, so it survived.
+  EXPECT_EQ(cache.find_or_build(ellipse_key(1.0), build), one);
+  EXPECT_EQ(cache.stats().misses, 3U);
+  // An evicted mesh stays valid for its holders.
+  EXPECT_EQ(one->rings().size(), 1U);
+
+  cache.set_max_entries(0);
+  EXPECT_EQ(cache.stats().entries, 0U);
+  EXPECT_NE(cache.find_or_build(ellipse_key(1.0), build), nullptr);
+  EXPECT_EQ(cache.stats().entries, 0U);
+}
+
+TEST(MeshCache, TriangulatesRingsWithHolesOnDemand) {
+  const manim_cpp::renderer::Mesh mesh({square_rings(2.0)[0], square_rings(1.0)[0]});
+  const auto& indices = mesh.indices();
+  ASSERT_EQ(indices.size(), 8U * 3U);
+  double area = 0.0;
+  const auto vertex = [&](const uint32_t index) {
+    return mesh.rings()[index / 4][index % 4];
+  };
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    const auto a = vertex(indices[i]);
+    const auto b = vertex(indices[i + 1]);
+    const auto c = vertex(indices[i + 2]);
+    area += std::abs((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0])) / 2.0;
+  }
+  EXPECT_NEAR(area, 16.0 - 4.0, 1e-12);
+  EXPECT_EQ(&mesh.indices(), &indices);
+}
+
+TEST(MeshCache, IsSafeToShareBetweenThreads) {
+  manim_cpp::renderer::MeshCache cache(8);
+  constexpr std::size_t kThreads = 4;
+  constexpr std::size_t kLookups = 2000;
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&cache, t] {
+      for (std::size_t i = 0; i < kLookups; ++i) {
+        const double radius = static_cast<double>((i + t) % 12) + 1.0;
+        const auto mesh = cache.find_or_build(ellipse_key(radius), [radius] {
+          return square_rings(radius);
+        });
+        ASSERT_EQ(mesh->rings()[0][2][0], radius);
+        ASSERT_FALSE(mesh->indices().empty());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const auto stats = cache.stats();
+  EXPECT_EQ(stats.hits + stats.misses, kThreads * kLookups);
+  EXPECT_LE(stats.entries, 8U);
+}
+
+TEST(MeshCache, DrawListTessellatesEachShapeOnceAndTranslatesInstances) {
+  // A radius no other test draws, so the first lookup misses.
+  constexpr double kRadius = 0.6180339887;
+  auto left = std::make_shared<manim_cpp::mobject::Circle>(kRadius);
+  auto right = std::make_shared<manim_cpp::mobject::Circle>(kRadius);
+  left->move_to({-2.0, 0.5, 0.0});
+  right->move_to({3.0, -1.0, 0.0});
+  right->set_opacity(0.25);
+
+  auto& cache = manim_cpp::renderer::MeshCache::global();
+  const auto before = cache.stats();
+  const auto draw_list = manim_cpp::renderer::build_draw_list({left, right});
+  const auto after = cache.stats();
+  EXPECT_EQ(after.misses - before.misses, 1U);
+  EXPECT_EQ(after.hits - before.hits, 1U);
+
+  ASSERT_EQ(draw_list.size(), 2U);
+  EXPECT_EQ(draw_list[1].opacity, 0.25);
+  const auto& ring = draw_list[1].rings.at(0);
+  ASSERT_EQ(ring.size(), manim_cpp::renderer::kCurveSegments);
+  for (std::size_t i = 0; i < ring.size(); ++i) {
+    const auto point = right->point_at_angle(2.0 * manim_cpp::math::kPi *
+                                             static_cast<double>(i) /
+                                             manim_cpp::renderer::kCurveSegments);
+    EXPECT_NEAR(ring[i][0], point[0], 1e-12);
+    EXPECT_NEAR(ring[i][1], point[1], 1e-12);
+    EXPECT_NEAR(draw_list[0].rings[0][i][0] - ring[i][0], -5.0, 1e-12);
+  }
+}
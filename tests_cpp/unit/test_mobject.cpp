@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "manim_cpp/mobject/geometry.hpp"
 #include "manim_cpp/mobject/mobject.hpp"
 
 namespace {
@@ -56,4 +57,22 @@ TEST(Mobject, ClampsOpacityIntoZeroToOneRange) {
   EXPECT_DOUBLE_EQ(mobject.opacity(), 1.0);
 }
 
+TEST(Mobject, CopiesSubclassesAndSubmobjectsDeeply) {
+  auto parent = std::make_shared<Mobject>();
+  auto circle = std::make_shared<manim_cpp::mobject::Circle>(0.5);
+  circle->move_to(Vec3{1.0, 0.0, 0.0});
+  parent->add(circle);
+
+  const auto copy = parent->copy();
+  ASSERT_EQ(copy->submobjects().size(), static_cast<size_t>(1));
+  const auto* copied_circle =
+      dynamic_cast<const manim_cpp::mobject::Circle*>(copy->submobjects()[0].get());
+  ASSERT_NE(copied_circle, nullptr);
+  EXPECT_NE(copy->submobjects()[0], circle);
+  EXPECT_DOUBLE_EQ(copied_circle->radius(), 0.5);
+
+  circle->shift(Vec3{1.0, 0.0, 0.0});
+  EXPECT_EQ(copied_circle->center(), (Vec3{1.0, 0.0, 0.0}));
+}
+
 }  // namespace
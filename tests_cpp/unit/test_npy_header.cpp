@@ -0,0 +1,155 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/testing/npy_header.hpp"
+#include "manim_cpp/testing/npz_archive.hpp"
+
+namespace {
+
+using manim_cpp::testing::NpyArrayView;
+using manim_cpp::testing::NpyDtype;
+using manim_cpp::testing::parse_npy_header;
+
+// An .npy with `dict` padded to a 64-byte boundary, as numpy writes it.
+std::vector<std::uint8_t> npy_bytes(const std::string& dict, const int version = 1) {
+  const std::size_t preamble = version == 1 ? 10 : 12;
+  std::string padded = dict;
+  while ((preamble + padded.size() + 1) % 64 != 0) {
+    padded.push_back(' ');
+  }
+  padded.push_back('\n');
+  std::vector<std::uint8_t> bytes = {0x93, 'N', 'U', 'M', 'P', 'Y',
+                                     static_cast<std::uint8_t>(version), 0};
+  for (std::size_t i = 0; i < preamble - 8; ++i) {
+    bytes.push_back(static_cast<std::uint8_t>((padded.size() >> (8 * i)) & 0xFFU));
+  }
+  bytes.insert(bytes.end(), padded.begin(), padded.end());
+  return bytes;
+}
+
+template <typename T>
+void append_values(std::vector<std::uint8_t>* bytes, const std::vector<T>& values) {
+  const std::size_t offset = bytes->size();
+  bytes->resize(offset + values.size() * sizeof(T));
+  std::memcpy(bytes->data() + offset, values.data(), values.size() * sizeof(T));
+}
+
+}  // namespace
+
+TEST(NpyHeader, ParsesFrameArrayHeader) {
+  const auto bytes =
+      npy_bytes("{'descr': '|u1', 'fortran_order': False, 'shape': (2, 3, 5, 4), }");
+  const auto header = parse_npy_header(bytes);
+  ASSERT_TRUE(header.has_value());
+  EXPECT_EQ(header->dtype, NpyDtype::kUint8);
+  EXPECT_FALSE(header->fortran_order);
+  ASSERT_EQ(header->rank, static_cast<std::size_t>(4));
+  EXPECT_EQ(header->shape[0], 2U);
+  EXPECT_EQ(header->shape[3], 4U);
+  EXPECT_EQ(header->data_offset, bytes.size());
+  EXPECT_EQ(header->element_count(), 120U);
+  EXPECT_EQ(manim_cpp::testing::npy_header_size(bytes), bytes.size());
+}
+
+TEST(NpyHeader, ParsesVersionTwoAndThreeHeadersAndOddSpacing) {
+  for (const int version : {2, 3}) {
+    const auto bytes =
+        npy_bytes("{\"shape\":(7,),\"fortran_order\":True,\"descr\":\"<f8\"}", version);
+    const auto header = parse_npy_header(bytes);
+    ASSERT_TRUE(header.has_value()) << version;
+    EXPECT_EQ(header->dtype, NpyDtype::kFloat64);
+    EXPECT_TRUE(header->fortran_order);
+    ASSERT_EQ(header->rank, static_cast<std::size_t>(1));
+    EXPECT_EQ(header->shape[0], 7U);
+    EXPECT_EQ(header->data_offset, bytes.size());
+  }
+
+  const auto scalar =
+      parse_npy_header(npy_bytes("{'descr': '<f4', 'fortran_order': False, 'shape': ()}"));
+  ASSERT_TRUE(scalar.has_value());
+  EXPECT_EQ(scalar->rank, static_cast<std::size_t>(0));
+  EXPECT_EQ(scalar->element_count(), 1U);
+}
+
+TEST(NpyHeader, RejectsMalformedOrUnsupportedHeaders) {
+  const std::vector<std::string> dicts = {
+      "{'descr': '>f4', 'fortran_order': False, 'shape': (2,), }",
+      "{'descr': '<i4', 'fortran_order': False, 'shape': (2,), }",
+      "{'descr': '|u1', 'fortran_order': false, 'shape': (2,), }",
+      "{'descr': '|u1', 'fortran_order': False, }",
+      "{'descr': '|u1', 'fortran_order': False, 'shape': (2, x), }",
+      "{'descr': '|u1', 'fortran_order': False, 'shape': (2,), 'extra': 1}",
+      "{'descr': '|u1', 'fortran_order': False, 'shape': (99999999999999999999,), }",
+      "{'descr': '<f8', 'fortran_order': False, 'shape': (4294967296, 4294967296), }",
+      "{'descr': '|u1', 'fortran_order': False, 'shape': (1, 1, 1, 1, 1, 1, 1, 1, 1), }",
+      "{'descr': '|u1' 'fortran_order': False, 'shape': (2,), }",
+  };
+  for (const auto& dict : dicts) {
+    EXPECT_FALSE(parse_npy_header(npy_bytes(dict)).has_value()) << dict;
+  }
+
+  auto truncated = npy_bytes("{'descr': '|u1', 'fortran_order': False, 'shape': (2,), }");
+  truncated.resize(truncated.size() - 1);
+  EXPECT_FALSE(parse_npy_header(truncated).has_value());
+  auto bad_version = npy_bytes("{'descr': '|u1', 'fortran_order': False, 'shape': (2,), }");
+  bad_version[6] = 4;
+  EXPECT_FALSE(parse_npy_header(bad_version).has_value());
+}
+
+TEST(NpyArrayView, ReadsUnalignedElementsInEitherOrder) {
+  // Shape (2, 3) holding value 10 * row + column.
+  auto c_order = npy_bytes("{'descr': '<f4', 'fortran_order': False, 'shape': (2, 3), }");
+  append_values<float>(&c_order, {0, 1, 2, 10, 11, 12});
+  auto fortran_order = npy_bytes("{'descr': '<f4', 'fortran_order': True, 'shape': (2, 3), }");
+  append_values<float>(&fortran_order, {0, 10, 1, 11, 2, 12});
+
+  for (auto bytes : {c_order, fortran_order}) {
+    // One byte of slack in front, as inside a zip entry.
+    bytes.insert(bytes.begin(), 0);
+    const auto view = NpyArrayView<float>::create(std::span(bytes).subspan(1));
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->size(), 6U);
+    for (std::uint64_t row = 0; row < 2; ++row) {
+      for (std::uint64_t column = 0; column < 3; ++column) {
+        const std::uint64_t index[] = {row, column};
+        EXPECT_EQ(view->at(index), static_cast<float>(10 * row + column));
+      }
+    }
+  }
+
+  EXPECT_FALSE(NpyArrayView<double>::create(c_order).has_value());
+  c_order.pop_back();
+  EXPECT_FALSE(NpyArrayView<float>::create(c_order).has_value());
+}
+
+TEST(NpyArrayView, ReadsFrameArraysWrittenByNpzWriter) {
+  const auto temp_root = std::filesystem::temp_directory_path() / "manim_cpp_npy_view";
+  std::filesystem::remove_all(temp_root);
+  const std::vector<std::uint8_t> frame(2 * 3 * 4, 0x7F);
+  manim_cpp::testing::NpzWriter writer;
+  ASSERT_TRUE(writer.open(temp_root / "frames.npz"));
+  ASSERT_TRUE(writer.begin_frame_array("frame_data.npy", 2, 3, 4));
+  ASSERT_TRUE(writer.append_frame(frame));
+  ASSERT_TRUE(writer.append_frame(frame));
+  ASSERT_TRUE(writer.close());
+
+  manim_cpp::testing::NpzArchive archive;
+  ASSERT_TRUE(archive.open(temp_root / "frames.npz"));
+  const auto bytes = archive.stored_entry_bytes(*archive.find_entry("frame_data.npy"));
+  ASSERT_TRUE(bytes.has_value());
+  const auto view = NpyArrayView<std::uint8_t>::create(bytes.value());
+  ASSERT_TRUE(view.has_value());
+  ASSERT_EQ(view->header().rank, static_cast<std::size_t>(4));
+  EXPECT_EQ(view->header().shape[0], 2U);
+  EXPECT_EQ(view->size(), 2 * frame.size());
+  EXPECT_EQ((*view)[view->size() - 1], 0x7F);
+
+  std::filesystem::remove_all(temp_root);
+}
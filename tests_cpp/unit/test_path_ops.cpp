@@ -38,6 +38,54 @@ TEST(PathOps, DetectsPolygonSelfIntersection) {
   EXPECT_TRUE(manim_cpp::math::has_self_intersections(bow_tie));
 }
 
+TEST(PathOps, AcceptsLargeSimplePolygon) {
+  std::vector<manim_cpp::math::Vec2> star;
+  for (int i = 0; i < 1000; ++i) {
+    const double angle = 2.0 * std::acos(-1.0) * i / 1000.0;
+    const double radius = i % 2 == 0 ? 1.0 : 0.5;
+    star.push_back({radius * std::cos(angle), radius * std::sin(angle)});
+  }
+
+  EXPECT_FALSE(manim_cpp::math::has_self_intersections(star));
+  EXPECT_TRUE(manim_cpp::math::find_self_intersections(star).empty());
+}
+
+TEST(PathOps, CountsVerticesTouchingOtherEdges) {
+  // The fourth vertex lands on the first edge without crossing it.
+  const std::vector<manim_cpp::math::Vec2> touching = {
+      {0.0, 0.0}, {4.0, 0.0}, {4.0, 2.0}, {2.0, 0.0}, {0.0, 2.0}};
+
+  EXPECT_TRUE(manim_cpp::math::has_self_intersections(touching));
+  const auto found = manim_cpp::math::find_self_intersections(touching);
+  ASSERT_EQ(found.size(), 2U);
+  EXPECT_EQ(found[0].first_edge, 0U);
+  EXPECT_EQ(found[0].second_edge, 2U);
+  EXPECT_EQ(found[1].first_edge, 0U);
+  EXPECT_EQ(found[1].second_edge, 3U);
+  EXPECT_DOUBLE_EQ(found[0].point[0], 2.0);
+  EXPECT_DOUBLE_EQ(found[0].point[1], 0.0);
+}
+
+TEST(PathOps, FindsEveryCrossingOfAStarPolygon) {
+  // A pentagram: each edge crosses the two edges it is not adjacent to.
+  std::vector<manim_cpp::math::Vec2> pentagram;
+  for (int i = 0; i < 5; ++i) {
+    const double angle = 2.0 * std::acos(-1.0) * (2 * i) / 5.0;
+    pentagram.push_back({std::cos(angle), std::sin(angle)});
+  }
+
+  const auto found = manim_cpp::math::find_self_intersections(pentagram);
+  ASSERT_EQ(found.size(), 5U);
+  for (const auto& crossing : found) {
+    EXPECT_LT(crossing.first_edge, crossing.second_edge);
+    EXPECT_NE(crossing.second_edge - crossing.first_edge, 1U);
+    EXPECT_NE(crossing.second_edge - crossing.first_edge, 4U);
+    // The crossings lie on the inner pentagon.
+    EXPECT_NEAR(std::hypot(crossing.point[0], crossing.point[1]),
+                std::cos(0.4 * std::acos(-1.0)) / std::cos(0.2 * std::acos(-1.0)), 1e-9);
+  }
+}
+
 TEST(PathOps, IntersectsConvexPolygonsWithExpectedArea) {
   const std::vector<manim_cpp::math::Vec2> a = {
       {0.0, 0.0}, {2.0, 0.0}, {2.0, 2.0}, {0.0, 2.0}};
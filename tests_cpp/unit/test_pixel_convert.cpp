@@ -0,0 +1,44 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/renderer/pixel_convert.hpp"
+
+TEST(PixelConvert, StripsAlphaLikeTheScalarReference) {
+  std::mt19937 generator(7);
+  std::uniform_int_distribution<int> byte(0, 255);
+  // Covers the 16-pixel SIMD body, its scalar tail and a tail-only input.
+  for (const std::size_t pixel_count : {std::size_t{0}, std::size_t{5}, std::size_t{16},
+                                        std::size_t{47}, std::size_t{1000}}) {
+    std::vector<std::uint8_t> rgba(pixel_count * 4);
+    for (auto& value : rgba) {
+      value = static_cast<std::uint8_t>(byte(generator));
+    }
+    std::vector<std::uint8_t> expected(pixel_count * 3 + 1, 0xEE);
+    std::vector<std::uint8_t> actual(pixel_count * 3 + 1, 0xEE);
+    manim_cpp::renderer::rgba_to_rgb_scalar(rgba.data(), pixel_count, expected.data());
+    manim_cpp::renderer::rgba_to_rgb(rgba.data(), pixel_count, actual.data());
+    EXPECT_EQ(actual, expected) << pixel_count;
+    // Nothing past the last pixel is written.
+    EXPECT_EQ(actual.back(), 0xEE);
+    for (std::size_t pixel = 0; pixel < pixel_count; ++pixel) {
+      ASSERT_EQ(expected[pixel * 3 + 2], rgba[pixel * 4 + 2]);
+    }
+  }
+}
+
+TEST(PixelConvert, ExpandsRgbWithOpaqueAlpha) {
+  const std::vector<std::uint8_t> rgb = {1, 2, 3, 4, 5, 6};
+  std::vector<std::uint8_t> rgba(8);
+  manim_cpp::renderer::rgb_to_rgba(rgb.data(), 2, rgba.data());
+  EXPECT_EQ(rgba, (std::vector<std::uint8_t>{1, 2, 3, 255, 4, 5, 6, 255}));
+}
+
+TEST(PixelConvert, ReportsConverterName) {
+  const std::string name = manim_cpp::renderer::pixel_converter_name();
+  EXPECT_TRUE(name == "ssse3" || name == "neon" || name == "scalar") << name;
+}
@@ -0,0 +1,186 @@
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/image_io.hpp"
+#include "manim_cpp/renderer/png_encoder.hpp"
+
+namespace {
+
+std::uint32_t read_u32_be(const std::uint8_t* bytes) {
+  return (static_cast<std::uint32_t>(bytes[0]) << 24U) |
+         (static_cast<std::uint32_t>(bytes[1]) << 16U) |
+         (static_cast<std::uint32_t>(bytes[2]) << 8U) | static_cast<std::uint32_t>(bytes[3]);
+}
+
+int paeth(const int a, const int b, const int c) {
+  const int pa = std::abs(b - c);
+  const int pb = std::abs(a - c);
+  const int pc = std::abs(a + b - 2 * c);
+  if (pa <= pb && pa <= pc) {
+    return a;
+  }
+  return pb <= pc ? b : c;
+}
+
+// Minimal RGBA8 decoder: checks chunk CRCs, inflates IDAT and unfilters.
+bool decode_png(const std::vector<std::uint8_t>& png, manim_cpp::renderer::FrameBuffer* frame) {
+  if (png.size() < 8) {
+    return false;
+  }
+  std::size_t offset = 8;
+  std::size_t width = 0;
+  std::size_t height = 0;
+  std::vector<std::uint8_t> idat;
+  while (offset + 12 <= png.size()) {
+    const std::size_t length = read_u32_be(&png[offset]);
+    const std::string type(reinterpret_cast<const char*>(&png[offset + 4]), 4);
+    const std::uint8_t* payload = &png[offset + 8];
+    const auto crc = crc32(0L, &png[offset + 4], static_cast<uInt>(length + 4));
+    if (crc != read_u32_be(payload + length)) {
+      return false;
+    }
+    if (type == "IHDR") {
+      width = read_u32_be(payload);
+      height = read_u32_be(payload + 4);
+    } else if (type == "IDAT") {
+      idat.insert(idat.end(), payload, payload + length);
+    }
+    offset += length + 12;
+  }
+
+  const std::size_t stride = width * 4;
+  std::vector<std::uint8_t> filtered((stride + 1) * height);
+  uLongf filtered_size = static_cast<uLongf>(filtered.size());
+  if (uncompress(filtered.data(), &filtered_size, idat.data(), static_cast<uLong>(idat.size())) !=
+          Z_OK ||
+      filtered_size != filtered.size()) {
+    return false;
+  }
+
+  frame->resize(width, height);
+  for (std::size_t y = 0; y < height; ++y) {
+    const std::uint8_t* line = filtered.data() + y * (stride + 1);
+    std::uint8_t* row = frame->row(y);
+    for (std::size_t x = 0; x < stride; ++x) {
+      const int a = x >= 4 ? row[x - 4] : 0;
+      const int b = y > 0 ? frame->row(y - 1)[x] : 0;
+      const int c = x >= 4 && y > 0 ? frame->row(y - 1)[x - 4] : 0;
+      int predictor = 0;
+      switch (line[0]) {
+        case 0:
+          break;
+        case 1:
+          predictor = a;
+          break;
+        case 2:
+          predictor = b;
+          break;
+        case 3:
+          predictor = (a + b) / 2;
+          break;
+        case 4:
+          predictor = paeth(a, b, c);
+          break;
+        default:
+          return false;
+      }
+      row[x] = static_cast<std::uint8_t>(line[x + 1] + predictor);
+    }
+  }
+  return true;
+}
+
+// Smooth gradients with a noisy band, so every filter type wins somewhere.
+manim_cpp::renderer::FrameBuffer test_frame(const std::size_t width, const std::size_t height) {
+  manim_cpp::renderer::FrameBuffer frame(width, height);
+  std::mt19937 generator(7);
+  std::uniform_int_distribution<int> noise(0, 255);
+  for (std::size_t y = 0; y < height; ++y) {
+    for (std::size_t x = 0; x < width; ++x) {
+      std::uint8_t* pixel = frame.row(y) + x * 4;
+      const bool noisy = y % 17 == 3;
+      pixel[0] = static_cast<std::uint8_t>(noisy ? noise(generator) : x * 3);
+      pixel[1] = static_cast<std::uint8_t>(y * 2 + x);
+      pixel[2] = static_cast<std::uint8_t>((x * y) / 7);
+      pixel[3] = 255;
+    }
+  }
+  return frame;
+}
+
+}  // namespace
+
+TEST(PngEncoder, RoundTripsThroughZlibAtAnyWorkerCount) {
+  const auto frame = test_frame(203, 157);
+  manim_cpp::renderer::PngEncoder serial({.chunk_bytes = 32 * 1024, .worker_count = 1});
+  manim_cpp::renderer::PngEncoder parallel({.chunk_bytes = 32 * 1024, .worker_count = 4});
+  const auto serial_png = serial.encode(frame);
+  const auto parallel_png = parallel.encode(frame);
+  ASSERT_FALSE(serial_png.empty());
+  EXPECT_EQ(serial_png, parallel_png);
+
+  manim_cpp::renderer::FrameBuffer decoded;
+  ASSERT_TRUE(decode_png(parallel_png, &decoded));
+  ASSERT_EQ(decoded.width(), frame.width());
+  ASSERT_EQ(decoded.height(), frame.height());
+  EXPECT_TRUE(std::equal(frame.data(), frame.data() + frame.byte_size(), decoded.data()));
+
+  // Re-encoding with the same encoder reuses its buffers.
+  EXPECT_EQ(parallel.encode(frame), parallel_png);
+  EXPECT_EQ(manim_cpp::renderer::encode_png(frame),
+            manim_cpp::renderer::PngEncoder().encode(frame));
+}
+
+TEST(PngEncoder, UnfilteredModeAndEveryLevelDecode) {
+  const auto frame = test_frame(37, 11);
+  for (const int level : {0, 1, 6, 9}) {
+    for (const bool adaptive : {false, true}) {
+      manim_cpp::renderer::PngEncoder encoder(
+          {.compression_level = level, .adaptive_filters = adaptive, .worker_count = 2});
+      manim_cpp::renderer::FrameBuffer decoded;
+      ASSERT_TRUE(decode_png(encoder.encode(frame), &decoded)) << level;
+      EXPECT_TRUE(std::equal(frame.data(), frame.data() + frame.byte_size(), decoded.data()));
+    }
+  }
+}
+
+TEST(PngEncoder, SelectsTheCheapestFilterPerRow) {
+  constexpr std::size_t kStride = 4 * 21;
+  std::vector<std::uint8_t> ramp(kStride);
+  std::vector<std::uint8_t> flat(kStride, 200);
+  for (std::size_t x = 0; x < kStride; ++x) {
+    ramp[x] = static_cast<std::uint8_t>(100 + x / 4);
+  }
+  std::vector<std::uint8_t> output(kStride + 1);
+
+  // A horizontal ramp is constant under sub.
+  EXPECT_EQ(manim_cpp::renderer::png_filter_row(ramp.data(), nullptr, kStride, output.data()),
+            1);
+  EXPECT_EQ(output[0], 1);
+  EXPECT_EQ(output[kStride], 1);
+  // A repeated row is all zeros under up.
+  EXPECT_EQ(manim_cpp::renderer::png_filter_row(ramp.data(), ramp.data(), kStride,
+                                                output.data()),
+            2);
+  EXPECT_EQ(output[kStride / 2], 0);
+  // Zeros stay unfiltered.
+  const std::vector<std::uint8_t> zeros(kStride, 0);
+  EXPECT_EQ(manim_cpp::renderer::png_filter_row(zeros.data(), flat.data(), kStride,
+                                                output.data()),
+            0);
+}
+
+TEST(PngEncoder, EmptyFrameEncodesToNothing) {
+  manim_cpp::renderer::PngEncoder encoder;
+  EXPECT_TRUE(encoder.encode(manim_cpp::renderer::FrameBuffer{}).empty());
+}
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/math/polygon_boolean.hpp"
+
+namespace {
+
+using manim_cpp::math::BooleanOperation;
+using manim_cpp::math::Vec2;
+using Rings = std::vector<std::vector<Vec2>>;
+
+double signed_area(const std::vector<Vec2>& ring) {
+  double sum = 0.0;
+  for (size_t i = 0; i < ring.size(); ++i) {
+    const auto& a = ring[i];
+    const auto& b = ring[(i + 1) % ring.size()];
+    sum += (a[0] * b[1]) - (b[0] * a[1]);
+  }
+  return sum * 0.5;
+}
+
+// Holes wind clockwise, so they subtract.
+double total_area(const Rings& rings) {
+  double sum = 0.0;
+  for (const auto& ring : rings) {
+    sum += signed_area(ring);
+  }
+  return sum;
+}
+
+// Whether `point` lies inside `rings` under the even-odd rule.
+bool contains(const Rings& rings, const Vec2& point) {
+  bool inside = false;
+  for (const auto& ring : rings) {
+    for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+      const auto& a = ring[i];
+      const auto& b = ring[j];
+      if ((a[1] > point[1]) != (b[1] > point[1]) &&
+          point[0] < (b[0] - a[0]) * (point[1] - a[1]) / (b[1] - a[1]) + a[0]) {
+        inside = !inside;
+      }
+    }
+  }
+  return inside;
+}
+
+std::vector<Vec2> square(const double x, const double y, const double size) {
+  return {{x, y}, {x + size, y}, {x + size, y + size}, {x, y + size}};
+}
+
+}  // namespace
+
+TEST(PolygonBoolean, CombinesOverlappingSquares) {
+  const Rings a = {square(0.0, 0.0, 2.0)};
+  const Rings b = {square(1.0, 1.0, 2.0)};
+
+  const auto intersection = manim_cpp::math::polygon_boolean(a, b, BooleanOperation::kIntersection);
+  ASSERT_EQ(intersection.size(), 1U);
+  EXPECT_EQ(intersection[0].size(), 4U);
+  EXPECT_DOUBLE_EQ(total_area(intersection), 1.0);
+
+  const auto united = manim_cpp::math::polygon_boolean(a, b, BooleanOperation::kUnion);
+  ASSERT_EQ(united.size(), 1U);
+  EXPECT_EQ(united[0].size(), 8U);
+  EXPECT_DOUBLE_EQ(total_area(united), 7.0);
+
+  EXPECT_DOUBLE_EQ(
+      total_area(manim_cpp::math::polygon_boolean(a, b, BooleanOperation::kDifference)), 3.0);
+  EXPECT_DOUBLE_EQ(total_area(manim_cpp::math::polygon_boolean(a, b, BooleanOperation::kXor)),
+                   6.0);
+}
+
+TEST(PolygonBoolean, DifferenceLeavesClockwiseHole) {
+  const Rings outer = {square(0.0, 0.0, 4.0)};
+  const Rings inner = {square(1.0, 1.0, 2.0)};
+
+  const auto result = manim_cpp::math::polygon_boolean(outer, inner, BooleanOperation::kDifference);
+  ASSERT_EQ(result.size(), 2U);
+  int holes = 0;
+  for (const auto& ring : result) {
+    holes += signed_area(ring) < 0.0 ? 1 : 0;
+  }
+  EXPECT_EQ(holes, 1);
+  EXPECT_DOUBLE_EQ(total_area(result), 12.0);
+}
+
+TEST(PolygonBoolean, MergesSquaresSharingAnEdge) {
+  // Clockwise input comes out counter-clockwise, without the shared edge's
+  // end points.
+  std::vector<Vec2> right = square(1.0, 0.0, 1.0);
+  std::reverse(right.begin(), right.end());
+
+  const auto result = manim_cpp::math::polygon_boolean({square(0.0, 0.0, 1.0)}, {right},
+                                                       BooleanOperation::kUnion);
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_EQ(result[0].size(), 4U);
+  EXPECT_DOUBLE_EQ(signed_area(result[0]), 2.0);
+}
+
+TEST(PolygonBoolean, UsesEvenOddRuleForInputRings) {
+  // The inner ring of the subject is a hole, whatever its winding; the
+  // bow tie's lobes are both filled.
+  const Rings frame = {square(0.0, 0.0, 4.0), square(1.0, 1.0, 2.0)};
+  const Rings bow_tie = {{{0.0, 0.0}, {4.0, 4.0}, {4.0, 0.0}, {0.0, 4.0}}};
+
+  const auto intersection =
+      manim_cpp::math::polygon_boolean(frame, bow_tie, BooleanOperation::kIntersection);
+  EXPECT_NEAR(total_area(intersection), 8.0 - 2.0, 1e-12);
+  const auto united = manim_cpp::math::polygon_boolean(frame, bow_tie, BooleanOperation::kUnion);
+  EXPECT_NEAR(total_area(united), 12.0 + 2.0, 1e-12);
+}
+
+TEST(PolygonBoolean, HandlesEmptyAndDisjointInput) {
+  const Rings a = {square(0.0, 0.0, 1.0)};
+  const Rings far = {square(5.0, 5.0, 1.0)};
+
+  EXPECT_TRUE(manim_cpp::math::polygon_boolean(a, {}, BooleanOperation::kIntersection).empty());
+  EXPECT_TRUE(manim_cpp::math::polygon_boolean({}, a, BooleanOperation::kDifference).empty());
+  EXPECT_TRUE(manim_cpp::math::polygon_boolean(a, far, BooleanOperation::kIntersection).empty());
+  EXPECT_EQ(manim_cpp::math::polygon_boolean({}, a, BooleanOperation::kUnion).size(), 1U);
+
+  const auto both = manim_cpp::math::polygon_boolean(a, far, BooleanOperation::kXor);
+  EXPECT_EQ(both.size(), 2U);
+  EXPECT_DOUBLE_EQ(total_area(both), 2.0);
+}
+
+TEST(PolygonBoolean, MatchesEvenOddOracleWhereRingsCrossVerticalEdges) {
+  // The subject crosses its own vertical edge, and the clip's top edge
+  // crosses it too.
+  const Rings a = {{{1.0, 5.0}, {5.0, 4.0}, {0.0, 0.0}, {1.0, 0.0}}};
+  const Rings b = {{{0.3, 0.2}, {4.7, 0.4}, {4.4, 4.6}, {0.1, 4.1}}};
+
+  const auto united = manim_cpp::math::polygon_boolean(a, b, BooleanOperation::kUnion);
+  const auto intersection = manim_cpp::math::polygon_boolean(a, b, BooleanOperation::kIntersection);
+  // 8.8 for the subject's two lobes, 17.705 for the clip.
+  EXPECT_NEAR(total_area(united) + total_area(intersection), 8.8 + 17.705, 1e-9);
+
+  for (const auto operation : {BooleanOperation::kUnion, BooleanOperation::kIntersection,
+                               BooleanOperation::kDifference, BooleanOperation::kXor}) {
+    const auto result = manim_cpp::math::polygon_boolean(a, b, operation);
+    for (int i = 0; i < 60; ++i) {
+      for (int j = 0; j < 60; ++j) {
+        const Vec2 point = {0.0137 + i * 0.0853, 0.0071 + j * 0.0853};
+        const bool in_a = contains(a, point);
+        const bool in_b = contains(b, point);
+        bool expected = false;
+        switch (operation) {
+          case BooleanOperation::kUnion:
+            expected = in_a || in_b;
+            break;
+          case BooleanOperation::kIntersection:
+            expected = in_a && in_b;
+            break;
+          case BooleanOperation::kDifference:
+            expected = in_a && !in_b;
+            break;
+          case BooleanOperation::kXor:
+            expected = in_a != in_b;
+            break;
+        }
+        EXPECT_EQ(contains(result, point), expected)
+            << "operation " << static_cast<int>(operation) << " at " << point[0] << ", "
+            << point[1];
+      }
+    }
+  }
+}
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/renderer/qoi_encoder.hpp"
+
+namespace {
+
+// Reference decoder following the QOI specification; returns RGBA pixels.
+std::vector<std::uint8_t> decode_qoi(const std::vector<std::uint8_t>& bytes,
+                                     std::size_t* width,
+                                     std::size_t* height,
+                                     std::size_t* channels) {
+  const auto u32 = [&](const std::size_t offset) {
+    return (static_cast<std::uint32_t>(bytes[offset]) << 24U) |
+           (static_cast<std::uint32_t>(bytes[offset + 1]) << 16U) |
+           (static_cast<std::uint32_t>(bytes[offset + 2]) << 8U) |
+           static_cast<std::uint32_t>(bytes[offset + 3]);
+  };
+  *width = u32(4);
+  *height = u32(8);
+  *channels = bytes[12];
+  std::array<std::array<std::uint8_t, 4>, 64> seen{};
+  std::array<std::uint8_t, 4> pixel = {0, 0, 0, 255};
+  std::vector<std::uint8_t> output;
+  std::size_t cursor = 14;
+  int run = 0;
+  for (std::size_t index = 0; index < *width * *height; ++index) {
+    if (run > 0) {
+      --run;
+    } else {
+      const std::uint8_t op = bytes[cursor++];
+      if (op == 0xFE) {
+        pixel[0] = bytes[cursor++];
+        pixel[1] = bytes[cursor++];
+        pixel[2] = bytes[cursor++];
+      } else if (op == 0xFF) {
+        for (auto& channel : pixel) {
+          channel = bytes[cursor++];
+        }
+      } else if ((op & 0xC0) == 0x00) {
+        pixel = seen[op];
+      } else if ((op & 0xC0) == 0x40) {
+        pixel[0] = static_cast<std::uint8_t>(pixel[0] + ((op >> 4) & 3) - 2);
+        pixel[1] = static_cast<std::uint8_t>(pixel[1] + ((op >> 2) & 3) - 2);
+        pixel[2] = static_cast<std::uint8_t>(pixel[2] + (op & 3) - 2);
+      } else if ((op & 0xC0) == 0x80) {
+        const int dg = (op & 0x3F) - 32;
+        const std::uint8_t next = bytes[cursor++];
+        pixel[0] = static_cast<std::uint8_t>(pixel[0] + dg - 8 + ((next >> 4) & 0x0F));
+        pixel[1] = static_cast<std::uint8_t>(pixel[1] + dg);
+        pixel[2] = static_cast<std::uint8_t>(pixel[2] + dg - 8 + (next & 0x0F));
+      } else {
+        run = op & 0x3F;
+      }
+      seen[(pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % 64] = pixel;
+    }
+    output.insert(output.end(), pixel.begin(), pixel.end());
+  }
+  EXPECT_EQ(cursor + 8, bytes.size());
+  return output;
+}
+
+}  // namespace
+
+TEST(QoiEncoder, RoundTripsRgbaAndRgbImages) {
+  std::mt19937 generator(11);
+  std::uniform_int_distribution<int> noise(0, 255);
+  std::uniform_int_distribution<int> step(-3, 3);
+  for (const std::size_t channels : {std::size_t{3}, std::size_t{4}}) {
+    const std::size_t width = 37;
+    const std::size_t height = 23;
+    std::vector<std::uint8_t> pixels(width * height * channels);
+    // Flat runs, small gradients and noise exercise every opcode.
+    int value = 128;
+    for (std::size_t index = 0; index < pixels.size(); ++index) {
+      const std::size_t pixel = index / channels;
+      if (pixel < 200) {
+        pixels[index] = 40;
+      } else if (pixel < 500) {
+        value = std::clamp(value + step(generator), 0, 255);
+        pixels[index] = static_cast<std::uint8_t>(value);
+      } else {
+        pixels[index] = static_cast<std::uint8_t>(noise(generator));
+      }
+    }
+
+    const auto encoded =
+        manim_cpp::renderer::encode_qoi(pixels.data(), width, height, channels);
+    ASSERT_GT(encoded.size(), static_cast<std::size_t>(22));
+    EXPECT_EQ(encoded[0], 'q');
+    std::size_t decoded_width = 0;
+    std::size_t decoded_height = 0;
+    std::size_t decoded_channels = 0;
+    const auto decoded = decode_qoi(encoded, &decoded_width, &decoded_height, &decoded_channels);
+    EXPECT_EQ(decoded_width, width);
+    EXPECT_EQ(decoded_height, height);
+    EXPECT_EQ(decoded_channels, channels);
+    ASSERT_EQ(decoded.size(), width * height * 4);
+    for (std::size_t pixel = 0; pixel < width * height; ++pixel) {
+      for (std::size_t channel = 0; channel < 4; ++channel) {
+        const std::uint8_t expected =
+            channel < channels ? pixels[pixel * channels + channel] : std::uint8_t{255};
+        ASSERT_EQ(decoded[pixel * 4 + channel], expected) << pixel << " " << channel;
+      }
+    }
+  }
+}
+
+TEST(QoiEncoder, CompressesFlatImagesToRuns) {
+  const std::vector<std::uint8_t> pixels(640 * 360 * 4, 0);
+  const auto encoded = manim_cpp::renderer::encode_qoi(pixels.data(), 640, 360, 4);
+  // One RGBA op for the transparent colour, then 62-pixel runs.
+  EXPECT_LT(encoded.size(), static_cast<std::size_t>(4000));
+}
+
+TEST(QoiEncoder, RejectsInvalidImages) {
+  const std::vector<std::uint8_t> pixels(16, 0);
+  EXPECT_TRUE(manim_cpp::renderer::encode_qoi(pixels.data(), 0, 2, 4).empty());
+  EXPECT_TRUE(manim_cpp::renderer::encode_qoi(pixels.data(), 2, 2, 2).empty());
+  EXPECT_TRUE(manim_cpp::renderer::encode_qoi(nullptr, 2, 2, 4).empty());
+}
@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/renderer/cairo_renderer.hpp"
+#include "manim_cpp/renderer/draw_list.hpp"
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/image_io.hpp"
+#include "manim_cpp/renderer/rasterizer.hpp"
+#include "manim_cpp/renderer/thread_pool.hpp"
+
+namespace {
+
+manim_cpp::renderer::RasterSettings small_settings() {
+  return manim_cpp::renderer::RasterSettings{
+      .pixel_width = 80,
+      .pixel_height = 80,
+      .frame_height = 8.0,
+      .tile_size = 16,
+  };
+}
+
+}  // namespace
+
+TEST(ThreadPool, ParallelForRunsEveryTaskExactlyOnce) {
+  manim_cpp::renderer::WorkStealingThreadPool pool(4);
+  EXPECT_EQ(pool.worker_count(), 4U);
+
+  std::vector<std::atomic<int>> hits(257);
+  pool.parallel_for(hits.size(), [&](const std::size_t index) { ++hits[index]; });
+  for (const auto& hit : hits) {
+    EXPECT_EQ(hit.load(), 1);
+  }
+
+  std::atomic<std::size_t> sum{0};
+  pool.parallel_for(100, [&](const std::size_t index) { sum += index; });
+  EXPECT_EQ(sum.load(), 4950U);
+}
+
+TEST(ThreadPool, ParallelForRethrowsTaskException) {
+  manim_cpp::renderer::WorkStealingThreadPool pool(3);
+  EXPECT_THROW(pool.parallel_for(16,
+                                 [](const std::size_t index) {
+                                   if (index == 7) {
+                                     throw std::runtime_error("tile failed");
+                                   }
+                                 }),
+               std::runtime_error);
+
+  std::atomic<int> count{0};
+  pool.parallel_for(8, [&](const std::size_t) { ++count; });
+  EXPECT_EQ(count.load(), 8);
+}
+
+TEST(DrawList, FlattensMobjectsAndSkipsTransparentOnes) {
+  auto square = std::make_shared<manim_cpp::mobject::Square>(2.0);
+  auto hidden = std::make_shared<manim_cpp::mobject::Circle>(1.0);
+  hidden->set_opacity(0.0);
+  auto annulus = std::make_shared<manim_cpp::mobject::Annulus>(1.0, 2.0);
+
+  const auto draw_list = manim_cpp::renderer::build_draw_list({square, hidden, annulus});
+  ASSERT_EQ(draw_list.size(), 2U);
+  EXPECT_EQ(draw_list[0].rings.size(), 1U);
+  EXPECT_EQ(draw_list[0].rings[0].size(), 4U);
+  EXPECT_EQ(draw_list[1].rings.size(), 2U);
+  EXPECT_EQ(draw_list[1].fill_rule, manim_cpp::renderer::FillRule::kEvenOdd);
+}
+
+TEST(TileRasterizer, FillsSquareInsideFrameCoordinates) {
+  auto square = std::make_shared<manim_cpp::mobject::Square>(2.0);
+  const auto draw_list = manim_cpp::renderer::build_draw_list({square});
+
+  manim_cpp::renderer::TileRasterizer rasterizer(2);
+  manim_cpp::renderer::FrameBuffer frame;
+  rasterizer.render(draw_list, small_settings(), &frame);
+
+  ASSERT_EQ(frame.width(), 80U);
+  ASSERT_EQ(frame.height(), 80U);
+  const manim_cpp::renderer::Rgba8 white{255, 255, 255, 255};
+  const manim_cpp::renderer::Rgba8 black{0, 0, 0, 255};
+  EXPECT_EQ(frame.pixel(40, 40), white);
+  EXPECT_EQ(frame.pixel(30, 30), white);
+  EXPECT_EQ(frame.pixel(49, 49), white);
+  EXPECT_EQ(frame.pixel(29, 40), black);
+  EXPECT_EQ(frame.pixel(50, 40), black);
+  EXPECT_EQ(frame.pixel(5, 5), black);
+}
+
+TEST(TileRasterizer, EvenOddRingsLeaveAnnulusHoleEmpty) {
+  auto annulus = std::make_shared<manim_cpp::mobject::Annulus>(1.0, 2.0);
+  const auto draw_list = manim_cpp::renderer::build_draw_list({annulus});
+
+  manim_cpp::renderer::TileRasterizer rasterizer(2);
+  manim_cpp::renderer::FrameBuffer frame;
+  rasterizer.render(draw_list, small_settings(), &frame);
+
+  EXPECT_EQ(frame.pixel(40, 40), (manim_cpp::renderer::Rgba8{0, 0, 0, 255}));
+  EXPECT_EQ(frame.pixel(55, 40), (manim_cpp::renderer::Rgba8{255, 255, 255, 255}));
+}
+
+TEST(TileRasterizer, OpacityBlendsOverBackgroundAndEdgesAreAntialiased) {
+  auto circle = std::make_shared<manim_cpp::mobject::Circle>(1.05);
+  circle->set_opacity(0.5);
+  const auto draw_list = manim_cpp::renderer::build_draw_list({circle});
+
+  manim_cpp::renderer::TileRasterizer rasterizer(1);
+  manim_cpp::renderer::FrameBuffer frame;
+  rasterizer.render(draw_list, small_settings(), &frame);
+
+  EXPECT_EQ(frame.pixel(40, 40).r, 128);
+  const auto edge = frame.pixel(50, 40);
+  EXPECT_GT(edge.r, 0);
+  EXPECT_LT(edge.r, 128);
+}
+
+TEST(TileRasterizer, ClampsExtremeBoundsAndSkipsNonFinitePoints) {
+  constexpr double kHuge = 1.0e300;
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double inf = std::numeric_limits<double>::infinity();
+  const manim_cpp::renderer::Rgba8 red{255, 0, 0, 255};
+  const manim_cpp::renderer::Rgba8 green{0, 255, 0, 255};
+  const manim_cpp::renderer::DrawList draw_list = {
+      {.rings = {{{-kHuge, -kHuge}, {kHuge, -kHuge}, {kHuge, kHuge}, {-kHuge, kHuge}}},
+       .color = red},
+      {.rings = {{{-1.0, -1.0}, {nan, -1.0}, {1.0, 1.0}, {-1.0, 1.0}}}, .color = green},
+      {.rings = {{{-1.0, -1.0}, {inf, -1.0}, {1.0, 1.0}, {-1.0, 1.0}}}, .color = green},
+  };
+
+  manim_cpp::renderer::TileRasterizer rasterizer(2);
+  manim_cpp::renderer::FrameBuffer frame;
+  rasterizer.render(draw_list, small_settings(), &frame);
+
+  EXPECT_EQ(frame.pixel(0, 0), red);
+  EXPECT_EQ(frame.pixel(40, 40), red);
+  EXPECT_EQ(frame.pixel(79, 79), red);
+}
+
+TEST(TileRasterizer, OutputIsIndependentOfWorkerCountAndTileSize) {
+  std::vector<std::shared_ptr<manim_cpp::mobject::Mobject>> mobjects;
+  for (int i = 0; i < 6; ++i) {
+    auto circle = std::make_shared<manim_cpp::mobject::Circle>(0.3 + (0.2 * i));
+    circle->move_to({-2.5 + i, 0.5 * (i % 3), 0.0});
+    circle->set_opacity(0.4);
+    mobjects.push_back(circle);
+  }
+  const auto draw_list = manim_cpp::renderer::build_draw_list(mobjects);
+
+  auto settings = small_settings();
+  settings.pixel_width = 160;
+  manim_cpp::renderer::TileRasterizer serial(1);
+  manim_cpp::renderer::FrameBuffer serial_frame;
+  serial.render(draw_list, settings, &serial_frame);
+
+  settings.tile_size = 24;
+  manim_cpp::renderer::TileRasterizer parallel(4);
+  manim_cpp::renderer::FrameBuffer parallel_frame;
+  parallel.render(draw_list, settings, &parallel_frame);
+
+  ASSERT_EQ(serial_frame.byte_size(), parallel_frame.byte_size());
+  EXPECT_TRUE(std::equal(serial_frame.data(), serial_frame.data() + serial_frame.byte_size(),
+                         parallel_frame.data()));
+}
+
+TEST(TileRasterizer, CairoRendererRendersMobjectsIntoPng) {
+  manim_cpp::renderer::CairoRenderer renderer;
+  manim_cpp::renderer::FrameBuffer frame;
+  renderer.render_frame({std::make_shared<manim_cpp::mobject::Dot>(0.5)}, small_settings(),
+                        &frame);
+  EXPECT_EQ(frame.pixel(40, 40), (manim_cpp::renderer::Rgba8{255, 255, 255, 255}));
+
+  const auto png = manim_cpp::renderer::encode_png(frame);
+  ASSERT_GT(png.size(), 8U);
+  EXPECT_EQ(png[0], 0x89);
+  EXPECT_EQ(png[1], 'P');
+  EXPECT_EQ(png[2], 'N');
+  EXPECT_EQ(png[3], 'G');
+  EXPECT_TRUE(manim_cpp::renderer::encode_png(manim_cpp::renderer::FrameBuffer{}).empty());
+}
@@ -0,0 +1,119 @@
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/animation/basic_animations.hpp"
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/renderer/cairo_renderer.hpp"
+#include "manim_cpp/scene/frame_pipeline.hpp"
+#include "manim_cpp/scene/render_farm.hpp"
+#include "manim_cpp/scene/scene.hpp"
+#include "manim_cpp/scene/scene_file_writer.hpp"
+#include "manim_cpp/scene/scene_timeline.hpp"
+
+namespace {
+
+class FarmScene : public manim_cpp::scene::Scene {
+ public:
+  std::string scene_name() const override { return "FarmScene"; }
+  void construct() override {
+    auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+    add(square);
+    manim_cpp::animation::MoveToAnimation move(square, {2.0, 0.0, 0.0});
+    play(move, 6);
+    wait(0.5);
+  }
+};
+
+std::filesystem::path make_temp_dir(const std::string& name) {
+  const auto path = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(path);
+  std::filesystem::create_directories(path);
+  return path;
+}
+
+std::string read_file(const std::filesystem::path& path) {
+  std::ifstream input(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+}
+
+manim_cpp::scene::FramePipelineSettings pipeline_settings(std::filesystem::path images_dir) {
+  return {
+      .raster_settings = {.pixel_width = 48, .pixel_height = 27},
+      .images_dir = std::move(images_dir),
+      .frame_file_name = nullptr,
+  };
+}
+
+}  // namespace
+
+TEST(RenderFarm, WorkersRenderTheSameFramesAsASingleProcess) {
+  const auto root = make_temp_dir("manim_cpp_render_farm");
+  const auto serial_dir = root / "serial";
+  const auto farm_dir = root / "farm";
+  std::filesystem::create_directories(serial_dir);
+  std::filesystem::create_directories(farm_dir);
+
+  FarmScene serial_scene;
+  serial_scene.set_render_settings({.pixel_width = 48, .pixel_height = 27}, 12.0);
+  manim_cpp::scene::SceneFileWriter serial_writer(serial_scene.scene_name());
+  manim_cpp::scene::FramePipeline pipeline(pipeline_settings(serial_dir));
+  ASSERT_TRUE(pipeline.run(serial_scene, serial_writer)) << pipeline.error();
+
+  FarmScene farm_scene;
+  farm_scene.set_render_settings({.pixel_width = 48, .pixel_height = 27}, 12.0);
+  const auto timeline = manim_cpp::scene::SceneTimeline::compile(farm_scene);
+  manim_cpp::scene::SceneFileWriter writer(farm_scene.scene_name());
+  writer.set_partial_movie_dir(root);
+  // Its I/O threads must not be running when the workers fork.
+  writer.enable_async_frame_writes({});
+  manim_cpp::scene::RenderFarm farm({
+      .worker_count = 3,
+      .pipeline = pipeline_settings(farm_dir),
+      .worker_dir = root / "workers",
+  });
+  ASSERT_TRUE(farm.run(timeline, farm_scene.scene_name(), writer)) << farm.error();
+
+  ASSERT_EQ(farm.frame_count(), serial_scene.emitted_frame_count());
+  ASSERT_EQ(farm.workers().size(), static_cast<std::size_t>(3));
+  for (std::size_t index = 1; index <= farm.frame_count(); ++index) {
+    const auto name = manim_cpp::renderer::CairoRenderer().frame_file_name("FarmScene", index);
+    ASSERT_TRUE(std::filesystem::exists(farm_dir / name)) << name;
+    EXPECT_EQ(read_file(farm_dir / name), read_file(serial_dir / name)) << name;
+  }
+
+  EXPECT_NE(writer.async_frame_writer(), nullptr);
+
+  // Worker partial movies are stitched into the writer in frame order, named
+  // relative to its partial movie dir.
+  const auto& partials = writer.sections().back().partial_movie_files();
+  ASSERT_EQ(partials.size(), farm.workers().size());
+  for (std::size_t worker = 0; worker < partials.size(); ++worker) {
+    EXPECT_EQ(partials[worker],
+              "workers/" + farm.workers()[worker].partial_movie_file.filename().string());
+    EXPECT_TRUE(std::filesystem::exists(farm.workers()[worker].partial_movie_file));
+    EXPECT_EQ(farm.workers()[worker].frame_count, farm.workers()[worker].range.size());
+  }
+
+  std::filesystem::remove_all(root);
+}
+
+TEST(RenderFarm, ReportsFailedWorkers) {
+  const auto root = make_temp_dir("manim_cpp_render_farm_failure");
+  FarmScene scene;
+  scene.set_render_settings({.pixel_width = 48, .pixel_height = 27}, 12.0);
+  const auto timeline = manim_cpp::scene::SceneTimeline::compile(scene);
+  manim_cpp::scene::SceneFileWriter writer(scene.scene_name());
+  manim_cpp::scene::RenderFarm farm({
+      .worker_count = 2,
+      .pipeline = pipeline_settings(root / "missing" / "images"),
+      .worker_dir = root / "workers",
+  });
+  EXPECT_FALSE(farm.run(timeline, scene.scene_name(), writer));
+  EXPECT_NE(farm.error().find("Render worker 0 failed"), std::string::npos);
+  std::filesystem::remove_all(root);
+}
@@ -0,0 +1,190 @@
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/animation/basic_animations.hpp"
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/scene/registry.hpp"
+#include "manim_cpp/scene/scene.hpp"
+#include "manim_cpp/scene/scene_benchmark.hpp"
+
+namespace {
+
+class BenchmarkedScene : public manim_cpp::scene::Scene {
+ public:
+  std::string scene_name() const override { return "BenchmarkedScene"; }
+  void construct() override {
+    auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+    add(square);
+    add(std::make_shared<manim_cpp::mobject::Circle>(0.5));
+    manim_cpp::animation::ShiftAnimation shift(square, {1.0, 0.0, 0.0});
+    play(shift, 4);
+    wait(0.2);
+  }
+};
+
+MANIM_REGISTER_SCENE(BenchmarkedScene);
+
+std::filesystem::path make_temp_dir(const std::string& name) {
+  const auto path = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(path);
+  std::filesystem::create_directories(path);
+  return path;
+}
+
+manim_cpp::scene::SceneBenchmarkResult result_for(const std::string& scene_name,
+                                                  const std::size_t frames,
+                                                  const double median_wall_seconds,
+                                                  const std::uint64_t peak_rss_bytes) {
+  manim_cpp::scene::SceneBenchmarkResult result;
+  result.scene_name = scene_name;
+  result.runs = 3;
+  result.frames = frames;
+  result.median_wall_seconds = median_wall_seconds;
+  result.peak_rss_bytes = peak_rss_bytes;
+  return result;
+}
+
+}  // namespace
+
+TEST(SceneBenchmark, RendersEachRunAndRemovesItsFrames) {
+  const auto work_dir = make_temp_dir("manim_cpp_scene_benchmark");
+  manim_cpp::scene::SceneBenchmark benchmark({
+      .runs = 3,
+      .raster_settings = {.pixel_width = 32, .pixel_height = 18},
+      .frame_rate = 10.0,
+      .work_dir = work_dir,
+  });
+
+  ASSERT_TRUE(benchmark.run("BenchmarkedScene")) << benchmark.error();
+  ASSERT_EQ(benchmark.results().size(), 1U);
+  const auto& result = benchmark.results().front();
+  EXPECT_EQ(result.scene_name, "BenchmarkedScene");
+  EXPECT_EQ(result.runs, 3U);
+  EXPECT_EQ(result.frames, 15U);
+  EXPECT_GT(result.median_wall_seconds, 0.0);
+  EXPECT_LE(result.min_wall_seconds, result.median_wall_seconds);
+  EXPECT_GE(result.max_wall_seconds, result.median_wall_seconds);
+  EXPECT_GT(result.frames_per_second, 0.0);
+  EXPECT_EQ(result.stages[0].name, "evaluate");
+  EXPECT_EQ(result.stages[1].name, "rasterize");
+  EXPECT_EQ(result.stages[2].name, "encode");
+  EXPECT_GT(result.peak_rss_bytes, 0U);
+  EXPECT_FALSE(std::filesystem::exists(work_dir));
+
+  EXPECT_FALSE(benchmark.run("MissingBenchmarkScene"));
+  EXPECT_EQ(benchmark.error(), "Unknown scene: MissingBenchmarkScene");
+  EXPECT_EQ(benchmark.results().size(), 1U);
+}
+
+TEST(SceneBenchmark, ReportRoundTripsThroughJson) {
+  auto result = result_for("Quoted\"Scene", 12, 0.125, 64ULL << 20U);
+  result.min_wall_seconds = 0.1;
+  result.max_wall_seconds = 0.25;
+  result.frames_per_second = 96.0;
+  result.stages[1] = {.name = "rasterize", .busy_seconds = 0.05, .output_wait_seconds = 0.01};
+  const manim_cpp::scene::SceneBenchmarkReport report{
+      .pixel_width = 854,
+      .pixel_height = 480,
+      .frame_rate = 15.0,
+      .scenes = {result, result_for("Second", 3, 2.5, 0)},
+  };
+  const auto path = make_temp_dir("manim_cpp_benchmark_report") / "report.json";
+  ASSERT_TRUE(manim_cpp::scene::write_benchmark_report(path, report));
+
+  const auto loaded = manim_cpp::scene::read_benchmark_report(path);
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_EQ(loaded->pixel_width, 854U);
+  EXPECT_EQ(loaded->pixel_height, 480U);
+  EXPECT_DOUBLE_EQ(loaded->frame_rate, 15.0);
+  ASSERT_EQ(loaded->scenes.size(), 2U);
+  const auto& first = loaded->scenes[0];
+  EXPECT_EQ(first.scene_name, "Quoted\"Scene");
+  EXPECT_EQ(first.runs, 3U);
+  EXPECT_EQ(first.frames, 12U);
+  EXPECT_DOUBLE_EQ(first.median_wall_seconds, 0.125);
+  EXPECT_DOUBLE_EQ(first.min_wall_seconds, 0.1);
+  EXPECT_DOUBLE_EQ(first.max_wall_seconds, 0.25);
+  EXPECT_DOUBLE_EQ(first.frames_per_second, 96.0);
+  EXPECT_EQ(first.peak_rss_bytes, 64ULL << 20U);
+  EXPECT_EQ(first.stages[1].name, "rasterize");
+  EXPECT_DOUBLE_EQ(first.stages[1].busy_seconds, 0.05);
+  EXPECT_DOUBLE_EQ(first.stages[1].output_wait_seconds, 0.01);
+  EXPECT_EQ(loaded->scenes[1].scene_name, "Second");
+  EXPECT_DOUBLE_EQ(loaded->scenes[1].median_wall_seconds, 2.5);
+
+  EXPECT_FALSE(manim_cpp::scene::read_benchmark_report(path.parent_path() / "missing.json"));
+}
+
+TEST(SceneBenchmark, ComparisonFlagsRegressionsOverThreshold) {
+  const manim_cpp::scene::SceneBenchmarkReport baseline{
+      .scenes = {result_for("Steady", 10, 1.0, 100),
+                 result_for("Slower", 10, 1.0, 100),
+                 result_for("Heavier", 10, 1.0, 100),
+                 result_for("Longer", 10, 1.0, 100)},
+  };
+  const manim_cpp::scene::SceneBenchmarkReport current{
+      .scenes = {result_for("Steady", 10, 1.05, 90),
+                 result_for("Slower", 10, 1.5, 100),
+                 result_for("Heavier", 10, 0.5, 200),
+                 result_for("Longer", 12, 1.0, 100),
+                 result_for("New", 10, 1.0, 100)},
+  };
+
+  const auto comparison = manim_cpp::scene::compare_benchmarks(baseline, current, 0.1);
+  EXPECT_FALSE(comparison.passed());
+  ASSERT_EQ(comparison.regressions.size(), 3U);
+  EXPECT_EQ(comparison.regressions[0].scene_name, "Slower");
+  EXPECT_EQ(comparison.regressions[0].metric, "wall_seconds");
+  EXPECT_DOUBLE_EQ(comparison.regressions[0].change, 0.5);
+  EXPECT_EQ(comparison.regressions[1].scene_name, "Heavier");
+  EXPECT_EQ(comparison.regressions[1].metric, "peak_rss_bytes");
+  EXPECT_EQ(comparison.regressions[2].scene_name, "Longer");
+  EXPECT_EQ(comparison.regressions[2].metric, "frames");
+  ASSERT_EQ(comparison.unmatched_scenes.size(), 1U);
+  EXPECT_EQ(comparison.unmatched_scenes[0], "New");
+
+  // A frame count change is flagged whatever the threshold.
+  EXPECT_EQ(manim_cpp::scene::compare_benchmarks(baseline, current, 1.0).regressions.size(), 1U);
+}
+
+TEST(SceneBenchmark, ComparisonFailsAcrossRenderSettings) {
+  const manim_cpp::scene::SceneBenchmarkReport baseline{
+      .pixel_width = 854,
+      .pixel_height = 480,
+      .frame_rate = 15.0,
+      .scenes = {result_for("Steady", 10, 1.0, 100)},
+  };
+  auto current = baseline;
+  EXPECT_TRUE(manim_cpp::scene::compare_benchmarks(baseline, current, 0.1).passed());
+
+  current.frame_rate = 30.0;
+  const auto comparison = manim_cpp::scene::compare_benchmarks(baseline, current, 0.1);
+  EXPECT_TRUE(comparison.render_settings_differ);
+  EXPECT_FALSE(comparison.passed());
+  EXPECT_TRUE(comparison.regressions.empty());
+
+  current.frame_rate = 15.0;
+  current.pixel_height = 360;
+  EXPECT_FALSE(manim_cpp::scene::compare_benchmarks(baseline, current, 0.1).passed());
+}
+
+TEST(SceneBenchmark, StartsEverySceneFromAnEmptyMeshCache) {
+  const auto work_dir = make_temp_dir("manim_cpp_scene_benchmark_mesh_cache");
+  manim_cpp::scene::SceneBenchmark benchmark({
+      .runs = 2,
+      .raster_settings = {.pixel_width = 32, .pixel_height = 18},
+      .frame_rate = 10.0,
+      .work_dir = work_dir,
+  });
+
+  ASSERT_TRUE(benchmark.run("BenchmarkedScene")) << benchmark.error();
+  ASSERT_TRUE(benchmark.run("BenchmarkedScene")) << benchmark.error();
+  const auto& first = benchmark.results()[0];
+  const auto& second = benchmark.results()[1];
+  EXPECT_GT(first.mesh_cache_misses, 0U);
+  EXPECT_EQ(second.mesh_cache_misses, first.mesh_cache_misses);
+  EXPECT_EQ(second.mesh_cache_hits, first.mesh_cache_hits);
+}
@@ -1,7 +1,12 @@
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -140,6 +145,63 @@ TEST(SceneFileWriter, AutoTracksDeterministicPartialMovieFilesFromAnimations) {
   EXPECT_EQ(files[1], std::string("DemoScene_partial_0002.mp4"));
 }
 
+TEST(SceneFileWriter, NamesHashedPartialMoviesAndDetectsCachedSegments) {
+  const auto partial_dir =
+      std::filesystem::temp_directory_path() / "manim_cpp_writer_partial_cache";
+  std::filesystem::remove_all(partial_dir);
+  std::filesystem::create_directories(partial_dir);
+  std::ofstream(partial_dir / "cafe.mp4") << "cached";
+
+  manim_cpp::scene::SceneFileWriter writer("DemoScene");
+  writer.set_partial_movie_dir(partial_dir);
+  EXPECT_TRUE(writer.is_partial_movie_cached("cafe"));
+  EXPECT_FALSE(writer.is_partial_movie_cached("beef"));
+
+  writer.begin_animation(true, "cafe");
+  writer.end_animation(true);
+  writer.begin_animation(true, "beef");
+  writer.end_animation(true);
+  writer.begin_animation(true, "beef");
+  writer.end_animation(true);
+
+  const auto& files = writer.sections()[0].partial_movie_files();
+  ASSERT_EQ(files.size(), static_cast<size_t>(3));
+  EXPECT_EQ(files[0], std::string("cafe.mp4"));
+  EXPECT_EQ(files[1], std::string("beef.mp4"));
+  EXPECT_EQ(writer.cached_animation_count(), static_cast<size_t>(1));
+  ASSERT_EQ(writer.uncached_partial_movie_files().size(), static_cast<size_t>(1));
+  EXPECT_EQ(writer.uncached_partial_movie_files()[0], std::string("beef.mp4"));
+
+  std::filesystem::remove_all(partial_dir);
+}
+
+TEST(SceneFileWriter, PrunesAndFlushesPartialMovieCache) {
+  const auto partial_dir =
+      std::filesystem::temp_directory_path() / "manim_cpp_writer_partial_prune";
+  std::filesystem::remove_all(partial_dir);
+  std::filesystem::create_directories(partial_dir);
+  const auto now = std::filesystem::file_time_type::clock::now();
+  for (int i = 0; i < 4; ++i) {
+    const auto path = partial_dir / ("segment_" + std::to_string(i) + ".mp4");
+    std::ofstream(path) << i;
+    std::filesystem::last_write_time(path, now - std::chrono::seconds(10 * (4 - i)));
+  }
+  std::ofstream(partial_dir / "notes.txt") << "keep";
+
+  manim_cpp::scene::SceneFileWriter writer("DemoScene");
+  writer.set_partial_movie_dir(partial_dir);
+  EXPECT_EQ(writer.prune_partial_movie_cache(2), static_cast<size_t>(2));
+  EXPECT_FALSE(std::filesystem::exists(partial_dir / "segment_0.mp4"));
+  EXPECT_FALSE(std::filesystem::exists(partial_dir / "segment_1.mp4"));
+  EXPECT_TRUE(std::filesystem::exists(partial_dir / "segment_3.mp4"));
+
+  EXPECT_EQ(writer.flush_partial_movie_cache(), static_cast<size_t>(2));
+  EXPECT_FALSE(std::filesystem::exists(partial_dir / "segment_3.mp4"));
+  EXPECT_TRUE(std::filesystem::exists(partial_dir / "notes.txt"));
+
+  std::filesystem::remove_all(partial_dir);
+}
+
 TEST(SceneFileWriter, SkipsAutoPartialMovieFilesWhenFramesAreDisabledOrSkipped) {
   manim_cpp::scene::SceneFileWriter writer("DemoScene");
   writer.begin_animation(false);
@@ -246,3 +308,53 @@ TEST(SceneFileWriter, ReturnsNulloptWhenOutputTemplateCannotBeResolved) {
       writer.resolve_output_paths(config, "demo_module", "1080p60");
   EXPECT_FALSE(paths.has_value());
 }
+
+TEST(SceneFileWriter, MergesWorkerManifests) {
+  const auto root = std::filesystem::temp_directory_path() / "manim_cpp_merge_manifest";
+  std::filesystem::remove_all(root);
+  std::filesystem::create_directories(root);
+  manim_cpp::scene::SceneFileWriter worker("Demo");
+  worker.add_partial_movie_file("Demo \"part\" 1.mp4");
+  worker.set_render_summary(7, 640, 360, 30.0, "mp4", std::nullopt);
+  ASSERT_TRUE(worker.write_media_manifest(root / "worker.json"));
+
+  manim_cpp::scene::SceneFileWriter coordinator("Demo");
+  const auto frames = coordinator.merge_media_manifest(root / "worker.json");
+  ASSERT_TRUE(frames.has_value());
+  EXPECT_EQ(frames.value(), static_cast<std::size_t>(7));
+  ASSERT_EQ(coordinator.sections().back().partial_movie_files().size(),
+            static_cast<std::size_t>(1));
+  EXPECT_EQ(coordinator.sections().back().partial_movie_files()[0], "Demo \"part\" 1.mp4");
+  EXPECT_FALSE(coordinator.merge_media_manifest(root / "missing.json").has_value());
+  std::filesystem::remove_all(root);
+}
+
+TEST(SceneFileWriter, QueuesFrameImagesOnAsyncWriter) {
+  const auto directory =
+      std::filesystem::temp_directory_path() / "manim_cpp_scene_file_writer_async";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory);
+
+  manim_cpp::scene::SceneFileWriter writer("TestScene");
+  writer.enable_async_frame_writes({.queue_depth = 2});
+  ASSERT_NE(writer.async_frame_writer(), nullptr);
+  const auto bytes = std::make_shared<const std::vector<std::uint8_t>>(
+      std::vector<std::uint8_t>{0x89, 'P', 'N', 'G'});
+  for (int index = 0; index < 5; ++index) {
+    ASSERT_TRUE(
+        writer.write_frame_image(directory / ("frame_" + std::to_string(index) + ".png"), bytes));
+  }
+  const std::vector<std::uint8_t> copied{1, 2, 3};
+  ASSERT_TRUE(writer.write_frame_image(directory / "copied.png", std::span(copied)));
+  ASSERT_TRUE(writer.flush_frame_images()) << writer.frame_write_error();
+  EXPECT_EQ(writer.written_frame_count(), 6u);
+  EXPECT_EQ(read_file(directory / "frame_4.png"), "\x89PNG");
+  EXPECT_EQ(read_file(directory / "copied.png"), "\x01\x02\x03");
+
+  ASSERT_TRUE(writer.write_frame_image(directory / "missing" / "frame.png", bytes) ||
+              !writer.frame_write_error().empty());
+  EXPECT_FALSE(writer.flush_frame_images());
+  EXPECT_NE(writer.frame_write_error().find("frame.png"), std::string::npos);
+  EXPECT_EQ(writer.written_frame_count(), 6u);
+  std::filesystem::remove_all(directory);
+}
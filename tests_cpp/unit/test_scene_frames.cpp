@@ -0,0 +1,89 @@
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/animation/basic_animations.hpp"
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/scene/scene.hpp"
+
+namespace {
+
+class WaitScene : public manim_cpp::scene::Scene {
+ public:
+  explicit WaitScene(double seconds) : seconds_(seconds) {}
+  void construct() override { wait(seconds_); }
+
+ private:
+  double seconds_ = 0.0;
+};
+
+class MovingSquareScene : public manim_cpp::scene::Scene {
+ public:
+  void construct() override {
+    auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+    add(square);
+    manim_cpp::animation::MoveToAnimation move(square, {2.0, 0.0, 0.0});
+    play(move, 4);
+  }
+};
+
+// Runs the scene and collects every frame it emits.
+std::vector<manim_cpp::scene::SceneFrame> collect_frames(manim_cpp::scene::Scene& scene) {
+  std::vector<manim_cpp::scene::SceneFrame> frames;
+  scene.set_frame_sink(
+      [&frames](manim_cpp::scene::SceneFrame frame) { frames.push_back(std::move(frame)); });
+  scene.run();
+  scene.set_frame_sink(nullptr);
+  return frames;
+}
+
+double first_ring_x(const manim_cpp::scene::SceneFrame& frame) {
+  return frame.draw_list.front().rings.front().front()[0];
+}
+
+}  // namespace
+
+TEST(SceneFrames, EmitsLlroundOfElapsedTimesFrameRateFrames) {
+  const std::vector<double> durations = {0.5, 1.0, 0.3, 2.0 / 3.0};
+  for (const double duration : durations) {
+    WaitScene scene(duration);
+    scene.set_render_settings({}, 24.0);
+    std::size_t count = 0;
+    for (const auto& frame : collect_frames(scene)) {
+      EXPECT_EQ(frame.index, count + 1);
+      EXPECT_DOUBLE_EQ(frame.time_seconds, static_cast<double>(count) / 24.0);
+      ++count;
+    }
+    EXPECT_EQ(count, static_cast<std::size_t>(std::llround(duration * 24.0)));
+    EXPECT_EQ(scene.emitted_frame_count(), count);
+  }
+
+  WaitScene still(0.0);
+  std::size_t still_count = 0;
+  for (const auto& frame : collect_frames(still)) {
+    EXPECT_EQ(frame.index, static_cast<std::size_t>(1));
+    ++still_count;
+  }
+  EXPECT_EQ(still_count, static_cast<std::size_t>(1));
+}
+
+TEST(SceneFrames, FramesSnapshotStateWhileTheSceneAdvances) {
+  MovingSquareScene scene;
+  scene.set_render_settings({}, 8.0);
+  std::vector<double> xs;
+  for (const auto& frame : collect_frames(scene)) {
+    ASSERT_EQ(frame.draw_list.size(), static_cast<std::size_t>(1));
+    xs.push_back(first_ring_x(frame));
+  }
+  // play(move, 4) lasts 1.25s: 10 frames across five interpolation steps.
+  ASSERT_EQ(xs.size(), static_cast<std::size_t>(10));
+  EXPECT_DOUBLE_EQ(xs.front(), -0.5);
+  EXPECT_DOUBLE_EQ(xs.back(), 1.5);
+  for (std::size_t i = 1; i < xs.size(); ++i) {
+    EXPECT_GE(xs[i], xs[i - 1]);
+  }
+}
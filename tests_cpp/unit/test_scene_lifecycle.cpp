@@ -1,3 +1,6 @@
+#include <cmath>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <vector>
@@ -5,8 +8,12 @@
 #include <gtest/gtest.h>
 
 #include "manim_cpp/animation/animation.hpp"
+#include "manim_cpp/animation/basic_animations.hpp"
+#include "manim_cpp/math/core.hpp"
+#include "manim_cpp/mobject/geometry.hpp"
 #include "manim_cpp/mobject/mobject.hpp"
 #include "manim_cpp/scene/scene.hpp"
+#include "manim_cpp/scene/scene_file_writer.hpp"
 
 namespace {
 
@@ -30,6 +37,9 @@ class AlphaRecordingAnimation : public manim_cpp::animation::Animation {
 
   void finish() override { finished = true; }
 
+  // Renders nothing, so its base hash is complete.
+  bool cacheable() const override { return true; }
+
   bool began = false;
   bool finished = false;
   std::vector<double> alphas;
@@ -74,6 +84,183 @@ TEST(SceneLifecycle, PlayDrivesAnimationAndUpdaters) {
   EXPECT_NEAR(scene.time_seconds(), 1.25, 1e-9);
 }
 
+TEST(SceneLifecycle, SegmentHashesTrackAnimationParametersAndStartingState) {
+  EmptyScene scene;
+  auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+  scene.add(square);
+
+  manim_cpp::animation::MoveToAnimation move_right(square, {1.0, 0.0, 0.0});
+  manim_cpp::animation::MoveToAnimation move_left(square, {-1.0, 0.0, 0.0});
+  const auto right_hash = scene.hash_play(move_right, 4);
+  EXPECT_EQ(right_hash.size(), static_cast<size_t>(32));
+  EXPECT_EQ(right_hash, scene.hash_play(move_right, 4));
+  EXPECT_NE(right_hash, scene.hash_play(move_left, 4));
+  EXPECT_NE(right_hash, scene.hash_play(move_right, 8));
+
+  move_right.set_run_time_seconds(2.0);
+  const auto slower_hash = scene.hash_play(move_right, 4);
+  EXPECT_NE(right_hash, slower_hash);
+
+  square->shift({0.0, 0.5, 0.0});
+  EXPECT_NE(slower_hash, scene.hash_play(move_right, 4));
+
+  const auto later_hash = scene.hash_play(move_right, 4);
+  scene.tick(0.5);
+  EXPECT_NE(later_hash, scene.hash_play(move_right, 4));
+  const auto unwritten_hash = scene.hash_play(move_right, 4);
+  scene.set_frame_output("images");
+  EXPECT_NE(unwritten_hash, scene.hash_play(move_right, 4));
+  scene.set_frame_output("");
+
+  const auto wait_hash = scene.hash_wait(1.0);
+  scene.set_render_settings(manim_cpp::renderer::RasterSettings{.pixel_width = 640,
+                                                                .pixel_height = 360},
+                            30.0);
+  EXPECT_NE(wait_hash, scene.hash_wait(1.0));
+}
+
+TEST(SceneLifecycle, SegmentHashesTrackRateFunctionsAndUpdaters) {
+  EmptyScene scene;
+  auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+  scene.add(square);
+  manim_cpp::animation::MoveToAnimation move(square, {1.0, 0.0, 0.0});
+  const auto linear_hash = scene.hash_play(move, 4);
+
+  // Agrees with the linear curve at every quarter of the run.
+  move.set_rate_function([](const double alpha) {
+    return alpha + 0.01 * std::sin(4.0 * manim_cpp::math::kPi * alpha);
+  });
+  const auto wobble_hash = scene.hash_play(move, 4);
+  EXPECT_NE(linear_hash, wobble_hash);
+
+  move.set_rate_function([](const double alpha) { return alpha * alpha; }, "ease_in");
+  const auto named_hash = scene.hash_play(move, 4);
+  EXPECT_NE(wobble_hash, named_hash);
+  move.set_rate_function([](const double alpha) { return alpha * alpha; }, "ease_in_quad");
+  EXPECT_NE(named_hash, scene.hash_play(move, 4));
+
+  scene.add_updater([square](const double dt) { square->shift({dt, 0.0, 0.0}); }, "drift");
+  const auto drift_hash = scene.hash_play(move, 4);
+  EXPECT_NE(named_hash, drift_hash);
+  scene.clear_updaters();
+  scene.add_updater([square](const double dt) { square->shift({0.0, dt, 0.0}); }, "rise");
+  EXPECT_NE(drift_hash, scene.hash_play(move, 4));
+}
+
+TEST(SceneLifecycle, UnkeyedUpdatersKeepSegmentsOutOfTheCache) {
+  const auto partial_dir =
+      std::filesystem::temp_directory_path() / "manim_cpp_scene_updater_cache";
+  std::filesystem::remove_all(partial_dir);
+  std::filesystem::create_directories(partial_dir);
+
+  auto run_once = [&](const std::string& cache_key) {
+    EmptyScene scene;
+    auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+    auto dot = std::make_shared<manim_cpp::mobject::Dot>();
+    scene.add(square);
+    scene.add(dot);
+    scene.add_updater([dot](const double dt) { dot->shift({0.0, dt, 0.0}); }, cache_key);
+    manim_cpp::scene::SceneFileWriter writer("UpdaterCacheScene");
+    writer.set_partial_movie_dir(partial_dir);
+    scene.set_file_writer(&writer);
+
+    manim_cpp::animation::MoveToAnimation move(square, {2.0, 0.0, 0.0});
+    scene.play(move, 4);
+    scene.wait(0.5);
+    for (const auto& file : writer.uncached_partial_movie_files()) {
+      std::ofstream(partial_dir / file) << "partial";
+    }
+    return writer.cached_animation_count();
+  };
+
+  EXPECT_EQ(run_once(""), static_cast<size_t>(0));
+  EXPECT_EQ(run_once(""), static_cast<size_t>(0));
+  EXPECT_EQ(run_once("rise"), static_cast<size_t>(0));
+  EXPECT_EQ(run_once("rise"), static_cast<size_t>(2));
+
+  std::filesystem::remove_all(partial_dir);
+}
+
+TEST(SceneLifecycle, CachedSegmentsFastForwardToTheSameEndState) {
+  const auto partial_dir =
+      std::filesystem::temp_directory_path() / "manim_cpp_scene_partial_cache";
+  std::filesystem::remove_all(partial_dir);
+  std::filesystem::create_directories(partial_dir);
+
+  auto run_once = [&](AlphaRecordingAnimation* probe, std::size_t* cached_count) {
+    EmptyScene scene;
+    auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+    scene.add(square);
+    manim_cpp::scene::SceneFileWriter writer("CacheScene");
+    writer.set_partial_movie_dir(partial_dir);
+    scene.set_file_writer(&writer);
+
+    manim_cpp::animation::MoveToAnimation move(square, {2.0, 1.0, 0.0});
+    scene.play(move, 4);
+    scene.play(*probe, 4);
+    scene.wait(0.5);
+
+    for (const auto& file : writer.uncached_partial_movie_files()) {
+      std::ofstream(partial_dir / file) << "partial";
+    }
+    *cached_count = writer.cached_animation_count();
+    EXPECT_EQ(square->center()[0], 2.0);
+    EXPECT_EQ(square->center()[1], 1.0);
+    return scene.time_seconds();
+  };
+
+  AlphaRecordingAnimation first_probe;
+  std::size_t first_cached = 0;
+  const double first_time = run_once(&first_probe, &first_cached);
+  EXPECT_EQ(first_cached, static_cast<size_t>(0));
+  EXPECT_EQ(first_probe.alphas.size(), static_cast<size_t>(5));
+
+  AlphaRecordingAnimation second_probe;
+  std::size_t second_cached = 0;
+  const double second_time = run_once(&second_probe, &second_cached);
+  EXPECT_EQ(second_cached, static_cast<size_t>(3));
+  EXPECT_EQ(second_time, first_time);
+  ASSERT_EQ(second_probe.alphas.size(), static_cast<size_t>(1));
+  EXPECT_DOUBLE_EQ(second_probe.alphas.front(), 1.0);
+  EXPECT_TRUE(second_probe.finished);
+
+  std::filesystem::remove_all(partial_dir);
+}
+
+TEST(SceneLifecycle, ReplaysAnimationsThatDoNotOptIntoCaching) {
+  // Its offset is state hash_parameters() knows nothing about.
+  class OffsetAnimation : public manim_cpp::animation::Animation {
+   public:
+    explicit OffsetAnimation(std::vector<double>* alphas) : alphas_(alphas) {}
+    void interpolate(double alpha) override { alphas_->push_back(alpha); }
+
+   private:
+    std::vector<double>* alphas_;
+  };
+
+  const auto partial_dir =
+      std::filesystem::temp_directory_path() / "manim_cpp_scene_uncacheable";
+  std::filesystem::remove_all(partial_dir);
+  std::filesystem::create_directories(partial_dir);
+  auto run_once = [&](std::vector<double>* alphas) {
+    EmptyScene scene;
+    manim_cpp::scene::SceneFileWriter writer("UncacheableScene");
+    writer.set_partial_movie_dir(partial_dir);
+    scene.set_file_writer(&writer);
+    OffsetAnimation animation(alphas);
+    scene.play(animation, 4);
+    EXPECT_TRUE(writer.uncached_partial_movie_files().empty());
+    return writer.cached_animation_count();
+  };
+
+  std::vector<double> first;
+  std::vector<double> second;
+  EXPECT_EQ(run_once(&first), static_cast<size_t>(0));
+  EXPECT_EQ(run_once(&second), static_cast<size_t>(0));
+  EXPECT_EQ(second.size(), static_cast<size_t>(5));
+  std::filesystem::remove_all(partial_dir);
+}
+
 TEST(SceneLifecycle, TracksUniqueMobjectsAndSupportsRemoval) {
   EmptyScene scene;
   auto first = std::make_shared<manim_cpp::mobject::Mobject>();
@@ -0,0 +1,211 @@
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/animation/basic_animations.hpp"
+#include "manim_cpp/mobject/geometry.hpp"
+#include "manim_cpp/scene/scene.hpp"
+#include "manim_cpp/scene/scene_timeline.hpp"
+
+namespace {
+
+// Mixes animated segments, a wait and an updater that drifts the square
+// between ticks, so snapshots must capture state rather than replay alphas.
+class TimelineScene : public manim_cpp::scene::Scene {
+ public:
+  void construct() override {
+    auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+    add(square);
+    manim_cpp::animation::MoveToAnimation move(square, {2.0, 0.0, 0.0});
+    play(move, 5);
+    add_updater([square](double dt) { square->shift({0.0, dt, 0.0}); });
+    wait(0.4);
+    manim_cpp::animation::ShiftAnimation shift(square, {-1.0, 0.0, 0.0});
+    shift.set_run_time_seconds(0.7);
+    play(shift, 3);
+  }
+};
+
+// Many mobjects moving every tick, for 300 ticks.
+class CrowdScene : public manim_cpp::scene::Scene {
+ public:
+  void construct() override {
+    for (int i = 0; i < 40; ++i) {
+      auto dot = std::make_shared<manim_cpp::mobject::Dot>();
+      dot->move_to({0.1 * i, 0.0, 0.0});
+      add(dot);
+      add_updater([dot](double dt) { dot->shift({0.0, dt, 0.0}); });
+    }
+    auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+    add(square);
+    manim_cpp::animation::FadeToOpacityAnimation fade(square, 0.0);
+    fade.set_run_time_seconds(5.0);
+    play(fade, 299);
+  }
+};
+
+// An updater that changes a shape, which replaying centers and opacities
+// cannot reproduce.
+class ResizingScene : public manim_cpp::scene::Scene {
+ public:
+  void construct() override {
+    auto square = std::make_shared<manim_cpp::mobject::Square>(1.0);
+    add(square);
+    add_updater([square](double dt) { square->set_side_length(square->side_length() + dt); });
+    manim_cpp::animation::ShiftAnimation shift(square, {1.0, 0.0, 0.0});
+    play(shift, 9);
+  }
+};
+
+class StillScene : public manim_cpp::scene::Scene {
+ public:
+  void construct() override {
+    add(std::make_shared<manim_cpp::mobject::Square>(1.0));
+  }
+};
+
+std::vector<manim_cpp::scene::SceneFrame> stream_frames(manim_cpp::scene::Scene& scene) {
+  std::vector<manim_cpp::scene::SceneFrame> frames;
+  scene.set_frame_sink(
+      [&frames](manim_cpp::scene::SceneFrame frame) { frames.push_back(std::move(frame)); });
+  scene.run();
+  scene.set_frame_sink(nullptr);
+  return frames;
+}
+
+void expect_same_frame(const manim_cpp::scene::SceneFrame& actual,
+                       const manim_cpp::scene::SceneFrame& expected) {
+  EXPECT_EQ(actual.index, expected.index);
+  EXPECT_DOUBLE_EQ(actual.time_seconds, expected.time_seconds);
+  ASSERT_EQ(actual.draw_list.size(), expected.draw_list.size());
+  for (std::size_t command = 0; command < actual.draw_list.size(); ++command) {
+    EXPECT_EQ(actual.draw_list[command].rings, expected.draw_list[command].rings)
+        << "frame " << actual.index;
+  }
+}
+
+}  // namespace
+
+TEST(SceneTimeline, RecordsPlayAndWaitSegments) {
+  TimelineScene scene;
+  scene.set_render_settings({}, 10.0);
+  const auto timeline = manim_cpp::scene::SceneTimeline::compile(scene);
+
+  const auto& segments = timeline.segments();
+  ASSERT_EQ(segments.size(), static_cast<std::size_t>(3));
+  EXPECT_EQ(segments[0].kind, manim_cpp::scene::TimelineSegmentKind::kPlay);
+  EXPECT_DOUBLE_EQ(segments[0].start_seconds, 0.0);
+  EXPECT_EQ(segments[0].steps, static_cast<std::size_t>(5));
+  EXPECT_FALSE(segments[0].animation.empty());
+  EXPECT_EQ(segments[1].kind, manim_cpp::scene::TimelineSegmentKind::kWait);
+  EXPECT_NEAR(segments[1].start_seconds, 1.2, 1e-12);
+  EXPECT_DOUBLE_EQ(segments[1].duration_seconds, 0.4);
+  EXPECT_TRUE(segments[1].animation.empty());
+  EXPECT_NEAR(segments[2].start_seconds, 1.6, 1e-12);
+  EXPECT_DOUBLE_EQ(segments[2].duration_seconds, 0.7);
+
+  EXPECT_EQ(timeline.segment_at(1.3), &segments[1]);
+  EXPECT_EQ(timeline.segment_at(100.0), nullptr);
+  EXPECT_NEAR(timeline.duration_seconds(), scene.time_seconds(), 1e-12);
+  // 6 + 1 + 4 ticks plus the final state.
+  EXPECT_EQ(timeline.snapshots().size(), static_cast<std::size_t>(12));
+}
+
+TEST(SceneTimeline, RandomAccessFramesMatchSequentialStream) {
+  for (const double frame_rate : {7.0, 24.0, 60.0}) {
+    TimelineScene streamed_scene;
+    streamed_scene.set_render_settings({}, frame_rate);
+    const auto expected = stream_frames(streamed_scene);
+
+    TimelineScene compiled_scene;
+    compiled_scene.set_render_settings({}, frame_rate);
+    const auto timeline = manim_cpp::scene::SceneTimeline::compile(compiled_scene);
+    ASSERT_EQ(timeline.frame_count(), expected.size());
+
+    // Walk backwards to show evaluation does not depend on visiting order.
+    for (std::size_t index = timeline.frame_count(); index >= 1; --index) {
+      expect_same_frame(timeline.frame(index), expected[index - 1]);
+    }
+  }
+}
+
+TEST(SceneTimeline, PartitionsFramesIntoDisjointRangesForWorkers) {
+  TimelineScene scene;
+  scene.set_render_settings({}, 30.0);
+  const auto timeline = manim_cpp::scene::SceneTimeline::compile(scene);
+  const auto ranges = timeline.partition_frames(4);
+  ASSERT_EQ(ranges.size(), static_cast<std::size_t>(4));
+  EXPECT_EQ(ranges.front().first_index, static_cast<std::size_t>(1));
+  EXPECT_EQ(ranges.back().last_index, timeline.frame_count());
+  for (std::size_t range = 1; range < ranges.size(); ++range) {
+    EXPECT_EQ(ranges[range].first_index, ranges[range - 1].last_index + 1);
+    EXPECT_LE(ranges[range - 1].size() - ranges[range].size(), static_cast<std::size_t>(1));
+  }
+
+  std::vector<manim_cpp::scene::SceneFrame> frames(timeline.frame_count());
+  std::vector<std::thread> workers;
+  for (const auto& range : ranges) {
+    workers.emplace_back([&timeline, &frames, range]() {
+      for (auto index = range.first_index; index <= range.last_index; ++index) {
+        frames[index - 1] = timeline.frame(index);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  TimelineScene streamed_scene;
+  streamed_scene.set_render_settings({}, 30.0);
+  const auto expected = stream_frames(streamed_scene);
+  ASSERT_EQ(frames.size(), expected.size());
+  for (std::size_t frame = 0; frame < frames.size(); ++frame) {
+    expect_same_frame(frames[frame], expected[frame]);
+  }
+
+  EXPECT_EQ(timeline.partition_frames(1000).size(), timeline.frame_count());
+}
+
+TEST(SceneTimeline, SceneWithoutElapsedTimeHasOneStillFrame) {
+  StillScene scene;
+  const auto timeline = manim_cpp::scene::SceneTimeline::compile(scene);
+  EXPECT_EQ(timeline.frame_count(), static_cast<std::size_t>(1));
+  const auto frame = timeline.frame(1);
+  EXPECT_EQ(frame.index, static_cast<std::size_t>(1));
+  EXPECT_EQ(frame.draw_list.size(), static_cast<std::size_t>(1));
+}
+
+TEST(SceneTimeline, KeepsKeyframesSparseWhileMobjectsMove) {
+  CrowdScene compiled_scene;
+  compiled_scene.set_render_settings({}, 30.0);
+  const auto timeline = manim_cpp::scene::SceneTimeline::compile(compiled_scene, 64);
+  // 300 ticks plus the final state, replayed from a keyframe every 64 ticks.
+  ASSERT_EQ(timeline.snapshots().size(), static_cast<std::size_t>(301));
+  EXPECT_EQ(timeline.keyframe_count(), static_cast<std::size_t>(5));
+
+  CrowdScene streamed_scene;
+  streamed_scene.set_render_settings({}, 30.0);
+  const auto expected = stream_frames(streamed_scene);
+  ASSERT_EQ(timeline.frame_count(), expected.size());
+  for (std::size_t index = timeline.frame_count(); index >= 1; --index) {
+    expect_same_frame(timeline.frame(index), expected[index - 1]);
+  }
+}
+
+TEST(SceneTimeline, StartsKeyframesWhereReplayCannotReproduceState) {
+  ResizingScene compiled_scene;
+  compiled_scene.set_render_settings({}, 10.0);
+  const auto timeline = manim_cpp::scene::SceneTimeline::compile(compiled_scene);
+  EXPECT_EQ(timeline.keyframe_count(), timeline.snapshots().size());
+
+  ResizingScene streamed_scene;
+  streamed_scene.set_render_settings({}, 10.0);
+  const auto expected = stream_frames(streamed_scene);
+  ASSERT_EQ(timeline.frame_count(), expected.size());
+  for (std::size_t index = 1; index <= timeline.frame_count(); ++index) {
+    expect_same_frame(timeline.frame(index), expected[index - 1]);
+  }
+}
@@ -67,3 +67,156 @@ TEST(Triangulation, EarClippingPreservesAreaForConcavePolygon) {
   const double triangles_area = triangulation_area(concave, indices);
   EXPECT_NEAR(triangles_area, source_area, 1e-9);
 }
+
+TEST(Triangulation, EarClippingKeepsClockwiseWinding) {
+  const std::vector<manim_cpp::math::Vec2> clockwise = {
+      {0.0, 1.0}, {1.5, 0.5}, {3.0, 1.0}, {3.0, 0.0}, {0.0, 0.0}};
+
+  const auto indices = manim_cpp::math::triangulate_polygon_ear_clipping(clockwise);
+  ASSERT_EQ(indices.size(), static_cast<size_t>((clockwise.size() - 2) * 3));
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    const auto& a = clockwise[indices[i]];
+    const auto& b = clockwise[indices[i + 1]];
+    const auto& c = clockwise[indices[i + 2]];
+    EXPECT_LT((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]), 0.0);
+  }
+  EXPECT_NEAR(triangulation_area(clockwise, indices), polygon_area(clockwise), 1e-9);
+}
+
+TEST(Triangulation, EarClippingPreservesAreaForLargeConcavePolygon) {
+  // Past 80 vertices ear tests go through the z-order index.
+  std::vector<manim_cpp::math::Vec2> outline;
+  constexpr size_t kVertexCount = 2000;
+  for (size_t i = 0; i < kVertexCount; ++i) {
+    const double angle = 2.0 * 3.14159265358979323846 * static_cast<double>(i) / kVertexCount;
+    const double radius = 1.0 + 0.3 * std::sin(7.0 * angle) + (i % 2 == 0 ? 0.0 : 0.05);
+    outline.push_back({radius * std::cos(angle), radius * std::sin(angle)});
+  }
+
+  const auto indices = manim_cpp::math::triangulate_polygon_ear_clipping(outline);
+  ASSERT_EQ(indices.size(), (kVertexCount - 2) * 3);
+  EXPECT_NEAR(triangulation_area(outline, indices), polygon_area(outline), 1e-9);
+}
+
+TEST(Triangulation, EarClippingCoversSelfIntersectingInput) {
+  const std::vector<manim_cpp::math::Vec2> bowtie = {
+      {0.0, 0.0}, {2.0, 2.0}, {2.0, 0.0}, {0.0, 2.0}};
+
+  const auto indices = manim_cpp::math::triangulate_polygon_ear_clipping(bowtie);
+  ASSERT_FALSE(indices.empty());
+  EXPECT_EQ(indices.size() % 3, 0U);
+  for (const auto index : indices) {
+    EXPECT_LT(index, bowtie.size());
+  }
+  // The crossing point is not a vertex, so the lobes (area 1 each) can only
+  // be covered, not matched.
+  EXPECT_GE(triangulation_area(bowtie, indices), 2.0);
+}
+
+TEST(Triangulation, WithHolesTriangulatesAnnulus) {
+  std::vector<manim_cpp::math::Vec2> outer;
+  std::vector<manim_cpp::math::Vec2> inner;
+  constexpr size_t kRingSize = 64;
+  for (size_t i = 0; i < kRingSize; ++i) {
+    const double angle = 2.0 * 3.14159265358979323846 * static_cast<double>(i) / kRingSize;
+    outer.push_back({2.0 * std::cos(angle), 2.0 * std::sin(angle)});
+    inner.push_back({std::cos(angle), std::sin(angle)});
+  }
+
+  const auto indices = manim_cpp::math::triangulate_polygon_with_holes(outer, {inner});
+  // One ring of 2 * kRingSize vertices plus the two bridge copies.
+  ASSERT_EQ(indices.size(), 2 * kRingSize * 3);
+  std::vector<manim_cpp::math::Vec2> vertices = outer;
+  vertices.insert(vertices.end(), inner.begin(), inner.end());
+  for (const auto index : indices) {
+    ASSERT_LT(index, vertices.size());
+  }
+  EXPECT_NEAR(triangulation_area(vertices, indices),
+              polygon_area(outer) - polygon_area(inner), 1e-9);
+}
+
+TEST(Triangulation, WithHolesFollowsOuterWindingWhateverTheHoleWinding) {
+  // Clockwise outer ring; one hole clockwise, one counter-clockwise.
+  const std::vector<manim_cpp::math::Vec2> outer = {
+      {0.0, 0.0}, {0.0, 10.0}, {10.0, 10.0}, {10.0, 0.0}};
+  const std::vector<std::vector<manim_cpp::math::Vec2>> holes = {
+      {{1.0, 1.0}, {1.0, 4.0}, {4.0, 4.0}, {4.0, 1.0}},
+      {{6.0, 6.0}, {9.0, 6.0}, {9.0, 8.0}, {6.0, 8.0}}};
+
+  const auto indices = manim_cpp::math::triangulate_polygon_with_holes(outer, holes);
+  ASSERT_EQ(indices.size(), static_cast<size_t>((12 + 2 * 2 - 2) * 3));
+  std::vector<manim_cpp::math::Vec2> vertices = outer;
+  for (const auto& hole : holes) {
+    vertices.insert(vertices.end(), hole.begin(), hole.end());
+  }
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    const auto& a = vertices[indices[i]];
+    const auto& b = vertices[indices[i + 1]];
+    const auto& c = vertices[indices[i + 2]];
+    EXPECT_LT((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0]), 0.0);
+  }
+  EXPECT_NEAR(triangulation_area(vertices, indices), 100.0 - 9.0 - 6.0, 1e-9);
+}
+
+TEST(Triangulation, WithHolesBridgesManyHoles) {
+  // A 20 x 20 grid of square holes, so bridges land on earlier holes.
+  const std::vector<manim_cpp::math::Vec2> outer = {
+      {0.0, 0.0}, {41.0, 0.0}, {41.0, 41.0}, {0.0, 41.0}};
+  std::vector<std::vector<manim_cpp::math::Vec2>> holes;
+  std::vector<manim_cpp::math::Vec2> vertices = outer;
+  for (int row = 0; row < 20; ++row) {
+    for (int column = 0; column < 20; ++column) {
+      const double x = 1.0 + 2.0 * column;
+      const double y = 1.0 + 2.0 * row + 0.25 * (column % 3);
+      holes.push_back({{x, y}, {x, y + 0.5}, {x + 1.0, y + 0.5}, {x + 1.0, y}});
+      vertices.insert(vertices.end(), holes.back().begin(), holes.back().end());
+    }
+  }
+
+  const auto indices = manim_cpp::math::triangulate_polygon_with_holes(outer, holes);
+  // Hole corners in line with a bridge are dropped as collinear, so there can
+  // be fewer than (vertices + 2 * holes - 2) triangles.
+  ASSERT_FALSE(indices.empty());
+  EXPECT_EQ(indices.size() % 3, 0U);
+  for (const auto index : indices) {
+    ASSERT_LT(index, vertices.size());
+  }
+  EXPECT_NEAR(triangulation_area(vertices, indices), 41.0 * 41.0 - 400 * 0.5, 1e-6);
+}
+
+TEST(Triangulation, WithHolesHashesHolesOutsideTheOuterBoundingBox) {
+  // Enough vertices for the z-order hash. The hole lies far outside the outer
+  // ring's bounding box, whose z-order coordinates would overflow int32 if
+  // the box covered the outer ring alone.
+  std::vector<manim_cpp::math::Vec2> outer;
+  constexpr size_t kRingSize = 100;
+  for (size_t i = 0; i < kRingSize; ++i) {
+    const double angle = 2.0 * 3.14159265358979323846 * static_cast<double>(i) / kRingSize;
+    outer.push_back({std::cos(angle), std::sin(angle)});
+  }
+  const std::vector<manim_cpp::math::Vec2> hole = {
+      {1.0e6, -0.2}, {1.0e6, 0.3}, {1.0e6 + 0.5, 0.3}, {1.0e6 + 0.5, -0.2}};
+
+  const auto indices = manim_cpp::math::triangulate_polygon_with_holes(outer, {hole});
+  ASSERT_EQ(indices.size(), (kRingSize + hole.size()) * 3);
+  std::vector<manim_cpp::math::Vec2> vertices = outer;
+  vertices.insert(vertices.end(), hole.begin(), hole.end());
+  double signed_area = 0.0;
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    ASSERT_LT(indices[i], vertices.size());
+    ASSERT_LT(indices[i + 1], vertices.size());
+    ASSERT_LT(indices[i + 2], vertices.size());
+    const auto& a = vertices[indices[i]];
+    const auto& b = vertices[indices[i + 1]];
+    const auto& c = vertices[indices[i + 2]];
+    signed_area += ((b[0] - a[0]) * (c[1] - a[1]) - (b[1] - a[1]) * (c[0] - a[0])) * 0.5;
+  }
+  // Clipping the bridged ring keeps its signed area: outer minus hole.
+  EXPECT_NEAR(signed_area, polygon_area(outer) - polygon_area(hole), 1e-6);
+}
+
+TEST(Triangulation, WithHolesReturnsEmptyForDegenerateOuterRing) {
+  EXPECT_TRUE(manim_cpp::math::triangulate_polygon_with_holes(
+                  {{0.0, 0.0}, {1.0, 0.0}}, {{{0.1, 0.1}, {0.2, 0.1}, {0.1, 0.2}}})
+                  .empty());
+}
@@ -0,0 +1,56 @@
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/y4m_writer.hpp"
+
+namespace {
+
+std::string read_file(const std::filesystem::path& path) {
+  std::ifstream input(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+}
+
+}  // namespace
+
+TEST(Y4mWriter, FormatsFrameRatesAsRationals) {
+  EXPECT_EQ(manim_cpp::renderer::Y4mWriter::header(1920, 1080, 60.0),
+            "YUV4MPEG2 W1920 H1080 F60:1 Ip A1:1 C420jpeg XYSCSS=420JPEG "
+            "XCOLORRANGE=LIMITED\n");
+  EXPECT_NE(manim_cpp::renderer::Y4mWriter::header(640, 360, 29.97).find(" F30000:1001 "),
+            std::string::npos);
+  EXPECT_NE(manim_cpp::renderer::Y4mWriter::header(640, 360, 12.5).find(" F25:2 "),
+            std::string::npos);
+}
+
+TEST(Y4mWriter, StreamsFramesAndRepeats) {
+  const auto path = std::filesystem::temp_directory_path() / "manim_cpp_y4m_writer.y4m";
+  manim_cpp::renderer::FrameBuffer frame(5, 3);
+  frame.clear({.r = 255, .g = 255, .b = 255});
+
+  manim_cpp::renderer::Y4mWriter writer;
+  ASSERT_TRUE(writer.open(path, 5, 3, 24.0)) << writer.error();
+  EXPECT_FALSE(writer.repeat_last_frame());
+  ASSERT_TRUE(writer.write_frame(frame)) << writer.error();
+  ASSERT_TRUE(writer.repeat_last_frame()) << writer.error();
+  EXPECT_FALSE(writer.write_frame(manim_cpp::renderer::FrameBuffer(4, 3)));
+  EXPECT_EQ(writer.frames_written(), static_cast<std::size_t>(2));
+  writer.close();
+
+  const auto header = manim_cpp::renderer::Y4mWriter::header(5, 3, 24.0);
+  const auto record_size = manim_cpp::renderer::Y4mWriter::frame_record_size(5, 3);
+  EXPECT_EQ(record_size, static_cast<std::size_t>(6 + 15 + 2 * 6));
+  const auto contents = read_file(path);
+  ASSERT_EQ(contents.size(), header.size() + 2 * record_size);
+  EXPECT_EQ(contents.substr(0, header.size()), header);
+  const auto first = contents.substr(header.size(), record_size);
+  EXPECT_EQ(first.substr(0, 6), "FRAME\n");
+  EXPECT_EQ(first.substr(6, 15), std::string(15, static_cast<char>(235)));
+  EXPECT_EQ(first.substr(21), std::string(12, static_cast<char>(128)));
+  EXPECT_EQ(contents.substr(header.size() + record_size), first);
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,67 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "manim_cpp/renderer/frame_buffer.hpp"
+#include "manim_cpp/renderer/yuv_convert.hpp"
+
+namespace {
+
+manim_cpp::renderer::FrameBuffer random_frame(const std::size_t width,
+                                              const std::size_t height,
+                                              const unsigned seed) {
+  manim_cpp::renderer::FrameBuffer frame(width, height);
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> byte(0, 255);
+  for (std::size_t index = 0; index < frame.byte_size(); ++index) {
+    frame.data()[index] = static_cast<std::uint8_t>(byte(generator));
+  }
+  return frame;
+}
+
+}  // namespace
+
+TEST(YuvConvert, MapsReferenceColorsToLimitedRange) {
+  const std::pair<manim_cpp::renderer::Rgba8, std::array<int, 3>> cases[] = {
+      {{.r = 0, .g = 0, .b = 0}, {16, 128, 128}},
+      {{.r = 255, .g = 255, .b = 255}, {235, 128, 128}},
+      {{.r = 255, .g = 0, .b = 0}, {82, 90, 240}},
+  };
+  for (const auto& [color, expected] : cases) {
+    manim_cpp::renderer::FrameBuffer frame(4, 2);
+    frame.clear(color);
+    manim_cpp::renderer::Yuv420Frame output;
+    manim_cpp::renderer::rgba_to_yuv420(frame, &output);
+    ASSERT_EQ(output.y.size(), static_cast<std::size_t>(8));
+    ASSERT_EQ(output.u.size(), static_cast<std::size_t>(2));
+    EXPECT_EQ(output.y[5], expected[0]);
+    EXPECT_EQ(output.u[1], expected[1]);
+    EXPECT_EQ(output.v[1], expected[2]);
+  }
+}
+
+TEST(YuvConvert, SimdPathMatchesScalarReferenceOnOddSizes) {
+  const std::pair<std::size_t, std::size_t> sizes[] = {
+      {1, 1}, {15, 3}, {16, 2}, {17, 5}, {33, 9}, {64, 36}, {127, 31},
+  };
+  unsigned seed = 1;
+  for (const auto& [width, height] : sizes) {
+    const auto frame = random_frame(width, height, seed++);
+    manim_cpp::renderer::Yuv420Frame expected;
+    manim_cpp::renderer::Yuv420Frame actual;
+    manim_cpp::renderer::rgba_to_yuv420_scalar(frame, &expected);
+    manim_cpp::renderer::rgba_to_yuv420(frame, &actual);
+    EXPECT_EQ(actual.chroma_width(), (width + 1) / 2);
+    EXPECT_EQ(actual.chroma_height(), (height + 1) / 2);
+    EXPECT_EQ(actual.y, expected.y) << width << "x" << height;
+    EXPECT_EQ(actual.u, expected.u) << width << "x" << height;
+    EXPECT_EQ(actual.v, expected.v) << width << "x" << height;
+  }
+  const std::string converter = manim_cpp::renderer::yuv420_converter_name();
+  EXPECT_TRUE(converter == "avx2" || converter == "neon" || converter == "scalar");
+}
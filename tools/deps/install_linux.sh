@@ -12,4 +12,5 @@ sudo apt-get install -y \
   libglfw3-dev \
   libfreetype6-dev \
   libpango1.0-dev \
+  zlib1g-dev \
   ffmpeg
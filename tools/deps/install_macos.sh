@@ -9,5 +9,6 @@ brew install \
   glfw \
   freetype \
   pango \
+  zlib \
   doxygen \
   mdbook
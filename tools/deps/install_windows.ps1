@@ -6,4 +6,31 @@ winget install GLFW.GLFW
 winget install Doxygen.Doxygen
 winget install Rustlang.Rustup
 
+# zlib has no winget package; install it through vcpkg, statically linked
+# against the dynamic CRT that MSVC builds use by default.
+$vcpkgRoot = $env:VCPKG_ROOT
+if (-not $vcpkgRoot) {
+  $vcpkgRoot = $env:VCPKG_INSTALLATION_ROOT
+}
+if (-not $vcpkgRoot) {
+  $vcpkgRoot = Join-Path $HOME "vcpkg"
+  if (-not (Test-Path $vcpkgRoot)) {
+    git clone https://github.com/microsoft/vcpkg.git $vcpkgRoot
+    & (Join-Path $vcpkgRoot "bootstrap-vcpkg.bat") -disableMetrics
+  }
+}
+$vcpkgTriplet = "x64-windows-static-md"
+& (Join-Path $vcpkgRoot "vcpkg.exe") install "zlib:$vcpkgTriplet"
+if ($LASTEXITCODE -ne 0) {
+  throw "vcpkg failed to install zlib."
+}
+
+$toolchain = (Join-Path $vcpkgRoot "scripts/buildsystems/vcpkg.cmake") -replace "\\", "/"
+$cmakeArgs = "-D CMAKE_TOOLCHAIN_FILE=$toolchain -D VCPKG_TARGET_TRIPLET=$vcpkgTriplet"
+if ($env:GITHUB_ENV) {
+  # CI appends these to its configure step.
+  Add-Content -Path $env:GITHUB_ENV -Value "MANIM_CPP_CMAKE_ARGS=$cmakeArgs"
+}
+Write-Host "Configure with: $cmakeArgs"
+
 Write-Host "Install MSVC Build Tools + Windows SDK via Visual Studio Installer if missing."